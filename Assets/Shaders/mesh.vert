@@ -6,6 +6,10 @@ layout(location = 1) in vec3 inNormal;
 layout(location = 2) in vec3 inColor;
 layout(location = 3) in vec2 inTexCoord;
 
+// Данные экземпляра (binding 1, VK_VERTEX_INPUT_RATE_INSTANCE): матрица модели занимает location 4-7
+layout(location = 4) in mat4 instanceModel;
+layout(location = 8) in vec4 instanceColor;
+
 layout(location = 0) out vec3 fragColor;
 layout(location = 1) out vec3 fragNormal;
 layout(location = 2) out vec3 fragPos;
@@ -16,23 +20,18 @@ layout(binding = 0) uniform SceneUBO {
     vec3 cameraPos;
 } scene;
 
-layout(binding = 1) uniform ModelUBO {
-    mat4 model;
-    vec4 color;
-} model;
-
 void main() {
     // Преобразование позиции в мировые координаты
-    vec4 worldPosition = model.model * vec4(inPosition, 1.0);
+    vec4 worldPosition = instanceModel * vec4(inPosition, 1.0);
     gl_Position = scene.proj * scene.view * worldPosition;
     
-    // Передаем цвет меша из ModelUBO (устанавливается в коде при отрисовке)
-    fragColor = model.color.rgb;
+    // Передаем цвет меша из данных экземпляра (устанавливается в коде при отрисовке)
+    fragColor = instanceColor.rgb;
     
     // Преобразование нормалей в мировое пространство
-    mat3 normalMatrix = mat3(transpose(inverse(model.model)));
+    mat3 normalMatrix = mat3(transpose(inverse(instanceModel)));
     fragNormal = normalize(normalMatrix * inNormal);
     
     // Позиция в мировых координатах для расчета освещения
     fragPos = worldPosition.xyz;
-}
\ No newline at end of file
+}
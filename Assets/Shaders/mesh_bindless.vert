@@ -0,0 +1,51 @@
+#version 450
+#extension GL_ARB_separate_shader_objects : enable
+#extension GL_EXT_nonuniform_qualifier : enable
+
+layout(location = 0) in vec3 inPosition;
+layout(location = 1) in vec3 inNormal;
+layout(location = 2) in vec3 inColor;
+layout(location = 3) in vec2 inTexCoord;
+
+layout(location = 0) out vec3 fragColor;
+layout(location = 1) out vec3 fragNormal;
+layout(location = 2) out vec3 fragPos;
+
+layout(set = 0, binding = 0) uniform SceneUBO {
+    mat4 view;
+    mat4 proj;
+    vec3 cameraPos;
+} scene;
+
+// Совпадает с FInstanceData: матрица модели по столбцам и цвет
+struct InstanceData {
+    mat4 model;
+    vec4 color;
+};
+
+// Глобальный массив instance буферов (descriptor indexing), по одному на кадр в полете
+layout(std430, set = 1, binding = 0) readonly buffer InstanceBuffer {
+    InstanceData instances[];
+} instanceBuffers[];
+
+// Слот массива с данными текущего кадра
+layout(push_constant) uniform DrawConstants {
+    uint instanceBufferIndex;
+} draw;
+
+void main() {
+    // gl_InstanceIndex уже включает firstInstance группы
+    InstanceData instance = instanceBuffers[draw.instanceBufferIndex].instances[gl_InstanceIndex];
+
+    // Преобразование позиции в мировые координаты
+    vec4 worldPosition = instance.model * vec4(inPosition, 1.0);
+    gl_Position = scene.proj * scene.view * worldPosition;
+
+    fragColor = instance.color.rgb;
+
+    // Преобразование нормалей в мировое пространство
+    mat3 normalMatrix = mat3(transpose(inverse(instance.model)));
+    fragNormal = normalize(normalMatrix * inNormal);
+
+    fragPos = worldPosition.xyz;
+}
@@ -0,0 +1,139 @@
+#include <algorithm>
+#include <cstdio>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Benchmark.h"
+#include "Engine/Core/Utilities/MeshCooker.h"
+#include "Engine/Core/Utilities/ObjLoader.h"
+
+namespace
+{
+  // Синтетическая сетка side x side с uv и нормалями, грани - квады с относительными индексами
+  std::string BuildGridOBJ(int side)
+  {
+    std::string text;
+    text.reserve(static_cast<size_t>(side) * side * 96);
+    char line[128];
+    for (int y = 0; y < side; ++y)
+    {
+      for (int x = 0; x < side; ++x)
+      {
+        std::snprintf(line, sizeof(line), "v %.6f %.6f %.6f\nvt %.5f %.5f\nvn 0 1 0\n", x * 0.1f,
+                      ((x * 7 + y * 13) % 17) * 0.01f, y * 0.1f, float(x) / side, float(y) / side);
+        text += line;
+        if (x > 0 && y > 0)
+        {
+          const int up = side + 1;
+          std::snprintf(line, sizeof(line), "f -1/-1/-1 -2/-2/-2 -%d/-%d/-%d -%d/-%d/-%d\n", up + 1, up + 1,
+                        up + 1, up, up, up);
+          text += line;
+        }
+      }
+    }
+    return text;
+  }
+}  // namespace
+
+void RegisterAssetBenchmarks(CBenchRunner& runner)
+{
+  // Каждый OBJ из Assets/Meshes - отдельный бенчмарк; порядок по имени файла стабилен
+  const std::filesystem::path meshDir = std::filesystem::path(runner.GetSettings().AssetsPath) / "Meshes";
+
+  std::vector<std::filesystem::path> meshes;
+  std::error_code error;
+  for (const auto& entry : std::filesystem::directory_iterator(meshDir, error))
+  {
+    if (entry.is_regular_file() && entry.path().extension() == ".obj")
+    {
+      meshes.push_back(entry.path());
+    }
+  }
+  std::sort(meshes.begin(), meshes.end());
+
+  for (const auto& mesh : meshes)
+  {
+    const std::string path = mesh.string();
+    runner.Add("assets", "load_obj/" + mesh.stem().string(), [path]
+               {
+                 FBenchCase benchCase;
+                 // Элемент - вершина загруженного меша
+                 FStaticMesh probe = ObjLoader::LoadOBJ(path);
+                 if (probe.vertices.empty())
+                   return benchCase;
+
+                 benchCase.Items = probe.vertices.size();
+                 benchCase.Run = [path](uint64_t iterations)
+                 {
+                   for (uint64_t it = 0; it < iterations; ++it)
+                   {
+                     FStaticMesh loaded = ObjLoader::LoadOBJ(path);
+                     DoNotOptimize(loaded.vertices.data());
+                   }
+                 };
+                 return benchCase;
+               });
+
+    // Тот же меш из запеченного файла: mmap, проверка заголовка и копирование блоков
+    runner.Add("assets", "load_cooked/" + mesh.stem().string(), [path, stem = mesh.stem().string()]
+               {
+                 FBenchCase benchCase;
+                 const std::string cookedPath =
+                     (std::filesystem::temp_directory_path() / ("engine_bench_" + stem + ".cemesh")).string();
+                 if (!MeshCooker::CookOBJ(path, cookedPath))
+                   return benchCase;
+
+                 CCookedMesh probe;
+                 if (!probe.Open(cookedPath))
+                   return benchCase;
+
+                 benchCase.Items = probe.GetVertices().size();
+                 benchCase.Run = [cookedPath](uint64_t iterations)
+                 {
+                   for (uint64_t it = 0; it < iterations; ++it)
+                   {
+                     CCookedMesh cooked;
+                     cooked.Open(cookedPath);
+                     FStaticMesh loaded = cooked.ToStaticMesh();
+                     DoNotOptimize(loaded.vertices.data());
+                   }
+                 };
+                 return benchCase;
+               });
+  }
+
+  // Разбор из памяти без файловой системы; элемент - байт исходного текста
+  const uint32_t hardwareThreads = std::max(1u, std::thread::hardware_concurrency());
+  std::vector<uint32_t> threadCounts = {1};
+  if (hardwareThreads > 1)
+  {
+    threadCounts.push_back(hardwareThreads);
+  }
+
+  const int gridSide = runner.GetSettings().Quick ? 128 : 512;
+  for (uint32_t threads : threadCounts)
+  {
+    runner.Add("assets", "parse_obj_grid/threads_" + std::to_string(threads), [threads, gridSide]
+               {
+                 auto text = std::make_shared<std::string>(BuildGridOBJ(gridSide));
+
+                 FObjLoadSettings settings;
+                 settings.MaxThreads = threads;
+
+                 FBenchCase benchCase;
+                 benchCase.Items = text->size();
+                 benchCase.Run = [text, settings](uint64_t iterations)
+                 {
+                   for (uint64_t it = 0; it < iterations; ++it)
+                   {
+                     FStaticMesh parsed = ObjLoader::ParseOBJ(text->data(), text->size(), settings, "grid");
+                     DoNotOptimize(parsed.vertices.data());
+                   }
+                 };
+                 return benchCase;
+               });
+  }
+}
@@ -0,0 +1,22 @@
+#include "Benchmark.h"
+#include "Engine/Core/CommandLine.h"
+
+// engine_bench [--filter=<substring>] [--samples=N] [--min-sample-ms=X]
+//              [--output=<file.json>] [--assets=<dir>] [--quick]
+int main(int argc, char* argv[])
+{
+  CommandLine::Parse(argc, argv);
+
+  CBenchRunner runner(FBenchSettings::FromCommandLine());
+  RegisterMathBenchmarks(runner);
+  RegisterAssetBenchmarks(runner);
+  RegisterSceneBenchmarks(runner);
+  RegisterLoggerBenchmarks(runner);
+  RegisterJobBenchmarks(runner);
+  RegisterEntityBenchmarks(runner);
+  RegisterProfilerBenchmarks(runner);
+  RegisterRenderThreadBenchmarks(runner);
+
+  runner.RunAll();
+  return runner.WriteReport() ? 0 : 1;
+}
@@ -0,0 +1,217 @@
+#include "Benchmark.h"
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+
+#include "Engine/Core/CommandLine.h"
+#include "Math/MathSIMD.hpp"
+
+namespace
+{
+  using BenchClock = std::chrono::steady_clock;
+
+  double ElapsedNs(BenchClock::time_point start, BenchClock::time_point end)
+  {
+    return std::chrono::duration<double, std::nano>(end - start).count();
+  }
+
+  // Экранирование для строковых значений JSON
+  std::string Escape(const std::string& value)
+  {
+    std::string result;
+    result.reserve(value.size());
+    for (char c : value)
+    {
+      if (c == '"' || c == '\\')
+        result += '\\';
+      result += c;
+    }
+    return result;
+  }
+
+  const char* CompilerName()
+  {
+#if defined(__clang__)
+    return "clang " __clang_version__;
+#elif defined(__GNUC__)
+    return "gcc " __VERSION__;
+#elif defined(_MSC_VER)
+    return "msvc";
+#else
+    return "unknown";
+#endif
+  }
+}  // namespace
+
+FBenchSettings FBenchSettings::FromCommandLine()
+{
+  auto& cmd = CommandLine::Get();
+  FBenchSettings settings;
+
+  settings.Samples = static_cast<uint32_t>(std::max(1, cmd.GetInt("samples", static_cast<int>(settings.Samples))));
+  settings.MinSampleMs = std::max(0.1f, cmd.GetFloat("min-sample-ms", static_cast<float>(settings.MinSampleMs)));
+  settings.Filter = cmd.GetString("filter", settings.Filter);
+  settings.OutputPath = cmd.GetString("output", settings.OutputPath);
+  settings.AssetsPath = cmd.GetString("assets", settings.AssetsPath);
+  settings.Quick = cmd.HasFlag("quick");
+  return settings;
+}
+
+double FBenchResult::Min() const
+{
+  return SampleNs.empty() ? 0.0 : *std::min_element(SampleNs.begin(), SampleNs.end());
+}
+
+double FBenchResult::Max() const
+{
+  return SampleNs.empty() ? 0.0 : *std::max_element(SampleNs.begin(), SampleNs.end());
+}
+
+double FBenchResult::Mean() const
+{
+  if (SampleNs.empty())
+    return 0.0;
+
+  double total = 0.0;
+  for (double sample : SampleNs)
+  {
+    total += sample;
+  }
+  return total / SampleNs.size();
+}
+
+double FBenchResult::Median() const
+{
+  if (SampleNs.empty())
+    return 0.0;
+
+  std::vector<double> sorted = SampleNs;
+  std::sort(sorted.begin(), sorted.end());
+  const size_t middle = sorted.size() / 2;
+  return (sorted.size() % 2) ? sorted[middle] : 0.5 * (sorted[middle - 1] + sorted[middle]);
+}
+
+CBenchRunner::CBenchRunner(const FBenchSettings& settings) : m_Settings{settings}
+{
+}
+
+void CBenchRunner::Add(const std::string& group, const std::string& name, FBenchFactory factory)
+{
+  m_Entries.push_back({group, name, std::move(factory)});
+}
+
+void CBenchRunner::RunAll()
+{
+  for (const auto& entry : m_Entries)
+  {
+    const std::string fullName = entry.Group + "/" + entry.Name;
+    if (!m_Settings.Filter.empty() && fullName.find(m_Settings.Filter) == std::string::npos)
+      continue;
+
+    FBenchCase benchCase = entry.Factory();
+    if (!benchCase.Run)
+    {
+      std::cerr << "[engine_bench] skipped " << fullName << std::endl;
+      continue;
+    }
+
+    std::cerr << "[engine_bench] " << fullName << std::endl;
+    m_Results.push_back(Measure(entry, benchCase));
+  }
+}
+
+FBenchResult CBenchRunner::Measure(const FEntry& entry, const FBenchCase& benchCase) const
+{
+  FBenchResult result;
+  result.Group = entry.Group;
+  result.Name = entry.Name;
+  result.Items = benchCase.Items;
+
+  // Прогрев и калибровка: удваиваем число повторов, пока сэмпл не станет достаточно длинным
+  const double minSampleNs = m_Settings.MinSampleMs * 1.0e6;
+  uint64_t iterations = 1;
+  while (true)
+  {
+    const auto start = BenchClock::now();
+    benchCase.Run(iterations);
+    const double elapsed = ElapsedNs(start, BenchClock::now());
+    if (elapsed >= minSampleNs || iterations >= (1ull << 40))
+      break;
+
+    iterations *= (elapsed * 8.0 < minSampleNs) ? 8 : 2;
+  }
+  result.Iterations = iterations;
+
+  result.SampleNs.reserve(m_Settings.Samples);
+  for (uint32_t sample = 0; sample < m_Settings.Samples; ++sample)
+  {
+    const auto start = BenchClock::now();
+    benchCase.Run(iterations);
+    result.SampleNs.push_back(ElapsedNs(start, BenchClock::now()) / iterations);
+  }
+  return result;
+}
+
+std::string CBenchRunner::BuildReport() const
+{
+  // Порядок ключей и формат чисел фиксированы, чтобы отчеты разных версий можно было сравнивать diff'ом
+  std::ostringstream out;
+  out << std::fixed << std::setprecision(3);
+  out << "{\n";
+  out << "  \"schema_version\": 1,\n";
+  out << "  \"suite\": \"engine_bench\",\n";
+  out << "  \"compiler\": \"" << Escape(CompilerName()) << "\",\n";
+  out << "  \"simd_backend\": \"" << CEMath::SIMD::GetBackendName() << "\",\n";
+  out << "  \"samples\": " << m_Settings.Samples << ",\n";
+  out << "  \"quick\": " << (m_Settings.Quick ? "true" : "false") << ",\n";
+  out << "  \"benchmarks\": [";
+  for (size_t i = 0; i < m_Results.size(); ++i)
+  {
+    const FBenchResult& result = m_Results[i];
+    const double median = result.Median();
+    const double itemsPerSecond = median > 0.0 ? result.Items * 1.0e9 / median : 0.0;
+
+    out << (i ? ",\n" : "\n");
+    out << "    {"
+        << "\"name\": \"" << Escape(result.Group + "/" + result.Name) << "\""
+        << ", \"group\": \"" << Escape(result.Group) << "\""
+        << ", \"items\": " << result.Items
+        << ", \"iterations\": " << result.Iterations
+        << ", \"ns_per_op\": {"
+        << "\"min\": " << result.Min()
+        << ", \"median\": " << median
+        << ", \"mean\": " << result.Mean()
+        << ", \"max\": " << result.Max()
+        << "}"
+        << ", \"items_per_second\": " << itemsPerSecond
+        << "}";
+  }
+  out << (m_Results.empty() ? "]\n" : "\n  ]\n");
+  out << "}\n";
+  return out.str();
+}
+
+bool CBenchRunner::WriteReport() const
+{
+  const std::string report = BuildReport();
+
+  if (m_Settings.OutputPath.empty())
+  {
+    std::cout << report << std::flush;
+    return true;
+  }
+
+  std::ofstream file(m_Settings.OutputPath, std::ios::trunc);
+  if (!file.is_open())
+  {
+    std::cerr << "[engine_bench] failed to write report: " << m_Settings.OutputPath << std::endl;
+    return false;
+  }
+  file << report;
+  std::cerr << "[engine_bench] report written to: " << m_Settings.OutputPath << std::endl;
+  return true;
+}
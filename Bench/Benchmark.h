@@ -0,0 +1,98 @@
+#pragma once
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+// Настройки прогона engine_bench
+struct FBenchSettings
+{
+  uint32_t Samples = 10;          // сэмплов на один бенчмарк
+  double MinSampleMs = 20.0;      // минимальная длительность сэмпла при калибровке
+  std::string Filter;             // подстрока в имени бенчмарка, пусто = все
+  std::string OutputPath;         // пусто = stdout
+  std::string AssetsPath = "Assets";
+  bool Quick = false;             // уменьшенные размеры сцен для быстрой проверки
+
+  static FBenchSettings FromCommandLine();
+};
+
+// Подготовленный бенчмарк: Run(Iterations) выполняет Iterations повторов,
+// Items - сколько элементов (акторов, вершин, сообщений) обрабатывает один повтор
+struct FBenchCase
+{
+  uint64_t Items = 1;
+  std::function<void(uint64_t Iterations)> Run;
+};
+
+// Фабрика создает состояние бенчмарка только если он прошел фильтр
+using FBenchFactory = std::function<FBenchCase()>;
+
+struct FBenchResult
+{
+  std::string Group;
+  std::string Name;
+  uint64_t Items = 0;
+  uint64_t Iterations = 0;
+  std::vector<double> SampleNs;  // время одного повтора по сэмплам (нс)
+
+  double Min() const;
+  double Max() const;
+  double Mean() const;
+  double Median() const;
+};
+
+class CBenchRunner
+{
+ public:
+  explicit CBenchRunner(const FBenchSettings& settings);
+
+  const FBenchSettings& GetSettings() const
+  {
+    return m_Settings;
+  }
+
+  // Полное имя бенчмарка: Group/Name
+  void Add(const std::string& group, const std::string& name, FBenchFactory factory);
+
+  void RunAll();
+
+  std::string BuildReport() const;
+  bool WriteReport() const;
+
+ private:
+  struct FEntry
+  {
+    std::string Group;
+    std::string Name;
+    FBenchFactory Factory;
+  };
+
+  FBenchResult Measure(const FEntry& entry, const FBenchCase& benchCase) const;
+
+  FBenchSettings m_Settings;
+  std::vector<FEntry> m_Entries;
+  std::vector<FBenchResult> m_Results;
+};
+
+// Не дает компилятору выбросить вычисления, результат которых не используется
+template <typename T>
+inline void DoNotOptimize(const T& value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+  asm volatile("" : : "r,m"(value) : "memory");
+#else
+  static volatile const void* sink;
+  sink = &value;
+#endif
+}
+
+// Регистрация групп бенчмарков (каждая в своем файле)
+void RegisterMathBenchmarks(CBenchRunner& runner);
+void RegisterAssetBenchmarks(CBenchRunner& runner);
+void RegisterSceneBenchmarks(CBenchRunner& runner);
+void RegisterLoggerBenchmarks(CBenchRunner& runner);
+void RegisterJobBenchmarks(CBenchRunner& runner);
+void RegisterEntityBenchmarks(CBenchRunner& runner);
+void RegisterProfilerBenchmarks(CBenchRunner& runner);
+void RegisterRenderThreadBenchmarks(CBenchRunner& runner);
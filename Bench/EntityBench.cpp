@@ -0,0 +1,91 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "Benchmark.h"
+#include "Engine/Core/Jobs/JobSystem.h"
+#include "Engine/Core/Rendering/Data/RenderData.h"
+#include "Engine/GamePlay/Entities/EntitySystems.h"
+
+namespace
+{
+  std::vector<uint32_t> EntityCounts(const FBenchSettings& settings)
+  {
+    if (settings.Quick)
+      return {100000};
+    return {100000, 1000000};
+  }
+
+  // Сущности на решетке 100 x 100 x N; скорость у всех, меш у каждой
+  std::shared_ptr<CEntityManager> BuildEntities(uint32_t count, const FStaticMesh* mesh)
+  {
+    auto entities = std::make_shared<CEntityManager>();
+    FEntityMesh entityMesh;
+    entityMesh.Mesh = mesh;
+    entityMesh.BoundsRadius = 1.0f;
+
+    for (uint32_t i = 0; i < count; ++i)
+    {
+      FEntityTransform transform;
+      transform.Position = FVector(static_cast<float>(i % 100), static_cast<float>((i / 100) % 100),
+                                   static_cast<float>(i / 10000)) * 2.0f;
+      entities->CreateEntity(transform, FEntityVelocity{FVector(0.0f, 0.0f, 1.0f)}, entityMesh);
+    }
+    return entities;
+  }
+}  // namespace
+
+void RegisterEntityBenchmarks(CBenchRunner& runner)
+{
+  // Items - сущностей за тик системы движения
+  for (uint32_t count : EntityCounts(runner.GetSettings()))
+  {
+    runner.Add("entities", "movement_tick/" + std::to_string(count), [count]
+               {
+                 CJobSystem::Get().Start(CJobSystem::GetDefaultWorkerCount());
+                 auto mesh = std::make_shared<FStaticMesh>();
+                 auto entities = BuildEntities(count, mesh.get());
+                 entities->AddSystem("Movement", &EntitySystems::Movement);
+
+                 FBenchCase benchCase;
+                 benchCase.Items = count;
+                 benchCase.Run = [entities, mesh](uint64_t iterations)
+                 {
+                   for (uint64_t it = 0; it < iterations; ++it)
+                   {
+                     entities->RunSystems(1.0f / 60.0f);
+                   }
+                 };
+                 return benchCase;
+               });
+  }
+
+  // Сбор RenderObject с отсечением; Items - проверенных сущностей
+  for (uint32_t count : EntityCounts(runner.GetSettings()))
+  {
+    runner.Add("entities", "collect_render_data/" + std::to_string(count), [count]
+               {
+                 CJobSystem::Get().Start(CJobSystem::GetDefaultWorkerCount());
+                 auto mesh = std::make_shared<FStaticMesh>();
+                 auto entities = BuildEntities(count, mesh.get());
+
+                 const FMatrix view = FMatrix::LookAt(FVector(0.0f, 10.0f, 0.0f), FVector(50.0f, 0.0f, 50.0f), FVector(0.0f, 1.0f, 0.0f));
+                 const FMatrix proj = FMatrix::VulkanPerspective(CEMath::DEG_TO_RAD * 60.0f, 16.0f / 9.0f, 0.1f, 500.0f);
+                 auto frustum = std::make_shared<FFrustum>(proj * view);
+                 auto renderData = std::make_shared<FrameRenderData>();
+
+                 FBenchCase benchCase;
+                 benchCase.Items = count;
+                 benchCase.Run = [entities, mesh, frustum, renderData](uint64_t iterations)
+                 {
+                   for (uint64_t it = 0; it < iterations; ++it)
+                   {
+                     renderData->Clear();
+                     EntitySystems::CollectRenderObjects(*entities, frustum.get(), *renderData);
+                     DoNotOptimize(renderData->renderObjects.size());
+                   }
+                 };
+                 return benchCase;
+               });
+  }
+}
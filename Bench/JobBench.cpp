@@ -0,0 +1,125 @@
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Benchmark.h"
+#include "Engine/Core/Jobs/JobSystem.h"
+#include "Engine/GamePlay/Actors/Actor.h"
+#include "Engine/GamePlay/World/Levels/Level.h"
+#include "Engine/GamePlay/World/TransformStore.h"
+
+namespace
+{
+  // Итераций интегратора на тик: порядок работы простого геймплейного актора
+  constexpr uint32_t TICK_WORK_STEPS = 64;
+
+  // Актор, который двигает только себя: его можно тикать параллельно
+  class CBenchSwarmActor : public CActor
+  {
+   public:
+    CBenchSwarmActor(CObject* Owner, FString NewName, uint32_t Seed)
+        : CActor(Owner, NewName)
+    {
+      auto* root = AddSubObject<CSceneComponent>("Root", this, "Root");
+      // Корню тикать нечего: в расписании остаются только параллельные акторы
+      root->GetPrimaryTick().SetCanEverTick(false);
+      SetRootComponent(root);
+      SetTickInParallel(true);
+      m_Phase = static_cast<float>(Seed % 360) * CEMath::DEG_TO_RAD;
+    }
+
+    virtual void Tick(float DeltaTime) override
+    {
+      CActor::Tick(DeltaTime);
+
+      FVector velocity = m_Velocity;
+      FVector position = GetActorLocation();
+      for (uint32_t step = 0; step < TICK_WORK_STEPS; ++step)
+      {
+        m_Phase += DeltaTime;
+        const FVector toCenter = FVector(std::cos(m_Phase), 0.0f, std::sin(m_Phase)) * 10.0f - position;
+        velocity = velocity * 0.98f + toCenter * (0.02f * DeltaTime);
+        position = position + velocity * (DeltaTime / TICK_WORK_STEPS);
+      }
+      m_Velocity = velocity;
+      SetActorLocation(position);
+    }
+
+   private:
+    FVector m_Velocity = FVector(0.0f);
+    float m_Phase = 0.0f;
+  };
+
+  std::vector<uint32_t> ThreadCounts()
+  {
+    const uint32_t hardwareThreads = std::max(1u, std::thread::hardware_concurrency());
+    std::vector<uint32_t> counts;
+    for (uint32_t threads = 1; threads < hardwareThreads; threads *= 2)
+    {
+      counts.push_back(threads);
+    }
+    counts.push_back(hardwareThreads);
+    return counts;
+  }
+}  // namespace
+
+void RegisterJobBenchmarks(CBenchRunner& runner)
+{
+  // Масштабирование тика уровня от 1 до N потоков; Items - акторов за тик
+  const uint32_t actorCount = runner.GetSettings().Quick ? 2000 : 20000;
+  for (uint32_t threads : ThreadCounts())
+  {
+    runner.Add("jobs", "parallel_actor_tick/threads_" + std::to_string(threads), [threads, actorCount]
+               {
+                 // Вызывающий поток тоже выполняет задачи, поэтому рабочих на один меньше
+                 CJobSystem::Get().Start(threads - 1);
+
+                 auto level = std::make_shared<CLevel>(nullptr, "JobBenchLevel");
+                 for (uint32_t i = 0; i < actorCount; ++i)
+                 {
+                   auto* actor = level->SpawnActor<CBenchSwarmActor>(level.get(), "Swarm_" + std::to_string(i), i);
+                   actor->SetActorLocation(FVector(static_cast<float>(i % 100), 0.0f, static_cast<float>(i / 100)));
+                 }
+                 CTransformStore::Get().UpdateWorldTransforms();
+                 CTransformStore::Get().ClearMovedHandles();
+
+                 FBenchCase benchCase;
+                 benchCase.Items = actorCount;
+                 benchCase.Run = [level](uint64_t iterations)
+                 {
+                   for (uint64_t it = 0; it < iterations; ++it)
+                   {
+                     level->Tick(1.0f / 60.0f);
+                     CTransformStore::Get().UpdateWorldTransforms();
+                     CTransformStore::Get().ClearMovedHandles();
+                   }
+                 };
+                 return benchCase;
+               });
+  }
+
+  // Накладные расходы планировщика: пустые куски, Items - задач за прогон
+  for (uint32_t threads : ThreadCounts())
+  {
+    runner.Add("jobs", "parallel_for_overhead/threads_" + std::to_string(threads), [threads]
+               {
+                 CJobSystem::Get().Start(threads - 1);
+
+                 constexpr uint32_t JOB_COUNT = 256;
+                 FBenchCase benchCase;
+                 benchCase.Items = JOB_COUNT;
+                 benchCase.Run = [](uint64_t iterations)
+                 {
+                   for (uint64_t it = 0; it < iterations; ++it)
+                   {
+                     CJobSystem::Get().ParallelFor(JOB_COUNT, 1, [](uint32_t Begin, uint32_t End)
+                                                   { DoNotOptimize(Begin + End); });
+                   }
+                 };
+                 return benchCase;
+               });
+  }
+}
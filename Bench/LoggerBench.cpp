@@ -0,0 +1,59 @@
+#include "Benchmark.h"
+#include "CoreMinimal.h"
+
+namespace
+{
+  // Логгер включается только на время бенчмарка: консоль отключена,
+  // чтобы не смешивать сообщения с JSON отчетом в stdout
+  struct FLoggerScope
+  {
+    explicit FLoggerScope(CE::ELogLevel level, bool fileOutput)
+    {
+      CE::CLogger::SetConsoleOutput(false);
+      CE::CLogger::SetFileOutput(fileOutput);
+      CE::CLogger::Initialize(false, true);
+      CE::CLogger::SetGlobalLogLevel(level);
+    }
+    ~FLoggerScope()
+    {
+      CE::CLogger::Shutdown();
+      CE::CLogger::SetConsoleOutput(true);
+      CE::CLogger::SetFileOutput(true);
+    }
+  };
+}  // namespace
+
+void RegisterLoggerBenchmarks(CBenchRunner& runner)
+{
+  // Сообщение ниже уровня категории: стоимость проверки и форматирования
+  runner.Add("logger", "filtered", []
+             {
+               auto scope = std::make_shared<FLoggerScope>(CE::ELogLevel::Warning, false);
+
+               FBenchCase benchCase;
+               benchCase.Run = [scope](uint64_t iterations)
+               {
+                 for (uint64_t it = 0; it < iterations; ++it)
+                 {
+                   CORE_DEBUG("Filtered message ", 42);
+                 }
+               };
+               return benchCase;
+             });
+
+  // Полный путь: форматирование, метка времени и запись в файл
+  runner.Add("logger", "file", []
+             {
+               auto scope = std::make_shared<FLoggerScope>(CE::ELogLevel::Log, true);
+
+               FBenchCase benchCase;
+               benchCase.Run = [scope](uint64_t iterations)
+               {
+                 for (uint64_t it = 0; it < iterations; ++it)
+                 {
+                   CORE_LOG("Benchmark message ", 42);
+                 }
+               };
+               return benchCase;
+             });
+}
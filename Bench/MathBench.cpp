@@ -0,0 +1,196 @@
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "Benchmark.h"
+#include "Engine/Core/CoreTypes.h"
+
+namespace
+{
+  constexpr size_t MATRIX_COUNT = 256;
+  constexpr size_t POINT_COUNT = 4096;
+
+  // Детерминированные входные данные: одинаковые от прогона к прогону
+  std::vector<FMatrix> MakeMatrices(size_t count)
+  {
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<float> angle(-3.0f, 3.0f);
+    std::uniform_real_distribution<float> offset(-100.0f, 100.0f);
+
+    std::vector<FMatrix> matrices(count);
+    for (auto& matrix : matrices)
+    {
+      FQuat rotation = FQuat::FromEuler(angle(rng), angle(rng), angle(rng));
+      matrix = FMatrix::Translate(FVector(offset(rng), offset(rng), offset(rng))) *
+               rotation.ToMatrix() *
+               FMatrix::Scale(FVector(1.5f, 0.5f, 2.0f));
+    }
+    return matrices;
+  }
+
+  std::vector<FQuat> MakeQuats(size_t count)
+  {
+    std::mt19937 rng(7);
+    std::uniform_real_distribution<float> angle(-3.0f, 3.0f);
+
+    std::vector<FQuat> quats(count);
+    for (auto& quat : quats)
+    {
+      quat = FQuat::FromEuler(angle(rng), angle(rng), angle(rng));
+    }
+    return quats;
+  }
+}  // namespace
+
+void RegisterMathBenchmarks(CBenchRunner& runner)
+{
+  runner.Add("math", "matrix_multiply", []
+             {
+               auto lhs = std::make_shared<std::vector<FMatrix>>(MakeMatrices(MATRIX_COUNT));
+               auto rhs = std::make_shared<std::vector<FMatrix>>(MakeMatrices(MATRIX_COUNT));
+               std::reverse(rhs->begin(), rhs->end());
+
+               FBenchCase benchCase;
+               benchCase.Items = MATRIX_COUNT;
+               benchCase.Run = [lhs, rhs](uint64_t iterations)
+               {
+                 for (uint64_t it = 0; it < iterations; ++it)
+                 {
+                   for (size_t i = 0; i < MATRIX_COUNT; ++i)
+                   {
+                     FMatrix result = (*lhs)[i] * (*rhs)[i];
+                     DoNotOptimize(result);
+                   }
+                 }
+               };
+               return benchCase;
+             });
+
+  runner.Add("math", "matrix_multiply_batch", []
+             {
+               auto lhs = std::make_shared<std::vector<FMatrix>>(MakeMatrices(MATRIX_COUNT));
+               auto rhs = std::make_shared<std::vector<FMatrix>>(MakeMatrices(MATRIX_COUNT));
+               auto out = std::make_shared<std::vector<FMatrix>>(MATRIX_COUNT);
+
+               FBenchCase benchCase;
+               benchCase.Items = MATRIX_COUNT;
+               benchCase.Run = [lhs, rhs, out](uint64_t iterations)
+               {
+                 for (uint64_t it = 0; it < iterations; ++it)
+                 {
+                   FMatrix::MultiplyBatch(lhs->data(), rhs->data(), out->data(), MATRIX_COUNT);
+                   DoNotOptimize(out->front());
+                 }
+               };
+               return benchCase;
+             });
+
+  runner.Add("math", "matrix_inverse", []
+             {
+               auto matrices = std::make_shared<std::vector<FMatrix>>(MakeMatrices(MATRIX_COUNT));
+
+               FBenchCase benchCase;
+               benchCase.Items = MATRIX_COUNT;
+               benchCase.Run = [matrices](uint64_t iterations)
+               {
+                 for (uint64_t it = 0; it < iterations; ++it)
+                 {
+                   for (const auto& matrix : *matrices)
+                   {
+                     FMatrix result = matrix.Inversed();
+                     DoNotOptimize(result);
+                   }
+                 }
+               };
+               return benchCase;
+             });
+
+  runner.Add("math", "transform_points", []
+             {
+               auto matrix = std::make_shared<FMatrix>(MakeMatrices(1).front());
+               auto points = std::make_shared<std::vector<FVector>>(POINT_COUNT);
+               auto out = std::make_shared<std::vector<FVector>>(POINT_COUNT);
+               for (size_t i = 0; i < POINT_COUNT; ++i)
+               {
+                 (*points)[i] = FVector(static_cast<float>(i), static_cast<float>(i % 17), -static_cast<float>(i % 5));
+               }
+
+               FBenchCase benchCase;
+               benchCase.Items = POINT_COUNT;
+               benchCase.Run = [matrix, points, out](uint64_t iterations)
+               {
+                 for (uint64_t it = 0; it < iterations; ++it)
+                 {
+                   FMatrix::TransformPoints(*matrix, points->data(), out->data(), POINT_COUNT);
+                   DoNotOptimize(out->back());
+                 }
+               };
+               return benchCase;
+             });
+
+  runner.Add("math", "frustum_cull_boxes", []
+             {
+               const FMatrix view = FMatrix::LookAt(FVector(0.0f, 10.0f, 0.0f), FVector(50.0f, 0.0f, 50.0f), FVector(0.0f, 1.0f, 0.0f));
+               const FMatrix proj = FMatrix::VulkanPerspective(CEMath::DEG_TO_RAD * 60.0f, 16.0f / 9.0f, 0.1f, 500.0f);
+               auto frustum = std::make_shared<FFrustum>(proj * view);
+               auto matrices = std::make_shared<std::vector<FMatrix>>(MakeMatrices(MATRIX_COUNT));
+               const FBox localBox(FVector(-1.0f), FVector(1.0f));
+
+               FBenchCase benchCase;
+               benchCase.Items = MATRIX_COUNT;
+               benchCase.Run = [frustum, matrices, localBox](uint64_t iterations)
+               {
+                 for (uint64_t it = 0; it < iterations; ++it)
+                 {
+                   uint32_t visible = 0;
+                   for (const auto& matrix : *matrices)
+                   {
+                     visible += frustum->IntersectsBox(localBox.TransformedBy(matrix)) ? 1 : 0;
+                   }
+                   DoNotOptimize(visible);
+                 }
+               };
+               return benchCase;
+             });
+
+  runner.Add("math", "quat_slerp", []
+             {
+               auto quats = std::make_shared<std::vector<FQuat>>(MakeQuats(MATRIX_COUNT + 1));
+
+               FBenchCase benchCase;
+               benchCase.Items = MATRIX_COUNT;
+               benchCase.Run = [quats](uint64_t iterations)
+               {
+                 for (uint64_t it = 0; it < iterations; ++it)
+                 {
+                   for (size_t i = 0; i < MATRIX_COUNT; ++i)
+                   {
+                     FQuat result = FQuat::Slerp((*quats)[i], (*quats)[i + 1], 0.37f);
+                     DoNotOptimize(result);
+                   }
+                 }
+               };
+               return benchCase;
+             });
+
+  runner.Add("math", "quat_to_matrix", []
+             {
+               auto quats = std::make_shared<std::vector<FQuat>>(MakeQuats(MATRIX_COUNT));
+
+               FBenchCase benchCase;
+               benchCase.Items = MATRIX_COUNT;
+               benchCase.Run = [quats](uint64_t iterations)
+               {
+                 for (uint64_t it = 0; it < iterations; ++it)
+                 {
+                   for (const auto& quat : *quats)
+                   {
+                     FMatrix result = quat.ToMatrix();
+                     DoNotOptimize(result);
+                   }
+                 }
+               };
+               return benchCase;
+             });
+}
@@ -0,0 +1,49 @@
+#include <memory>
+
+#include "Benchmark.h"
+#include "CoreMinimal.h"
+
+namespace
+{
+  // Событий между EndFrame: кольцо потока не переполняется
+  constexpr uint64_t SCOPES_PER_FRAME = 1024;
+
+  struct FProfilerScope
+  {
+    explicit FProfilerScope(bool bEnabled)
+    {
+      CProfiler::Get().SetEnabled(bEnabled);
+    }
+    ~FProfilerScope()
+    {
+      CProfiler::Get().EndFrame();
+      CProfiler::Get().SetEnabled(false);
+    }
+  };
+}  // namespace
+
+void RegisterProfilerBenchmarks(CBenchRunner& runner)
+{
+  // Стоимость маркера: выключенный - проверка флага, включенный - два чтения часов и запись в кольцо
+  for (bool enabled : {false, true})
+  {
+    runner.Add("profiler", enabled ? "scope_enabled" : "scope_disabled", [enabled]
+               {
+                 auto scope = std::make_shared<FProfilerScope>(enabled);
+
+                 FBenchCase benchCase;
+                 benchCase.Run = [scope](uint64_t iterations)
+                 {
+                   for (uint64_t it = 0; it < iterations; ++it)
+                   {
+                     CE_PROFILE_SCOPE("BenchScope");
+                     if ((it + 1) % SCOPES_PER_FRAME == 0)
+                     {
+                       CProfiler::Get().EndFrame();
+                     }
+                   }
+                 };
+                 return benchCase;
+               });
+  }
+}
@@ -0,0 +1,94 @@
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Benchmark.h"
+#include "Engine/Core/Rendering/Data/RenderFrameQueue.h"
+
+namespace
+{
+  constexpr uint32_t OBJECT_COUNT = 10000;
+
+  // Работа игрового потока: заполнить снимок, как CollectRenderData
+  void FillFrame(FrameRenderData& data, uint64_t frame)
+  {
+    const float offset = static_cast<float>(frame % 100) * 0.01f;
+    for (uint32_t i = 0; i < OBJECT_COUNT; ++i)
+    {
+      RenderObject object{};
+      object.meshId = 1 + i % 16;
+      object.transform = FMatrix::Translate(FVector(static_cast<float>(i % 100), offset, static_cast<float>(i / 100)));
+      object.color = FVector(1.0f);
+      data.AddRenderObject(object);
+    }
+  }
+
+  // Работа рендер потока: упаковка instance данных, как PrepareInstances
+  void ConsumeFrame(const FrameRenderData& data, std::vector<FInstanceData>& instances)
+  {
+    instances.resize(data.renderObjects.size());
+    for (size_t i = 0; i < data.renderObjects.size(); ++i)
+    {
+      instances[i] = FrameRenderData::GetInstanceData(data.renderObjects[i]);
+    }
+    DoNotOptimize(instances.data());
+  }
+}  // namespace
+
+void RegisterRenderThreadBenchmarks(CBenchRunner& runner)
+{
+  // Items - объектов в кадре; один повтор - кадр. Оба потока в одном: сумма работ
+  runner.Add("render_thread", "serial/" + std::to_string(OBJECT_COUNT), []
+             {
+               auto data = std::make_shared<FrameRenderData>();
+               auto instances = std::make_shared<std::vector<FInstanceData>>();
+
+               FBenchCase benchCase;
+               benchCase.Items = OBJECT_COUNT;
+               benchCase.Run = [data, instances](uint64_t iterations)
+               {
+                 for (uint64_t it = 0; it < iterations; ++it)
+                 {
+                   data->Clear();
+                   FillFrame(*data, it);
+                   ConsumeFrame(*data, *instances);
+                 }
+               };
+               return benchCase;
+             });
+
+  // Рендер на своем потоке через CRenderFrameQueue: при двух свободных ядрах кадр стоит max, а не сумму работ
+  for (uint32_t slots : {CRenderFrameQueue::MIN_SLOTS, CRenderFrameQueue::MAX_SLOTS})
+  {
+    runner.Add("render_thread", "pipelined_" + std::to_string(slots) + "/" + std::to_string(OBJECT_COUNT), [slots]
+               {
+                 FBenchCase benchCase;
+                 benchCase.Items = OBJECT_COUNT;
+                 benchCase.Run = [slots](uint64_t iterations)
+                 {
+                   CRenderFrameQueue frames(slots);
+                   std::thread renderThread([&frames]
+                                            {
+                                              std::vector<FInstanceData> instances;
+                                              while (const FrameRenderData* data = frames.BeginRead())
+                                              {
+                                                ConsumeFrame(*data, instances);
+                                                frames.EndRead();
+                                              }
+                                            });
+
+                   for (uint64_t it = 0; it < iterations; ++it)
+                   {
+                     FrameRenderData* data = frames.BeginWrite();
+                     FillFrame(*data, it);
+                     frames.EndWrite();
+                   }
+                   frames.WaitIdle();
+                   frames.Close();
+                   renderThread.join();
+                 };
+                 return benchCase;
+               });
+  }
+}
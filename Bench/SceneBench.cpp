@@ -0,0 +1,221 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "Benchmark.h"
+#include "Engine/Core/Rendering/Data/RenderData.h"
+#include "Engine/GamePlay/Actors/Actor.h"
+#include "Engine/GamePlay/Components/CameraComponent.h"
+#include "Engine/GamePlay/Components/MeshComponent.h"
+#include "Engine/GamePlay/World/TransformStore.h"
+#include "Engine/GamePlay/World/World.h"
+
+namespace
+{
+  constexpr uint32_t HIERARCHY_DEPTH = 8;
+
+  std::vector<uint32_t> SceneSizes(const FBenchSettings& settings, std::vector<uint32_t> sizes)
+  {
+    if (settings.Quick)
+    {
+      sizes.resize(1);
+    }
+    return sizes;
+  }
+
+  // Цепочки глубиной HIERARCHY_DEPTH: двигаем только корни, пересчитываются все потомки
+  struct FHierarchyScene
+  {
+    std::vector<std::unique_ptr<CSceneComponent>> Components;
+    std::vector<CSceneComponent*> Roots;
+  };
+
+  std::shared_ptr<FHierarchyScene> BuildHierarchy(uint32_t count)
+  {
+    auto scene = std::make_shared<FHierarchyScene>();
+    scene->Components.reserve(count);
+
+    CSceneComponent* parent = nullptr;
+    for (uint32_t i = 0; i < count; ++i)
+    {
+      auto component = std::make_unique<CSceneComponent>(nullptr, "Node_" + std::to_string(i));
+      component->SetRelativePosition(1.0f, 0.5f, 0.0f);
+      component->SetRelativeRotation(0.0f, 5.0f, 0.0f);
+
+      if (i % HIERARCHY_DEPTH == 0)
+      {
+        scene->Roots.push_back(component.get());
+      }
+      else
+      {
+        component->AttachToComponent(parent);
+      }
+      parent = component.get();
+      scene->Components.push_back(std::move(component));
+    }
+
+    CTransformStore::Get().UpdateWorldTransforms();
+    return scene;
+  }
+
+  // Синтетический уровень: камера и count акторов с CMeshComponent в корне
+  struct FSyntheticWorld
+  {
+    std::unique_ptr<CWorld> World;
+    FrameRenderData RenderData;
+  };
+
+  std::shared_ptr<FSyntheticWorld> BuildWorld(uint32_t count)
+  {
+    auto scene = std::make_shared<FSyntheticWorld>();
+    scene->World = std::make_unique<CWorld>(nullptr, "BenchWorld");
+
+    auto level = std::make_unique<CLevel>(nullptr, "BenchLevel");
+
+    auto* cameraActor = level->SpawnActor<CActor>(level.get(), "Camera");
+    cameraActor->SetRootComponent(cameraActor->AddSubObject<CCameraComponent>("Camera", cameraActor, "Camera"));
+    cameraActor->SetActorLocation(FVector(0.0f, 10.0f, 50.0f));
+
+    const uint32_t side = 100;
+    for (uint32_t i = 0; i < count; ++i)
+    {
+      auto* actor = level->SpawnActor<CActor>(level.get(), "Actor_" + std::to_string(i));
+      auto* mesh = actor->AddSubObject<CMeshComponent>("Mesh", actor, "Mesh");
+      // Куб из реестра общий для всех, нужен ради границ в пространственном индексе
+      mesh->CreateCubeMesh();
+      actor->SetRootComponent(mesh);
+      actor->SetActorLocation(FVector(static_cast<float>(i % side) * 2.0f,
+                                      0.0f,
+                                      -static_cast<float>(i / side) * 2.0f));
+    }
+
+    scene->World->AddLevel(std::move(level));
+    scene->World->BeginPlay();
+    scene->RenderData.renderObjects.reserve(count);
+
+    CTransformStore::Get().UpdateWorldTransforms();
+    scene->World->GetCurrentLevel()->SyncSpatialIndex();
+    CTransformStore::Get().ClearMovedHandles();
+    return scene;
+  }
+}  // namespace
+
+void RegisterSceneBenchmarks(CBenchRunner& runner)
+{
+  for (uint32_t count : SceneSizes(runner.GetSettings(), {1000, 10000, 100000}))
+  {
+    runner.Add("scene", "hierarchy_update/" + std::to_string(count), [count]
+               {
+                 auto scene = BuildHierarchy(count);
+
+                 FBenchCase benchCase;
+                 benchCase.Items = count;
+                 benchCase.Run = [scene](uint64_t iterations)
+                 {
+                   for (uint64_t it = 0; it < iterations; ++it)
+                   {
+                     const float offset = static_cast<float>(it & 7);
+                     for (auto* root : scene->Roots)
+                     {
+                       root->SetRelativePosition(offset, 0.0f, 0.0f);
+                     }
+                     CTransformStore::Get().UpdateWorldTransforms();
+                   }
+                 };
+                 return benchCase;
+               });
+  }
+
+  for (uint32_t count : SceneSizes(runner.GetSettings(), {1000, 10000, 100000}))
+  {
+    runner.Add("scene", "collect_render_data/" + std::to_string(count), [count]
+               {
+                 auto scene = BuildWorld(count);
+
+                 FBenchCase benchCase;
+                 benchCase.Items = count;
+                 benchCase.Run = [scene](uint64_t iterations)
+                 {
+                   for (uint64_t it = 0; it < iterations; ++it)
+                   {
+                     scene->RenderData.Clear();
+                     scene->World->CollectRenderData(scene->RenderData);
+                     DoNotOptimize(scene->RenderData.renderObjects.data());
+                   }
+                 };
+                 return benchCase;
+               });
+  }
+
+  // Покадровые запросы компонентов: активная камера и обход всех мешей уровня
+  for (uint32_t count : SceneSizes(runner.GetSettings(), {1000, 10000, 100000}))
+  {
+    runner.Add("scene", "component_query/" + std::to_string(count), [count]
+               {
+                 auto scene = BuildWorld(count);
+
+                 FBenchCase benchCase;
+                 benchCase.Items = count;
+                 benchCase.Run = [scene](uint64_t iterations)
+                 {
+                   for (uint64_t it = 0; it < iterations; ++it)
+                   {
+                     DoNotOptimize(scene->World->FindActiveCamera());
+                     uint32_t meshCount = 0;
+                     for (auto* mesh : scene->World->GetAllComponents<CMeshComponent>())
+                     {
+                       meshCount += mesh->GetMeshAssetId() != INVALID_MESH_ASSET_ID;
+                     }
+                     DoNotOptimize(meshCount);
+                   }
+                 };
+                 return benchCase;
+               });
+  }
+
+  for (uint32_t count : SceneSizes(runner.GetSettings(), {1000, 10000, 100000}))
+  {
+    // Все акторы сдвигаются на доли единицы: большинство остается в толстых боксах дерева
+    runner.Add("scene", "spatial_index_sync/" + std::to_string(count), [count]
+               {
+                 auto scene = BuildWorld(count);
+
+                 FBenchCase benchCase;
+                 benchCase.Items = count;
+                 benchCase.Run = [scene](uint64_t iterations)
+                 {
+                   CLevel* level = scene->World->GetCurrentLevel();
+                   for (uint64_t it = 0; it < iterations; ++it)
+                   {
+                     const FVector offset(0.0f, (it & 1) ? 0.1f : -0.1f, 0.0f);
+                     for (const auto& actor : level->GetActors())
+                     {
+                       actor->SetActorLocation(actor->GetActorLocation() + offset);
+                     }
+                     CTransformStore::Get().UpdateWorldTransforms();
+                     level->SyncSpatialIndex();
+                     CTransformStore::Get().ClearMovedHandles();
+                   }
+                 };
+                 return benchCase;
+               });
+
+    runner.Add("scene", "spatial_raycast/" + std::to_string(count), [count]
+               {
+                 auto scene = BuildWorld(count);
+
+                 FBenchCase benchCase;
+                 benchCase.Items = 1;
+                 benchCase.Run = [scene](uint64_t iterations)
+                 {
+                   const CLevel* level = scene->World->GetCurrentLevel();
+                   for (uint64_t it = 0; it < iterations; ++it)
+                   {
+                     const float x = static_cast<float>(it % 100) * 2.0f;
+                     DoNotOptimize(level->RayCast(FVector(x, 20.0f, 0.0f), FVector(0.0f, -1.0f, -0.5f).Normalized(), 500.0f));
+                   }
+                 };
+                 return benchCase;
+               });
+  }
+}
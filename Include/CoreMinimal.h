@@ -61,4 +61,5 @@ class CComponent;
 class CWorld;
 #include "Engine/Core/AppInfo.h"
 #include "Engine/Utils/Logger.h"
+#include "Engine/Core/Profiling/Profiler.h"
 #include "Engine/Core/CoreTypes.h"
@@ -3,6 +3,7 @@
 #include "Engine/Core/AppInfo.h"
 #include "Engine/Core/Rendering/Data/RenderData.h"
 #include "Engine/Core/Rendering/Vulkan/Integration/RenderSystem.h"
+#include "Engine/Core/Rendering/Vulkan/Integration/RenderThread.h"
 #include "Engine/GamePlay/GameInstance/GameInstance.h"
 
 class Application
@@ -33,7 +34,8 @@ class Application
 
     std::unique_ptr<CGameInstance> m_GameInstance;
     std::unique_ptr<RenderSystem> m_RenderSystem;
-    FrameRenderData m_RenderData;
+    // Снимки кадров для рендера; рисует на своем потоке или сразу, если поток выключен
+    std::unique_ptr<RenderThread> m_RenderThread;
     // Application Info
     AppInfo* m_info = nullptr;
     // Время и FPS
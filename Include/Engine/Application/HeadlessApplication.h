@@ -0,0 +1,76 @@
+#pragma once
+#include <string>
+#include <vector>
+
+#include "CoreMinimal.h"
+#include "Engine/Core/Rendering/Data/RenderData.h"
+#include "Engine/GamePlay/GameInstance/GameInstance.h"
+
+// Настройки headless прогона (без RenderSystem и SDL окна)
+struct FHeadlessSettings
+{
+  uint32_t Frames = 600;         // 0 = ограничено только Duration
+  float FixedDeltaTime = 1.0f / 60.0f;
+  float Duration = 0.0f;         // бюджет по wall-clock в секундах, 0 = без ограничения
+  std::string OutputPath;        // пусто = stdout
+
+  static FHeadlessSettings FromCommandLine();
+};
+
+// Время одной фазы за все кадры (в миллисекундах)
+struct FPhaseTimings
+{
+  std::vector<double> Samples;
+
+  void Reserve(size_t count)
+  {
+    Samples.reserve(count);
+  }
+  void Add(double ms)
+  {
+    Samples.push_back(ms);
+  }
+  double Total() const;
+  double Percentile(double p) const;
+};
+
+class HeadlessApplication
+{
+ public:
+  HeadlessApplication(const FHeadlessSettings& settings);
+  virtual ~HeadlessApplication();
+
+  void SetGameInstance(std::unique_ptr<CGameInstance> gameInstance)
+  {
+    m_GameInstance = std::move(gameInstance);
+  }
+
+  virtual void Initialize();
+  virtual void Run();
+  virtual void Shutdown();
+
+  bool WriteReport() const;
+
+  CGameInstance* GetGameInstance() const
+  {
+    return m_GameInstance.get();
+  }
+
+ protected:
+  void StepFrame();
+  std::string BuildReport() const;
+
+  FHeadlessSettings m_Settings;
+  std::unique_ptr<CGameInstance> m_GameInstance;
+  FrameRenderData m_RenderData;
+
+  uint32_t m_FrameCount = 0;
+  double m_WallTime = 0.0;
+  size_t m_LastRenderObjectCount = 0;
+  size_t m_LastCulledObjectCount = 0;
+
+  FPhaseTimings m_InputTimings;
+  FPhaseTimings m_TickTimings;
+  FPhaseTimings m_CollectTimings;
+  FPhaseTimings m_FrameTimings;
+};
@@ -18,6 +18,9 @@ struct AppInfo
   
   int MSAA = 4;
   int MaxFPS = 120;
+  bool Bindless = true;  // использовать descriptor indexing, если устройство его поддерживает
+  bool UseRenderThread = true;  // рисовать кадры на отдельном потоке, параллельно с тиком
+  int RenderFrameBuffers = 2;   // снимков FrameRenderData между потоками: 2 или 3
 
   void LoadFromConfig();
 };
@@ -5,6 +5,8 @@
 #include "Math/Vector4D.hpp"
 #include "Math/Matrix4x4.hpp"
 #include "Math/Quaternion.hpp"
+#include "Math/Bounds.hpp"
+#include "Math/Frustum.hpp"
 
 #include "Engine/Utils/Math/Color.h"
 #include <cfloat>
@@ -16,6 +18,9 @@ using FVector4 = CEMath::Vector4D;
 using FMatrix = CEMath::Matrix4x4;
 using FQuat = CEMath::Quaternion;
 using FLinearColor = CEMath::Color;
+using FBox = CEMath::BoundingBox;
+using FSphere = CEMath::BoundingSphere;
+using FFrustum = CEMath::Frustum;
 
 // Additional UI-specific types
 using FString = std::string;
@@ -0,0 +1,150 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+/**
+ * @brief Счетчик незавершенных задач
+ *
+ * Dispatch увеличивает счетчик, завершение задачи уменьшает. Зависимость между задачами
+ * выражается ожиданием счетчика (CJobSystem::Wait): ожидающий поток не спит, а сам
+ * выполняет задачи из очередей, поэтому Wait можно вызывать и изнутри задачи.
+ */
+struct FJobCounter
+{
+  std::atomic<uint32_t> Pending{0};
+
+  bool IsDone() const
+  {
+    return Pending.load(std::memory_order_acquire) == 0;
+  }
+};
+
+/**
+ * @brief Задача: функция над диапазоном [Begin, End) без владения контекстом
+ *
+ * Контекст должен жить до завершения задачи (обычно до Wait по ее счетчику).
+ */
+struct FJob
+{
+  void (*Function)(void* Context, uint32_t Begin, uint32_t End) = nullptr;
+  void* Context = nullptr;
+  uint32_t Begin = 0;
+  uint32_t End = 0;
+  FJobCounter* Counter = nullptr;
+};
+
+/**
+ * @class CJobSystem
+ * @brief Планировщик задач с очередью на каждый поток и кражей работы
+ *
+ * Поток кладет задачи в свою очередь и забирает их с конца (LIFO, данные еще в кеше),
+ * простаивающие потоки крадут с начала чужих очередей. Потоки вне пула (игровой поток)
+ * делят общую очередь 0. Файберов нет: ожидание - это выполнение чужих задач.
+ */
+class CJobSystem
+{
+ public:
+  static CJobSystem& Get();
+
+  ~CJobSystem();
+
+  /**
+   * @brief Перезапускает пул с заданным числом рабочих потоков
+   * @param WorkerCount 0 - задачи выполняет только ожидающий поток
+   */
+  void Start(uint32_t WorkerCount);
+  void Stop();
+
+  // hardware_concurrency() - 1: вызывающий поток тоже работает, пока ждет
+  static uint32_t GetDefaultWorkerCount();
+
+  uint32_t GetWorkerCount() const
+  {
+    return static_cast<uint32_t>(m_Workers.size());
+  }
+  // Сколько потоков выполняют задачи одновременно: рабочие и ожидающий
+  uint32_t GetConcurrency() const
+  {
+    return GetWorkerCount() + 1;
+  }
+
+  void Dispatch(const FJob& Job);
+  void Wait(FJobCounter& Counter);
+
+  /**
+   * @brief Делит [0, Count) на куски по ChunkSize и выполняет Body(Begin, End) параллельно
+   *
+   * Первый кусок выполняет вызывающий поток, возврат - после завершения всех кусков.
+   */
+  template <typename Fn>
+  void ParallelFor(uint32_t Count, uint32_t ChunkSize, Fn&& Body);
+
+ private:
+  CJobSystem();
+
+  // Очередь на своей кеш-линии: мьютексы соседних потоков не делят строку
+  struct alignas(64) FWorkerQueue
+  {
+    std::mutex Mutex;
+    std::deque<FJob> Jobs;
+  };
+
+  void WorkerLoop(uint32_t QueueIndex);
+  bool TryPop(uint32_t QueueIndex, FJob& OutJob);
+  bool TrySteal(uint32_t ThiefIndex, FJob& OutJob);
+  void Execute(const FJob& Job);
+  uint32_t GetCurrentQueueIndex() const;
+
+  // [0] - общая очередь внешних потоков, [i + 1] - очередь рабочего i
+  std::vector<std::unique_ptr<FWorkerQueue>> m_Queues;
+  std::vector<std::thread> m_Workers;
+
+  std::atomic<uint32_t> m_QueuedJobs{0};
+  std::atomic<uint32_t> m_SleepingWorkers{0};
+  std::mutex m_SleepMutex;
+  std::condition_variable m_WakeUp;
+  bool m_Stopping = false;
+};
+
+template <typename Fn>
+void CJobSystem::ParallelFor(uint32_t Count, uint32_t ChunkSize, Fn&& Body)
+{
+  if (Count == 0)
+    return;
+
+  ChunkSize = std::max(ChunkSize, 1u);
+  if (Count <= ChunkSize || m_Workers.empty())
+  {
+    Body(0u, Count);
+    return;
+  }
+
+  using FBody = std::remove_reference_t<Fn>;
+  FJobCounter counter;
+  FJob job;
+  job.Function = [](void* Context, uint32_t Begin, uint32_t End)
+  {
+    (*static_cast<FBody*>(Context))(Begin, End);
+  };
+  job.Context = const_cast<void*>(static_cast<const void*>(std::addressof(Body)));
+  job.Counter = &counter;
+
+  for (uint32_t begin = ChunkSize; begin < Count; begin += ChunkSize)
+  {
+    job.Begin = begin;
+    job.End = std::min(begin + ChunkSize, Count);
+    Dispatch(job);
+  }
+
+  Body(0u, ChunkSize);
+  Wait(counter);
+}
@@ -5,15 +5,82 @@
 #include <memory>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 #include "CoreMinimal.h"
 #include "Engine/Core/Reflection.h"
 
 class CComponent;
 
+// Компоненты одного типа подряд в памяти, без копирования списка.
+// Действителен до следующего добавления или удаления компонента у владельца списка
+template <typename T>
+class TComponentView
+{
+ public:
+  class FIterator
+  {
+   public:
+    explicit FIterator(CComponent* const* Current)
+        : m_Current(Current)
+    {
+    }
+
+    T* operator*() const
+    {
+      // Список хранит только компоненты типа T и наследников, проверка не нужна
+      return static_cast<T*>(*m_Current);
+    }
+    FIterator& operator++()
+    {
+      ++m_Current;
+      return *this;
+    }
+    bool operator!=(const FIterator& Other) const
+    {
+      return m_Current != Other.m_Current;
+    }
+
+   private:
+    CComponent* const* m_Current = nullptr;
+  };
+
+  TComponentView() = default;
+  explicit TComponentView(const std::vector<CComponent*>* Components)
+      : m_Components(Components)
+  {
+  }
+
+  FIterator begin() const
+  {
+    return FIterator(m_Components ? m_Components->data() : nullptr);
+  }
+  FIterator end() const
+  {
+    return FIterator(m_Components ? m_Components->data() + m_Components->size() : nullptr);
+  }
+  size_t size() const
+  {
+    return m_Components ? m_Components->size() : 0;
+  }
+  bool empty() const
+  {
+    return size() == 0;
+  }
+  T* operator[](size_t Index) const
+  {
+    return static_cast<T*>((*m_Components)[Index]);
+  }
+
+ private:
+  const std::vector<CComponent*>* m_Components = nullptr;
+};
+
 class CObject
   {
    public:
+    using ThisClass = CObject;
+
     CObject(CObject* Owner = nullptr, FString NewName = "Object");
     virtual ~CObject();
 
@@ -37,50 +104,64 @@ class CObject
       return m_Name;
     }
 
-    virtual const ClassInfo* GetClassInfo() const { return nullptr; }
+    // Корень иерархии типов; наследники объявляют свой через CE_DECLARE_CLASS
+    static const ClassInfo& StaticClass();
+    virtual const ClassInfo* GetClassInfo() const
+    {
+      return &StaticClass();
+    }
 
     template <typename T>
-    std::vector<T*> GetComponents() const
+    bool IsA() const
     {
-      std::vector<T*> result;
-      for (const auto& [name, component] : m_Components)
-      {
-        if (auto* casted = dynamic_cast<T*>(component.get()))
-        {
-          result.push_back(casted);
-        }
-      }
-      return result;
+      static_assert(TIsDeclaredClass<T>, "T must use CE_DECLARE_CLASS");
+      return GetClassInfo()->IsA(T::StaticClass());
     }
 
-    
+    // Компоненты типа T и его наследников в порядке добавления
     template <typename T>
-    void ForEachComponent(std::function<void(T*)> callback) const
+    TComponentView<T> GetComponents() const
     {
-      for (const auto& [name, component] : m_Components)
+      static_assert(TIsDeclaredClass<T>, "T must use CE_DECLARE_CLASS");
+      const uint32_t typeId = T::StaticClass().GetTypeId();
+      if (typeId < m_ComponentsByType.size())
       {
-        if (auto* casted = dynamic_cast<T*>(component.get()))
-        {
-          callback(casted);
-        }
+        return TComponentView<T>(&m_ComponentsByType[typeId]);
       }
+      return TComponentView<T>();
     }
 
-    
-    void ForEachComponent(std::function<void(CComponent*)> callback) const
+    // Первый добавленный компонент типа T или nullptr
+    template <typename T>
+    T* FindComponent() const
     {
-      for (const auto& [name, component] : m_Components)
+      TComponentView<T> components = GetComponents<T>();
+      return components.empty() ? nullptr : components[0];
+    }
+
+    template <typename T>
+    void ForEachComponent(std::function<void(T*)> callback) const
+    {
+      for (T* component : GetComponents<T>())
       {
-        callback(component.get());
+        callback(component);
       }
     }
 
-   
+    void ForEachComponent(std::function<void(CComponent*)> callback) const;
+
     template <typename T>
     T* GetComponent(const std::string& Name);
 
    protected:
+    // CComponent здесь неполный тип: GetClassInfo() вызывается в Object.cpp
+    static const ClassInfo* GetComponentClass(const CComponent* Component);
+    void AddComponentToTypeLists(CComponent* Component);
+    void RemoveComponentFromTypeLists(CComponent* Component);
+
     std::unordered_map<std::string, std::unique_ptr<CComponent>> m_Components;
+    // Индекс - ClassInfo::GetTypeId(); компонент лежит в списке своего типа и всех предков
+    std::vector<std::vector<CComponent*>> m_ComponentsByType;
     CObject* m_Owner = nullptr;
     FString m_Name{};
   };
@@ -88,19 +169,29 @@ class CObject
   template <typename T, typename... Args>
   T* CObject::AddSubObject(const std::string& Name, Args&&... args)
   {
+    static_assert(TIsDeclaredClass<T>, "T must use CE_DECLARE_CLASS");
+
     auto component = std::make_unique<T>(std::forward<Args>(args)...);
     T* ptr = component.get();
-    m_Components[Name] = std::move(component);
+    std::unique_ptr<CComponent>& slot = m_Components[Name];
+    if (slot)
+    {
+      RemoveComponentFromTypeLists(slot.get());
+    }
+    slot = std::move(component);
+    AddComponentToTypeLists(ptr);
     return ptr;
   }
 
   template <typename T>
   T* CObject::GetComponent(const std::string& Name)
   {
+    static_assert(TIsDeclaredClass<T>, "T must use CE_DECLARE_CLASS");
+
     auto it = m_Components.find(Name);
-    if (it != m_Components.end())
+    if (it != m_Components.end() && GetComponentClass(it->second.get())->IsA(T::StaticClass()))
     {
-      return dynamic_cast<T*>(it->second.get());
+      return static_cast<T*>(it->second.get());
     }
     return nullptr;
   }
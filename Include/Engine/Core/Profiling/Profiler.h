@@ -0,0 +1,212 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// Профилировщик включен в сборку; CMake задает через ENGINE_PROFILER.
+// При 0 CE_PROFILE_SCOPE раскрывается в пустой оператор
+#ifndef CE_ENABLE_PROFILER
+#define CE_ENABLE_PROFILER 1
+#endif
+
+// Закрытый интервал на одном потоке; Name - строковый литерал, живет до конца программы
+struct FProfileEvent
+{
+  const char* Name = nullptr;
+  uint64_t StartNs = 0;
+  uint64_t EndNs = 0;
+  uint32_t ThreadId = 0;
+  uint32_t Depth = 0;
+};
+
+// Усредненная статистика маркера за окно кадров
+struct FProfileStat
+{
+  const char* Name = nullptr;
+  uint32_t Depth = 0;
+  double AverageMs = 0.0;  // в среднем за кадр, включая вложенные маркеры
+  double MaxMs = 0.0;      // худший кадр окна
+  double CallsPerFrame = 0.0;
+};
+
+struct FProfileSummary
+{
+  uint32_t Frames = 0;
+  double AverageFrameMs = 0.0;
+  double MaxFrameMs = 0.0;
+  // По убыванию AverageMs
+  std::vector<FProfileStat> Stats;
+};
+
+/**
+ * @class CProfiler
+ * @brief Иерархический CPU профилировщик на маркерах CE_PROFILE_SCOPE
+ *
+ * Каждый поток пишет закрытые интервалы в свой кольцевой буфер без блокировок
+ * (один писатель - сам поток, один читатель - EndFrame). EndFrame на игровом потоке
+ * забирает события всех потоков, копит сводку по кадрам окна и, если идет захват,
+ * складывает события для экспорта в Chrome/Perfetto JSON (WriteChromeTrace).
+ * Выключенный профилировщик стоит одного чтения атомика на маркер.
+ */
+class CProfiler
+{
+ public:
+  static CProfiler& Get();
+
+  ~CProfiler();
+
+  static bool IsEnabled()
+  {
+    return s_Enabled.load(std::memory_order_relaxed);
+  }
+  void SetEnabled(bool bEnabled);
+
+  // Монотонное время в наносекундах от запуска профилировщика
+  static uint64_t Now();
+
+  // Имя потока в трейсе; вызывать на самом потоке, до или после первых маркеров.
+  // Если буфер потока уже создан, имя в нем заменяется
+  static void SetThreadName(const std::string& Name);
+
+  void Record(const char* Name, uint64_t StartNs, uint64_t EndNs, uint32_t Depth);
+
+  // Дорожка трейса, не привязанная к потоку (например, время GPU, уже переведенное в шкалу Now).
+  // Пишет в дорожку только один поток, как и в буфер потока
+  uint32_t CreateTrack(const std::string& Name);
+  void RecordOnTrack(uint32_t Track, const char* Name, uint64_t StartNs, uint64_t EndNs, uint32_t Depth);
+
+  // Граница кадра: вызывать на игровом потоке после всей работы кадра
+  void EndFrame();
+
+  // Кадров в окне сводки; сводка публикуется в конце каждого окна
+  void SetSummaryWindow(uint32_t Frames);
+  // Писать опубликованную сводку в лог (LogCore, Display)
+  void SetLogSummary(bool bEnabled);
+  FProfileSummary GetLastSummary() const;
+
+  // Захват событий для трейса; MaxEvents ограничивает память, лишние события теряются
+  void BeginCapture(size_t MaxEvents = DEFAULT_MAX_CAPTURED_EVENTS);
+  void EndCapture();
+  bool IsCapturing() const
+  {
+    return m_Capturing;
+  }
+  bool WriteChromeTrace(const std::string& Path) const;
+
+  static constexpr size_t DEFAULT_MAX_CAPTURED_EVENTS = 4 * 1024 * 1024;
+
+ private:
+  CProfiler();
+
+  // Кольцо одного потока: пишет только владелец, читает только EndFrame
+  struct FThreadBuffer
+  {
+    static constexpr uint32_t CAPACITY = 16 * 1024;
+
+    std::unique_ptr<FProfileEvent[]> Events{new FProfileEvent[CAPACITY]};
+    alignas(64) std::atomic<uint64_t> Write{0};
+    alignas(64) std::atomic<uint64_t> Read{0};
+    std::atomic<uint64_t> Dropped{0};
+    uint32_t ThreadId = 0;
+    std::string Name;
+  };
+
+  struct FScopeAccumulator
+  {
+    uint32_t Depth = UINT32_MAX;
+    double FrameMs = 0.0;
+    uint32_t FrameCalls = 0;
+    double TotalMs = 0.0;
+    double MaxMs = 0.0;
+    uint64_t TotalCalls = 0;
+  };
+
+  FThreadBuffer& GetThreadBuffer();
+  static void Push(FThreadBuffer& Buffer, const char* Name, uint64_t StartNs, uint64_t EndNs, uint32_t Depth);
+  void PublishSummary();
+
+  static std::atomic<bool> s_Enabled;
+
+  mutable std::mutex m_Mutex;
+  std::vector<std::unique_ptr<FThreadBuffer>> m_Buffers;
+
+  // Сводка (только игровой поток)
+  uint32_t m_SummaryWindow = 120;
+  bool m_LogSummary = false;
+  uint32_t m_WindowFrames = 0;
+  uint64_t m_LastFrameNs = 0;
+  double m_WindowFrameMs = 0.0;
+  double m_WindowMaxFrameMs = 0.0;
+  std::unordered_map<const char*, FScopeAccumulator> m_Scopes;
+  FProfileSummary m_LastSummary;
+
+  // Захват
+  bool m_Capturing = false;
+  size_t m_MaxCapturedEvents = 0;
+  uint64_t m_LostCapturedEvents = 0;
+  std::vector<FProfileEvent> m_Captured;
+};
+
+/**
+ * @brief Маркер на время жизни объекта
+ *
+ * Глубина вложенности считается на поток; при выключенном профилировщике
+ * конструктор и деструктор ограничиваются проверкой флага.
+ */
+class FProfileScope
+{
+ public:
+  explicit FProfileScope(const char* Name)
+  {
+    if (CProfiler::IsEnabled())
+    {
+      m_Name = Name;
+      m_Depth = t_Depth++;
+      m_Start = CProfiler::Now();
+    }
+  }
+
+  ~FProfileScope()
+  {
+    if (m_Name)
+    {
+      const uint64_t end = CProfiler::Now();
+      --t_Depth;
+      CProfiler::Get().Record(m_Name, m_Start, end, m_Depth);
+    }
+  }
+
+  FProfileScope(const FProfileScope&) = delete;
+  FProfileScope& operator=(const FProfileScope&) = delete;
+
+ private:
+  static inline thread_local uint32_t t_Depth = 0;
+
+  const char* m_Name = nullptr;
+  uint64_t m_Start = 0;
+  uint32_t m_Depth = 0;
+};
+
+#define CE_PROFILE_CONCAT_INNER(A, B) A##B
+#define CE_PROFILE_CONCAT(A, B) CE_PROFILE_CONCAT_INNER(A, B)
+
+#if CE_ENABLE_PROFILER
+#define CE_PROFILE_SCOPE(Name) FProfileScope CE_PROFILE_CONCAT(profileScope_, __LINE__)(Name)
+#define CE_PROFILE_END_FRAME() CProfiler::Get().EndFrame()
+#else
+#define CE_PROFILE_SCOPE(Name) \
+  do                           \
+  {                            \
+  } while (0)
+#define CE_PROFILE_END_FRAME() \
+  do                           \
+  {                            \
+  } while (0)
+#endif
+
+#define CE_PROFILE_FUNCTION() CE_PROFILE_SCOPE(__func__)
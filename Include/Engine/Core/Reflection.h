@@ -1,10 +1,13 @@
 #pragma once
 
+#include <atomic>
 #include <string>
+#include <type_traits>
 #include <unordered_map>
 #include <vector>
 #include <functional>
 #include <memory>
+#include <mutex>
 #include <typeinfo>
 #include <typeindex>
 
@@ -226,11 +229,41 @@
   {
    public:
     ClassInfo(const std::string& name, std::function<CObject*()> factory = nullptr)
-        : m_Name(name), m_Factory(factory)
+        : ClassInfo(name, nullptr, std::move(factory))
+    {
+    }
+
+    ClassInfo(const std::string& name, const ClassInfo* parent, std::function<CObject*()> factory = nullptr)
+        : m_Name(name),
+          m_Factory(factory),
+          m_Parent(parent),
+          m_TypeId(s_NextTypeId.fetch_add(1, std::memory_order_relaxed)),
+          m_Depth(parent ? parent->m_Depth + 1 : 0)
     {
     }
 
     const std::string& GetName() const { return m_Name; }
+
+    // Плотный номер типа: индекс в списках компонентов по типам
+    uint32_t GetTypeId() const { return m_TypeId; }
+    const ClassInfo* GetParent() const { return m_Parent; }
+    // Число предков до корня иерархии
+    uint32_t GetDepth() const { return m_Depth; }
+
+    bool IsA(const ClassInfo& other) const
+    {
+      if (other.m_Depth > m_Depth)
+        return false;
+
+      const ClassInfo* info = this;
+      for (uint32_t depth = m_Depth; depth > other.m_Depth; --depth)
+      {
+        info = info->m_Parent;
+      }
+      return info == &other;
+    }
+
+    static uint32_t GetTypeCount() { return s_NextTypeId.load(std::memory_order_relaxed); }
     CObject* CreateInstance() const { return m_Factory ? m_Factory() : nullptr; }
 
     void AddProperty(std::unique_ptr<Property> prop)
@@ -251,6 +284,11 @@
     std::function<CObject*()> m_Factory;
     std::vector<std::unique_ptr<Property>> m_Properties;
     std::vector<std::unique_ptr<Function>> m_Functions;
+    const ClassInfo* m_Parent = nullptr;
+    uint32_t m_TypeId = 0;
+    uint32_t m_Depth = 0;
+
+    inline static std::atomic<uint32_t> s_NextTypeId{0};
   };
 
   // Reflection registry
@@ -263,27 +301,74 @@
       return instance;
     }
 
-    void RegisterClass(std::unique_ptr<ClassInfo> classInfo)
+    // StaticClass() регистрирует класс при первом обращении, и это может быть любой поток.
+    // При совпадении имени в реестре остается первый класс; второй ClassInfo живет дальше,
+    // чтобы указатель его типа не повис, но по имени не находится
+    ClassInfo* RegisterClass(std::unique_ptr<ClassInfo> classInfo)
     {
-      m_Classes[classInfo->GetName()] = std::move(classInfo);
+      std::lock_guard<std::mutex> lock(m_Mutex);
+      ClassInfo* result = classInfo.get();
+      auto [it, inserted] = m_Classes.try_emplace(classInfo->GetName());
+      if (inserted)
+      {
+        it->second = std::move(classInfo);
+      }
+      else
+      {
+        CORE_ERROR("Reflected class name registered twice: ", it->first, ", keeping the first registration");
+        m_Duplicates.push_back(std::move(classInfo));
+      }
+      return result;
     }
 
     const ClassInfo* GetClassInfo(const std::string& name) const
     {
+      std::lock_guard<std::mutex> lock(m_Mutex);
       auto it = m_Classes.find(name);
       return it != m_Classes.end() ? it->second.get() : nullptr;
     }
 
+    // Без блокировки: обходить, когда регистрация классов закончена
     const std::unordered_map<std::string, std::unique_ptr<ClassInfo>>& GetAllClasses() const
     {
       return m_Classes;
     }
 
    private:
+    mutable std::mutex m_Mutex;
     std::unordered_map<std::string, std::unique_ptr<ClassInfo>> m_Classes;
+    std::vector<std::unique_ptr<ClassInfo>> m_Duplicates;
   };
 
+  // ClassInfo класса, объявленного через CE_DECLARE_CLASS; хранится в реестре
+  inline const ClassInfo* RegisterStaticClass(const char* name, const ClassInfo* parent)
+  {
+    return ReflectionRegistry::Get().RegisterClass(std::make_unique<ClassInfo>(name, parent));
+  }
+
+  // true, если T объявил собственный ClassInfo, а не унаследовал родительский
+  template <typename T>
+  inline constexpr bool TIsDeclaredClass = std::is_same_v<typename T::ThisClass, T>;
+
   // Macros
+
+// В теле класса-наследника CObject: StaticClass() с номером типа и цепочкой предков,
+// по которым работают запросы компонентов (CObject::GetComponents<T>) без dynamic_cast
+#define CE_DECLARE_CLASS(ClassName, ParentClass) \
+ public: \
+  using ThisClass = ClassName; \
+  static const ClassInfo& StaticClass() \
+  { \
+    static const ClassInfo* s_ClassInfo = RegisterStaticClass(#ClassName, &ParentClass::StaticClass()); \
+    return *s_ClassInfo; \
+  } \
+  virtual const ClassInfo* GetClassInfo() const override \
+  { \
+    return &StaticClass(); \
+  } \
+\
+ private:
+
 #define CCLASS(ClassName) \
   static ClassInfo* ClassName##_ClassInfo = nullptr; \
   static void Register##ClassName() { \
@@ -3,6 +3,7 @@
 #include <vector>
 
 #include "Engine/Core/Rendering/Data/Vertex.h"
+#include "Engine/Core/Utilities/MeshAssetRegistry.h"
 #include "Engine/Core/CoreTypes.h"
 
 
@@ -10,6 +11,7 @@
   struct RenderObject
   {
     const FStaticMesh* mesh;
+    FMeshAssetId meshId = INVALID_MESH_ASSET_ID;  // ключ GPU буферов
     FMatrix transform;
     FVector color;
   };
@@ -24,6 +26,21 @@
     CameraData() : viewMatrix(1.0f), projectionMatrix(1.0f), position(0.0f)
     {
     }
+
+    // Та же матрица, что применяет шейдер: view уходит в UBO без транспонирования,
+    // поэтому GLSL видит ее транспонированной, а proj транспонируется при записи
+    FMatrix GetViewProjection() const
+    {
+      return projectionMatrix * viewMatrix.Transposed();
+    }
+  };
+
+  // Результат отсечения по пирамиде видимости за кадр
+  struct CullingStats
+  {
+    uint32_t testedObjects = 0;
+    uint32_t visibleObjects = 0;
+    uint32_t culledObjects = 0;
   };
 
   // UBO структуры для шейдеров
@@ -36,13 +53,6 @@
     float padding[13];
   };
 
-  struct ModelUBO
-  {
-    FMatrix model;
-    FVector4 color;
-    float padding[8];
-  };
-
   struct LightingUBO
   {
     FVector4 lightPositions[4];
@@ -74,6 +84,7 @@
     std::vector<RenderObject> renderObjects;
 
     LightingUBO lighting;
+    CullingStats culling;
 
     static_assert(sizeof(LightingUBO) == 160, "LightingUBO size should be 160 bytes");
     static_assert(offsetof(LightingUBO, lightPositions) == 0, "lightPositions offset mismatch");
@@ -86,6 +97,7 @@
       camera = CameraData();
       renderObjects.clear();
       lighting = LightingUBO();
+      culling = CullingStats();
     }
 
     void AddRenderObject(const RenderObject& object)
@@ -108,12 +120,12 @@
       return ubo;
     }
 
-    ModelUBO GetModelUBO(const FMatrix& modelMatrix, const FVector& meshColor) const
+    static FInstanceData GetInstanceData(const RenderObject& object)
     {
-      ModelUBO ubo{};
-      ubo.model = modelMatrix.Transposed();
-      ubo.color = FVector4(meshColor, 1.0f);
-      return ubo;
+      FInstanceData instance{};
+      instance.model = object.transform.Transposed();
+      instance.color = FVector4(object.color, 1.0f);
+      return instance;
     }
 
     // Настройка освещения по умолчанию
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "Engine/Core/Rendering/Data/RenderData.h"
+
+/**
+ * @class CRenderFrameQueue
+ * @brief Передача снимков FrameRenderData от игрового потока рендер потоку
+ *
+ * Снимков 2 или 3, и их память переиспользуется между кадрами. В каждый момент один снимок
+ * заполняет игровой поток, один рисует рендер поток, остальные ждут рендера по порядку.
+ * Опубликованный снимок не меняется, пока рендер поток его не вернет. Когда свободных
+ * снимков нет, BeginWrite ждет: игровой поток опережает рендер не больше чем на
+ * SlotCount - 1 кадр, и кадры не пропускаются.
+ */
+class CRenderFrameQueue
+{
+ public:
+  static constexpr uint32_t MIN_SLOTS = 2;
+  static constexpr uint32_t MAX_SLOTS = 3;
+
+  explicit CRenderFrameQueue(uint32_t SlotCount = MIN_SLOTS);
+
+  CRenderFrameQueue(const CRenderFrameQueue&) = delete;
+  CRenderFrameQueue& operator=(const CRenderFrameQueue&) = delete;
+
+  uint32_t GetSlotCount() const
+  {
+    return static_cast<uint32_t>(m_Slots.size());
+  }
+
+  // Игровой поток: очищенный свободный снимок; nullptr после Close
+  FrameRenderData* BeginWrite();
+  // Публикует снимок, взятый BeginWrite
+  void EndWrite();
+
+  // Рендер поток: самый старый опубликованный снимок; nullptr, когда очередь закрыта и пуста
+  const FrameRenderData* BeginRead();
+  // Возвращает снимок, взятый BeginRead, в свободные
+  void EndRead();
+
+  // Ждет, пока рендер поток не дорисует все опубликованные снимки
+  void WaitIdle();
+
+  // Будит оба потока; опубликованные снимки еще можно дочитать
+  void Close();
+
+ private:
+  static constexpr uint32_t NO_SLOT = UINT32_MAX;
+
+  std::vector<std::unique_ptr<FrameRenderData>> m_Slots;
+
+  std::mutex m_Mutex;
+  std::condition_variable m_SlotFreed;
+  std::condition_variable m_FramePublished;
+  std::deque<uint32_t> m_Free;
+  std::deque<uint32_t> m_Ready;
+  uint32_t m_Writing = NO_SLOT;
+  uint32_t m_Reading = NO_SLOT;
+  bool m_Closed = false;
+};
@@ -46,6 +46,18 @@
     }
   };
 
+  // Данные одного экземпляра для инстансинга (vertex binding 1, шаг - экземпляр)
+  struct FInstanceData
+  {
+    FMatrix model;  // уже транспонирована под column-major GLSL
+    FVector4 color;
+
+    static VkVertexInputBindingDescription GetBindingDescription();
+
+    // Матрица занимает четыре location подряд (по столбцу на location), затем цвет
+    static std::array<VkVertexInputAttributeDescription, 5> GetAttributeDescriptions();
+  };
+
   
   struct FStaticMesh
   {
@@ -58,9 +70,18 @@
    
     FVector color{1.0f, 1.0f, 1.0f};
 
+    // Локальные границы для отсечения; считаются при загрузке
+    FBox bounds;
+    FSphere boundingSphere;
+
     FStaticMesh() = default;
     FStaticMesh(const std::vector<Vertex>& verts, const std::vector<uint32_t>& inds)
         : vertices(verts), indices(inds)
     {
     }
+
+    // Бокс и сфера по позициям вершин
+    void ComputeBounds();
+    // Сфера вокруг центра уже известного бокса (бокс берется, например, из запеченного заголовка)
+    void ComputeBoundingSphere();
   };
@@ -1,4 +1,5 @@
 #pragma once
+#include <atomic>
 #include <memory>
 #include <unordered_map>
 
@@ -6,21 +7,46 @@
 
 #include "CoreMinimal.h"
 #include "Engine/Core/Rendering/Data/RenderData.h"
+#include "Engine/Core/Utilities/MeshAssetRegistry.h"
 #include "Engine/Core/Rendering/Vulkan/Managers/BufferManager.h"
 #include "Engine/Core/Rendering/Vulkan/Managers/CommandBufferManager.h"
 #include "Engine/Core/Rendering/Vulkan/Managers/DescriptorManager.h"
 #include "Engine/Core/Rendering/Vulkan/Managers/DeviceManager.h"
+#include "Engine/Core/Rendering/Vulkan/Managers/GpuProfiler.h"
 #include "Engine/Core/Rendering/Vulkan/Managers/PipelineManager.h"
 #include "Engine/Core/Rendering/Vulkan/Managers/SwapchainManager.h"
+#include "Engine/Core/Rendering/Vulkan/Managers/UniformRingBuffer.h"
+#include "Engine/Core/Rendering/Vulkan/Managers/UploadManager.h"
+#include "Engine/Core/Rendering/Vulkan/Utils/ResourceHandle.h"
 #include "Engine/Core/Rendering/Vulkan/Utils/VulkanUtils.h"
 #include "vulkan/vulkan.h"
 
 
+  // Геометрия меш-ассета, общая для всех его экземпляров
   struct MeshBuffers
   {
-    std::string vertexBufferName;
-    std::string indexBufferName;
-    std::string modelUBOName;
+    BufferHandle vertexBuffer;
+    BufferHandle indexBuffer;
+    uint32_t indexCount = 0;
+    uint64_t uploadTicket = 0;  // меш можно рисовать, когда UploadManager завершит эту партию
+  };
+
+  struct MeshTag;
+  using MeshHandle = ResourceHandle<MeshTag>;
+
+  // Группа объектов одного меша: один DrawIndexed, экземпляры лежат подряд в instance буфере кадра
+  struct InstanceBatch
+  {
+    MeshHandle mesh;
+    uint32_t indexCount = 0;
+    uint32_t firstInstance = 0;
+    uint32_t instanceCount = 0;
+  };
+
+  struct DrawStats
+  {
+    uint32_t objectCount = 0;
+    uint32_t drawCallCount = 0;
   };
 
   class VulkanContext
@@ -45,7 +71,14 @@
         if (event.type == SDL_EVENT_QUIT)
         {
           m_shouldClose = true;
-        }      
+        }
+        else if (event.type == SDL_EVENT_WINDOW_PIXEL_SIZE_CHANGED && m_swapchainManager)
+        {
+          // Размер в пикселях, как и при создании окна; swapchain пересоздаст DrawFrame, возможно, на рендер потоке
+          m_swapchainManager->SetWindowExtent(static_cast<uint32_t>(event.window.data1),
+                                              static_cast<uint32_t>(event.window.data2));
+          m_frameBufferResized = true;
+        }
       }
     }
   
@@ -53,8 +86,12 @@
     {
       m_frameBufferResized = true;
     }
-    void RegisterMesh(const std::string& name, const FStaticMesh& mesh);
-    void UnregisterMesh(const std::string& name);
+    MeshHandle RegisterMesh(FMeshAssetId meshId, const FStaticMesh& mesh);
+    void UnregisterMesh(FMeshAssetId meshId);
+    const DrawStats& GetLastDrawStats() const { return m_drawStats; }
+    // Время GPU на кадр по timestamp запросам, отстает на MAX_FRAMES_IN_FLIGHT кадров; 0 без профилировщика
+    double GetLastGpuFrameMs() const { return m_gpuProfiler ? m_gpuProfiler->GetLastFrameMs() : 0.0; }
+    MemoryAllocatorStats GetMemoryStats() const { return m_bufferManager ? m_bufferManager->GetMemoryStats() : MemoryAllocatorStats{}; }
 
     
     VkInstance GetInstance() const { return m_instance; }
@@ -76,8 +113,14 @@
     bool CreateSurface();
     void CreateSyncObjects();
     void CleanupSyncObjects();
-    void RecordCommandBuffer(uint32_t imageIndex, const FrameRenderData& renderData);
+    void RecordCommandBuffer(uint32_t imageIndex);
+    void RecordRenderPass(uint32_t imageIndex);
     void UpdateUniformBuffers(const FrameRenderData& renderData);
+    void PrepareInstances(const FrameRenderData& renderData);
+    FInstanceData* GetInstanceData(uint32_t frame, size_t instanceCount);
+    void ReleaseUnusedMeshes();
+    void DropFailedUploads();
+    void InitializeBindless();
 
     static VKAPI_ATTR VkBool32 VKAPI_CALL DebugCallback(
         VkDebugUtilsMessageSeverityFlagBitsEXT messageSeverity,
@@ -90,6 +133,7 @@
     SDL_Window* m_window = nullptr;
 
     VkInstance m_instance = VK_NULL_HANDLE;
+    uint32_t m_apiVersion = VK_API_VERSION_1_0;
     VkSurfaceKHR m_surface = VK_NULL_HANDLE;
     VkDebugUtilsMessengerEXT m_debugMessenger = VK_NULL_HANDLE;
 
@@ -99,6 +143,9 @@
     std::shared_ptr<BufferManager> m_bufferManager;
     std::shared_ptr<DescriptorManager> m_descriptorManager;
     std::shared_ptr<CommandBufferManager> m_commandBufferManager;
+    std::shared_ptr<UniformRingBuffer> m_uniformRing;
+    std::shared_ptr<UploadManager> m_uploadManager;
+    std::shared_ptr<GpuProfiler> m_gpuProfiler;  // nullptr, если очередь не поддерживает timestamp
 
     
     std::vector<VkSemaphore> m_imageAvailableSemaphores;
@@ -106,17 +153,35 @@
     std::vector<VkFence> m_inFlightFences;
     std::vector<VkFence> m_imagesInFlight;
     uint32_t m_currentFrame = 0;
-    bool m_frameBufferResized = false;
+    std::atomic<bool> m_frameBufferResized{false};  // ставит поток окна, читает DrawFrame
     bool m_shouldClose = false;
 
     
-    std::unordered_map<std::string, MeshBuffers> m_meshBufferMap;
-    const std::string m_sceneUBOBufferName = "scene_ubo";
-    const std::string m_lightingUBOBufferName = "lighting_ubo";
+    // Геометрия в плотном массиве слотов; id ассета переводится в хэндл один раз на группу объектов
+    ResourcePool<MeshBuffers, MeshTag> m_meshes;
+    std::unordered_map<FMeshAssetId, MeshHandle> m_meshHandles;
+    std::vector<InstanceBatch> m_instanceBatches;
+    std::vector<uint32_t> m_drawOrder;
+    std::vector<BufferHandle> m_instanceBuffers;  // по одному на кадр в полете
+    // Bindless: instance буферы кадров лежат в глобальном массиве, слот выбирается push constant
+    bool m_useBindless = false;
+    std::vector<uint32_t> m_instanceBindlessSlots;
+    DrawStats m_drawStats;
+    // Освобожденные ассеты ждут, пока кадры, которые могли их использовать, завершатся
+    std::vector<std::pair<FMeshAssetId, uint64_t>> m_pendingMeshReleases;
+    std::vector<uint64_t> m_failedUploadTickets;  // буфер для DropFailedUploads
+    uint64_t m_frameNumber = 0;
+    const std::string m_uniformRingBufferName = "frame_uniforms";
+    uint32_t m_sceneUBOOffset = 0;
+    uint32_t m_lightingUBOOffset = 0;
+    DescriptorSetHandle m_sceneDescriptorSet;
 
     
     VkCommandBuffer m_currentCommandBuffer = VK_NULL_HANDLE;
 
     static constexpr uint32_t MAX_FRAMES_IN_FLIGHT = 3;
+    static constexpr VkDeviceSize UNIFORM_RING_FRAME_SIZE = 64 * 1024;
+    static constexpr VkDeviceSize UPLOAD_STAGING_SIZE = 32 * 1024 * 1024;
+    static constexpr uint32_t BINDLESS_BUFFER_CAPACITY = 256;
     const bool bIsValidationEnabled = true;
   };
@@ -0,0 +1,45 @@
+#pragma once
+#include <exception>
+#include <thread>
+
+#include "Engine/Core/Rendering/Data/RenderFrameQueue.h"
+#include "Engine/Core/Rendering/Vulkan/Integration/RenderSystem.h"
+
+// Рисует снимки кадров на своем потоке: игровой поток тикает кадр N + 1, пока кадр N
+// записывается и отправляется. Весь Vulkan кадра, включая пересоздание swapchain,
+// выполняется на рендер потоке между снимками. Без Start кадр рисуется сразу в EndFrame.
+class RenderThread
+  {
+   public:
+    // frameBuffers - снимков FrameRenderData (2 или 3), задержка кадра не больше frameBuffers - 1
+    RenderThread(RenderSystem* renderSystem, uint32_t frameBuffers);
+    ~RenderThread();
+
+    RenderThread(const RenderThread&) = delete;
+    RenderThread& operator=(const RenderThread&) = delete;
+
+    void Start();
+    // Дорисовывает опубликованные кадры и останавливает поток
+    void Stop();
+    bool IsRunning() const
+    {
+      return m_thread.joinable();
+    }
+
+    // Игровой поток: снимок для заполнения; ждет, если рендер отстает. nullptr после Stop
+    FrameRenderData* BeginFrame();
+    // Отдает снимок рендеру; исключение рендер потока пробрасывается здесь
+    void EndFrame();
+
+    // Ждет, пока все отданные кадры не будут нарисованы
+    void Flush();
+
+   private:
+    void ThreadLoop();
+    void RethrowRenderError();
+
+    RenderSystem* m_renderSystem = nullptr;
+    CRenderFrameQueue m_frames;
+    std::thread m_thread;
+    std::exception_ptr m_error;  // пишет рендер поток до Close очереди
+  };
@@ -1,11 +1,14 @@
 #pragma once
 #include <memory>
+#include <string>
 #include <unordered_map>
 #include <vector>
 
 #include "CoreMinimal.h"
 #include "Engine/Core/Rendering/Data/Vertex.h"
 #include "Engine/Core/Rendering/Vulkan/Managers/DeviceManager.h"
+#include "Engine/Core/Rendering/Vulkan/Managers/MemoryAllocator.h"
+#include "Engine/Core/Rendering/Vulkan/Utils/ResourceHandle.h"
 #include "Engine/Core/Rendering/Vulkan/Utils/VulkanUtils.h"
 #include "vulkan/vulkan.h"
 
@@ -23,12 +26,16 @@
   struct BufferInfo
   {
     VkBuffer buffer = VK_NULL_HANDLE;
-    VkDeviceMemory memory = VK_NULL_HANDLE;
+    MemoryAllocation allocation;  // участок общего блока памяти
     VkDeviceSize size = 0;
-    BufferType type;
+    BufferType type = BufferType::VERTEX;
     void* mappedData = nullptr;
+    std::string name;  // отладочная метка; пустая у анонимных буферов
   };
 
+  struct BufferTag;
+  using BufferHandle = ResourceHandle<BufferTag>;
+
   class BufferManager
   {
    public:
@@ -43,45 +50,65 @@
     void Shutdown();
 
     
-    bool CreateVertexBuffer(const std::string& name, const std::vector<Vertex>& vertices);
-    bool CreateIndexBuffer(const std::string& name, const std::vector<uint32_t>& indices);
-    bool CreateUniformBuffer(const std::string& name, VkDeviceSize size);
-    bool CreateStagingBuffer(const std::string& name, VkDeviceSize size);
+    // Имя - отладочная метка. Непустое имя дополнительно регистрируется для поиска через FindBuffer,
+    // повторное создание с тем же именем возвращает существующий буфер
+    BufferHandle CreateVertexBuffer(const std::string& name, const std::vector<Vertex>& vertices);
+    BufferHandle CreateIndexBuffer(const std::string& name, const std::vector<uint32_t>& indices);
+    BufferHandle CreateUniformBuffer(const std::string& name, VkDeviceSize size);
+    BufferHandle CreateStagingBuffer(const std::string& name, VkDeviceSize size);
+    // Device-local буфер без данных, заполняется асинхронно через UploadManager
+    BufferHandle CreateDeviceBuffer(const std::string& name, VkDeviceSize size, VkBufferUsageFlags usage, BufferType type);
+    // Host-visible vertex буфер, постоянно отображенный; данные пишутся через GetMappedData.
+    // extraUsage - например STORAGE_BUFFER, если те же данные читаются шейдером как массив
+    BufferHandle CreateDynamicVertexBuffer(const std::string& name, VkDeviceSize size, VkBufferUsageFlags extraUsage = 0);
 
    
-    bool UpdateVertexBuffer(const std::string& name, const std::vector<Vertex>& vertices);
-    bool UpdateIndexBuffer(const std::string& name, const std::vector<uint32_t>& indices);
-    bool UpdateUniformBuffer(const std::string& name, const void* data, VkDeviceSize size);
+    bool UpdateVertexBuffer(BufferHandle handle, const std::vector<Vertex>& vertices);
+    bool UpdateIndexBuffer(BufferHandle handle, const std::vector<uint32_t>& indices);
+    bool UpdateUniformBuffer(BufferHandle handle, const void* data, VkDeviceSize size);
 
     
-    void CopyBuffer(const std::string& srcName, const std::string& dstName, VkDeviceSize size);
+    void CopyBuffer(BufferHandle src, BufferHandle dst, VkDeviceSize size);
     void CopyBuffer(VkBuffer srcBuffer, VkBuffer dstBuffer, VkDeviceSize size); 
 
-    
-    VkBuffer GetBuffer(const std::string& name) const;
-    VkDeviceSize GetBufferSize(const std::string& name) const;
-    BufferType GetBufferType(const std::string& name) const;
-    VkDescriptorBufferInfo GetBufferInfo(const std::string& name) const;
+    // Доступ по хэндлу - индексация плотного массива, годится для горячего пути
+    VkBuffer GetBuffer(BufferHandle handle) const;
+    VkDeviceSize GetBufferSize(BufferHandle handle) const;
+    BufferType GetBufferType(BufferHandle handle) const;
+    VkDescriptorBufferInfo GetBufferInfo(BufferHandle handle) const;
+    const std::string& GetBufferName(BufferHandle handle) const;
+    MemoryAllocatorStats GetMemoryStats() const;
+
+    // Поиск по имени для инструментов и отладки, не для покадрового кода
+    BufferHandle FindBuffer(const std::string& name) const;
 
     
-    void* MapBuffer(const std::string& name);
-    void UnmapBuffer(const std::string& name);
+    void* MapBuffer(BufferHandle handle);
+    void UnmapBuffer(BufferHandle handle);
+    void* GetMappedData(BufferHandle handle) const;
 
     
-    void DestroyBuffer(const std::string& name);
+    void DestroyBuffer(BufferHandle handle);
     void DestroyAllBuffers();
 
    private:
     bool CreateBuffer(VkDeviceSize size, VkBufferUsageFlags usage,
-                      VkMemoryPropertyFlags properties, VkBuffer& buffer,
-                      VkDeviceMemory& bufferMemory);
-    void DestroyBuffer(BufferInfo& bufferInfo);
-
-    uint32_t FindMemoryType(uint32_t typeFilter, VkMemoryPropertyFlags properties);
+                      VkMemoryPropertyFlags properties, AllocationStrategy strategy,
+                      BufferInfo& outBuffer);
+    BufferHandle CreateDeviceLocalBuffer(const std::string& name, const void* data, VkDeviceSize size,
+                                         VkBufferUsageFlags usage, BufferType type);
+    // Общая часть Create*: проверка имени, создание и регистрация
+    BufferHandle CreateNamedBuffer(const std::string& name, VkDeviceSize size, VkBufferUsageFlags usage,
+                                   VkMemoryPropertyFlags properties, AllocationStrategy strategy, BufferType type);
+    BufferHandle Register(const std::string& name, BufferInfo&& bufferInfo);
+    bool UpdateDeviceLocalBuffer(BufferHandle handle, BufferType type, const void* data, VkDeviceSize size);
+    void ReleaseBuffer(BufferInfo& bufferInfo);
 
    private:
     std::shared_ptr<DeviceManager> m_deviceManager;
-    std::unordered_map<std::string, BufferInfo> m_buffers;
+    std::shared_ptr<MemoryAllocator> m_allocator;
+    ResourcePool<BufferInfo, BufferTag> m_buffers;
+    std::unordered_map<std::string, BufferHandle> m_namedBuffers;
 
     VkCommandPool m_commandPool = VK_NULL_HANDLE;
   };
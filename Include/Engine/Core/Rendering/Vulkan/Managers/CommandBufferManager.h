@@ -37,7 +37,10 @@
     
     void BindPipeline(uint32_t commandBufferIndex, VkPipeline pipeline, VkPipelineBindPoint bindPoint = VK_PIPELINE_BIND_POINT_GRAPHICS);
     void BindDescriptorSets(uint32_t commandBufferIndex, VkPipelineLayout layout,
-                            uint32_t firstSet, const std::vector<VkDescriptorSet>& descriptorSets);
+                            uint32_t firstSet, const std::vector<VkDescriptorSet>& descriptorSets,
+                            const std::vector<uint32_t>& dynamicOffsets = {});
+    void PushConstants(uint32_t commandBufferIndex, VkPipelineLayout layout, VkShaderStageFlags stageFlags,
+                       uint32_t offset, uint32_t size, const void* data);
 
     
     void BindVertexBuffers(uint32_t commandBufferIndex, uint32_t firstBinding,
@@ -5,37 +5,99 @@
 #include "CoreMinimal.h"
 #include "Engine/Core/Rendering/Vulkan/Managers/BufferManager.h"
 #include "Engine/Core/Rendering/Vulkan/Managers/DeviceManager.h"
+#include "Engine/Core/Rendering/Vulkan/Utils/ResourceHandle.h"
 #include "vulkan/vulkan.h"
 
+struct DescriptorSetTag;
+using DescriptorSetHandle = ResourceHandle<DescriptorSetTag>;
+
+// Доля дескрипторов типа на один set пула
+struct DescriptorPoolSizeRatio
+{
+  VkDescriptorType type;
+  float ratio;
+};
+
+// Цепочка descriptor пулов: исчерпанный пул откладывается, следующий создается крупнее.
+// Наборы не освобождаются по одному, а уходят вместе с пулами в Destroy.
+class DescriptorAllocator
+{
+ public:
+  void Initialize(VkDevice device, uint32_t initialSets, const std::vector<DescriptorPoolSizeRatio>& ratios);
+  void Destroy();
+
+  VkDescriptorSet Allocate(VkDescriptorSetLayout layout);
+
+  VkDescriptorPool GetFirstPool() const { return m_firstPool; }
+  uint32_t GetPoolCount() const { return static_cast<uint32_t>(m_readyPools.size() + m_fullPools.size()); }
+
+  static constexpr uint32_t MAX_SETS_PER_POOL = 4096;
+
+ private:
+  VkDescriptorPool AcquirePool();
+  VkDescriptorPool CreatePool(uint32_t setCount);
+
+  VkDevice m_device = VK_NULL_HANDLE;
+  std::vector<DescriptorPoolSizeRatio> m_ratios;
+  std::vector<VkDescriptorPool> m_readyPools;
+  std::vector<VkDescriptorPool> m_fullPools;
+  VkDescriptorPool m_firstPool = VK_NULL_HANDLE;
+  uint32_t m_setsPerPool = 0;
+};
+
 class DescriptorManager
 {
  public:
   DescriptorManager(std::shared_ptr<DeviceManager> deviceManager, std::shared_ptr<BufferManager> bufferManager);
   ~DescriptorManager();
 
- 
+
   DescriptorManager(const DescriptorManager&) = delete;
   DescriptorManager& operator=(const DescriptorManager&) = delete;
 
   bool Initialize();
   void Shutdown();
 
- 
+
   bool CreateDescriptorSets(VkDescriptorSetLayout layout, uint32_t count);
   VkDescriptorSet GetDescriptorSet(uint32_t imageIndex) const;
 
-  bool CreateMeshDescriptorSet(const std::string& meshName, VkDescriptorSetLayout layout);
-  VkDescriptorSet GetMeshDescriptorSet(const std::string& meshName) const;
-  bool UpdateMeshDescriptorSet(const std::string& meshName,
-                               const std::string& sceneUBOName,
-                               const std::string& modelUBOName,
-                               const std::string& lightingUBOName);
-  VkDescriptorPool GetDescriptorPool() const { return m_descriptorPool; }
+  // Имя используется только в сообщениях об ошибках
+  DescriptorSetHandle CreateMeshDescriptorSet(VkDescriptorSetLayout layout, const std::string& debugName = "");
+  VkDescriptorSet GetMeshDescriptorSet(DescriptorSetHandle handle) const;
+  // Scene (binding 0) и lighting (binding 2) - dynamic UBO из одного кольцевого буфера
+  bool UpdateMeshDescriptorSet(DescriptorSetHandle handle,
+                               BufferHandle uniformRing,
+                               VkDeviceSize sceneRange,
+                               VkDeviceSize lightingRange);
+
+  // Bindless: один глобальный set с массивом storage буферов (set 1, binding 0).
+  // Слот массива выбирается push constant, поэтому переключение данных не требует bind
+  bool InitializeBindless(uint32_t capacity);
+  bool IsBindlessEnabled() const { return m_bindlessSet != VK_NULL_HANDLE; }
+  VkDescriptorSetLayout GetBindlessLayout() const { return m_bindlessLayout; }
+  VkDescriptorSet GetBindlessSet() const { return m_bindlessSet; }
+  uint32_t AllocateBindlessSlot();
+  void ReleaseBindlessSlot(uint32_t slot);
+  void WriteBindlessBuffer(uint32_t slot, VkBuffer buffer, VkDeviceSize range);
+
+  VkDescriptorPool GetDescriptorPool() const { return m_persistentAllocator.GetFirstPool(); }
+
+  static constexpr uint32_t INVALID_BINDLESS_SLOT = UINT32_MAX;
+
+ private:
+  void ShutdownBindless();
 
  private:
   std::shared_ptr<DeviceManager> m_deviceManager;
   std::shared_ptr<BufferManager> m_bufferManager;
-  std::unordered_map<std::string, VkDescriptorSet> m_meshDescriptorSets;
-  VkDescriptorPool m_descriptorPool = VK_NULL_HANDLE;
+  ResourcePool<VkDescriptorSet, DescriptorSetTag> m_meshDescriptorSets;
+  DescriptorAllocator m_persistentAllocator;
   std::vector<VkDescriptorSet> m_descriptorSets;
+
+  VkDescriptorSetLayout m_bindlessLayout = VK_NULL_HANDLE;
+  VkDescriptorPool m_bindlessPool = VK_NULL_HANDLE;
+  VkDescriptorSet m_bindlessSet = VK_NULL_HANDLE;
+  uint32_t m_bindlessCapacity = 0;
+  std::vector<uint32_t> m_freeBindlessSlots;
 };
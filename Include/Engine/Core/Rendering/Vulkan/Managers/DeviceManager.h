@@ -12,6 +12,7 @@ struct QueueFamilyIndices
 {
   uint32_t graphicsFamily = UINT32_MAX;
   uint32_t presentFamily = UINT32_MAX;
+  uint32_t transferFamily = UINT32_MAX;  // отдельное семейство для копирования или graphicsFamily
 
   bool IsComplete() const
   {
@@ -29,7 +30,8 @@ class DeviceManager
   DeviceManager(const DeviceManager&) = delete;
   DeviceManager& operator=(const DeviceManager&) = delete;
 
-  bool Initialize(VkInstance instance, VkSurfaceKHR surface);
+  // apiVersion - версия, с которой создан instance; фичи Vulkan 1.2 включаются только если ее поддерживают оба
+  bool Initialize(VkInstance instance, VkSurfaceKHR surface, uint32_t apiVersion = VK_API_VERSION_1_0);
   void Shutdown();
 
   
@@ -37,6 +39,10 @@ class DeviceManager
   {
     return m_physicalDevice;
   }
+  const VkPhysicalDeviceProperties& GetProperties() const
+  {
+    return m_properties;
+  }
   VkDevice GetDevice() const
   {
     return m_device;
@@ -49,6 +55,19 @@ class DeviceManager
   {
     return m_presentQueue;
   }
+  VkQueue GetTransferQueue() const
+  {
+    return m_transferQueue;
+  }
+  bool HasDedicatedTransferQueue() const
+  {
+    return m_queueIndices.transferFamily != m_queueIndices.graphicsFamily;
+  }
+  // Descriptor indexing: массивы storage буферов без привязки всех элементов и обновление после bind
+  bool SupportsBindless() const
+  {
+    return m_bindlessSupported;
+  }
   QueueFamilyIndices& getIndices()
   {
     return m_queueIndices;
@@ -62,13 +81,18 @@ class DeviceManager
   bool IsDeviceSuitable(VkPhysicalDevice device, VkSurfaceKHR surface);
   int RateDeviceSuitability(VkPhysicalDevice device, VkSurfaceKHR surface);
   bool CheckDeviceExtensionSupport(VkPhysicalDevice device);
+  bool QueryBindlessSupport(VkPhysicalDevice device) const;
 
  private:
   VkPhysicalDevice m_physicalDevice = VK_NULL_HANDLE;
+  VkPhysicalDeviceProperties m_properties{};
   VkDevice m_device = VK_NULL_HANDLE;
   VkQueue m_graphicsQueue = VK_NULL_HANDLE;
   VkQueue m_presentQueue = VK_NULL_HANDLE;
+  VkQueue m_transferQueue = VK_NULL_HANDLE;
   QueueFamilyIndices m_queueIndices;
+  uint32_t m_apiVersion = VK_API_VERSION_1_0;
+  bool m_bindlessSupported = false;
   const std::vector<const char*> m_deviceExtensions = {
       VK_KHR_SWAPCHAIN_EXTENSION_NAME};
 };
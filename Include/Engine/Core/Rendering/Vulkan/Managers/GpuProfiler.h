@@ -0,0 +1,122 @@
+#pragma once
+#include <memory>
+#include <vector>
+
+#include "CoreMinimal.h"
+#include "Engine/Core/Rendering/Vulkan/Managers/CommandBufferManager.h"
+#include "Engine/Core/Rendering/Vulkan/Managers/DeviceManager.h"
+#include "vulkan/vulkan.h"
+
+  // Время GPU по timestamp запросам (ядро Vulkan 1.0, работает и на lavapipe).
+  // У каждого кадра в полете свой диапазон запросов в общем пуле. Результаты кадра читаются,
+  // когда DrawFrame снова дождался его фенса, то есть с задержкой в MAX_FRAMES_IN_FLIGHT кадров
+  // и без ожидания GPU. Интервалы переводятся в шкалу CProfiler::Now и пишутся на дорожку "GPU".
+  class GpuProfiler
+  {
+   public:
+    GpuProfiler(std::shared_ptr<DeviceManager> deviceManager, std::shared_ptr<CommandBufferManager> commandBufferManager);
+    ~GpuProfiler();
+
+    GpuProfiler(const GpuProfiler&) = delete;
+    GpuProfiler& operator=(const GpuProfiler&) = delete;
+
+    // false, если очередь графики не пишет timestamp; тогда все вызовы ниже ничего не делают
+    bool Initialize(uint32_t frameCount);
+    void Shutdown();
+
+    bool IsSupported() const { return m_queryPool != VK_NULL_HANDLE; }
+
+    // Вызывать после ожидания фенса кадра: забирает прошлые результаты его диапазона
+    void BeginFrame(uint32_t frameIndex);
+
+    // Сброс диапазона кадра; в начале command buffer, вне render pass
+    void ResetQueries(VkCommandBuffer commandBuffer);
+
+    // Name - строковый литерал. Возвращает индекс интервала или UINT32_MAX, если запросы кадра кончились
+    uint32_t BeginScope(VkCommandBuffer commandBuffer, const char* name);
+    void EndScope(VkCommandBuffer commandBuffer, uint32_t scope);
+
+    // CPU время отправки кадра: GPU не мог начать его раньше, по нему поправляется сдвиг шкал
+    void MarkSubmit();
+
+    // Длительность самого внешнего интервала последнего прочитанного кадра
+    double GetLastFrameMs() const { return m_lastFrameMs; }
+
+   private:
+    struct ScopeInfo
+    {
+      const char* name = nullptr;
+      uint32_t depth = 0;
+    };
+
+    struct FrameQueries
+    {
+      std::vector<ScopeInfo> scopes;  // интервал i - запросы 2i и 2i + 1 диапазона кадра
+      uint64_t submitNs = 0;
+      bool pending = false;  // записан и отправлен, результаты еще не прочитаны
+    };
+
+    void Calibrate();
+    void ReadResults(uint32_t frameIndex);
+    uint64_t ToProfilerNs(uint64_t ticks) const;
+
+   private:
+    std::shared_ptr<DeviceManager> m_deviceManager;
+    std::shared_ptr<CommandBufferManager> m_commandBufferManager;
+
+    VkQueryPool m_queryPool = VK_NULL_HANDLE;
+    std::vector<FrameQueries> m_frames;
+    std::vector<uint64_t> m_results;
+    uint32_t m_currentFrame = 0;
+    bool m_recording = false;  // профилировщик был включен на начале записи кадра
+    uint32_t m_depth = 0;
+
+    uint64_t m_timestampMask = ~0ull;
+    double m_timestampPeriod = 1.0;  // наносекунд на тик
+    uint64_t m_baseTicks = 0;        // тик калибровки
+    int64_t m_offsetNs = 0;          // время CProfiler, соответствующее m_baseTicks
+    uint32_t m_track = 0;
+    double m_lastFrameMs = 0.0;
+
+    static constexpr uint32_t MAX_SCOPES_PER_FRAME = 128;
+  };
+
+  // Интервал GPU на время жизни объекта; profiler может быть nullptr
+  class GpuProfileScope
+  {
+   public:
+    GpuProfileScope(GpuProfiler* profiler, VkCommandBuffer commandBuffer, const char* name)
+        : m_profiler(profiler), m_commandBuffer(commandBuffer)
+    {
+      if (m_profiler)
+      {
+        m_scope = m_profiler->BeginScope(m_commandBuffer, name);
+      }
+    }
+
+    ~GpuProfileScope()
+    {
+      if (m_profiler)
+      {
+        m_profiler->EndScope(m_commandBuffer, m_scope);
+      }
+    }
+
+    GpuProfileScope(const GpuProfileScope&) = delete;
+    GpuProfileScope& operator=(const GpuProfileScope&) = delete;
+
+   private:
+    GpuProfiler* m_profiler = nullptr;
+    VkCommandBuffer m_commandBuffer = VK_NULL_HANDLE;
+    uint32_t m_scope = UINT32_MAX;
+  };
+
+#if CE_ENABLE_PROFILER
+#define CE_GPU_PROFILE_SCOPE(Profiler, CommandBuffer, Name) \
+  GpuProfileScope CE_PROFILE_CONCAT(gpuProfileScope_, __LINE__)(Profiler, CommandBuffer, Name)
+#else
+#define CE_GPU_PROFILE_SCOPE(Profiler, CommandBuffer, Name) \
+  do                                                        \
+  {                                                         \
+  } while (0)
+#endif
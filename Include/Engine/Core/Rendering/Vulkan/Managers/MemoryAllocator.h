@@ -0,0 +1,97 @@
+#pragma once
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "CoreMinimal.h"
+#include "Engine/Core/Rendering/Vulkan/Managers/DeviceManager.h"
+#include "vulkan/vulkan.h"
+
+  // Стратегия выделения внутри блока
+  enum class AllocationStrategy
+  {
+    FREE_LIST,  // долгоживущие ресурсы: best-fit по списку свободных диапазонов со слиянием соседей
+    LINEAR      // временные ресурсы (staging): сдвиг указателя, блок сбрасывается, когда опустеет
+  };
+
+  // Один vkAllocateMemory, из которого нарезаются суб-аллокации
+  struct MemoryBlock
+  {
+    VkDeviceMemory memory = VK_NULL_HANDLE;
+    VkDeviceSize size = 0;
+    uint32_t memoryTypeIndex = 0;
+    AllocationStrategy strategy = AllocationStrategy::FREE_LIST;
+    bool dedicated = false;  // под один большой ресурс, освобождается вместе с ним
+    void* mappedData = nullptr;  // host-visible блоки отображены постоянно
+
+    std::map<VkDeviceSize, VkDeviceSize> freeRanges;  // offset -> size, только для FREE_LIST
+    VkDeviceSize linearOffset = 0;
+    VkDeviceSize usedBytes = 0;
+    uint32_t allocationCount = 0;
+  };
+
+  // Суб-аллокация: память, смещение для vkBind*Memory и указатель, если память host-visible
+  struct MemoryAllocation
+  {
+    VkDeviceMemory memory = VK_NULL_HANDLE;
+    VkDeviceSize offset = 0;
+    VkDeviceSize size = 0;
+    void* mappedData = nullptr;
+    MemoryBlock* block = nullptr;
+
+    bool IsValid() const { return block != nullptr; }
+  };
+
+  struct MemoryAllocatorStats
+  {
+    uint32_t blockCount = 0;             // живые vkAllocateMemory
+    uint32_t dedicatedBlockCount = 0;
+    uint32_t allocationCount = 0;        // живые суб-аллокации
+    VkDeviceSize reservedBytes = 0;      // суммарный размер блоков
+    VkDeviceSize usedBytes = 0;          // занято суб-аллокациями (с учетом выравнивания)
+    uint64_t totalBlockAllocations = 0;  // vkAllocateMemory за все время
+    uint64_t totalAllocations = 0;       // суб-аллокаций за все время
+  };
+
+  class MemoryAllocator
+  {
+   public:
+    MemoryAllocator(std::shared_ptr<DeviceManager> deviceManager);
+    ~MemoryAllocator();
+
+    MemoryAllocator(const MemoryAllocator&) = delete;
+    MemoryAllocator& operator=(const MemoryAllocator&) = delete;
+
+    bool Initialize();
+    void Shutdown();
+
+    bool Allocate(const VkMemoryRequirements& requirements, VkMemoryPropertyFlags properties,
+                  AllocationStrategy strategy, MemoryAllocation& outAllocation);
+    void Free(MemoryAllocation& allocation);
+
+    MemoryAllocatorStats GetStats() const;
+
+    static constexpr VkDeviceSize DEVICE_LOCAL_BLOCK_SIZE = 64ull * 1024 * 1024;
+    static constexpr VkDeviceSize HOST_VISIBLE_BLOCK_SIZE = 16ull * 1024 * 1024;
+
+   private:
+    uint32_t FindMemoryType(uint32_t typeFilter, VkMemoryPropertyFlags properties) const;
+    VkDeviceSize GetBlockSize(uint32_t memoryTypeIndex) const;
+    MemoryBlock* CreateBlock(uint32_t memoryTypeIndex, VkDeviceSize size, AllocationStrategy strategy, bool dedicated);
+    void DestroyBlock(MemoryBlock* block);
+
+    static bool AllocateFromBlock(MemoryBlock& block, VkDeviceSize size, VkDeviceSize alignment, VkDeviceSize& outOffset);
+    static void FreeFromBlock(MemoryBlock& block, VkDeviceSize offset, VkDeviceSize size);
+
+   private:
+    std::shared_ptr<DeviceManager> m_deviceManager;
+    VkPhysicalDeviceMemoryProperties m_memoryProperties{};
+
+    // Пулы по типу памяти: индекс - memoryTypeIndex
+    std::vector<std::vector<std::unique_ptr<MemoryBlock>>> m_pools;
+    mutable std::mutex m_mutex;
+
+    uint64_t m_totalBlockAllocations = 0;
+    uint64_t m_totalAllocations = 0;
+  };
@@ -27,6 +27,12 @@
     uint32_t subpass = 0;
   };
 
+  // Push constant bindless пайплайна: какой слот глобального массива хранит instance данные кадра
+  struct BindlessDrawConstants
+  {
+    uint32_t instanceBufferIndex = 0;
+  };
+
   class PipelineManager
   {
    public:
@@ -42,6 +48,9 @@
 
    
     VkPipeline CreateMeshPipeline(const std::string& name, VkRenderPass renderPass);
+    // Вариант без instance vertex буфера: данные экземпляров берутся из bindless массива (set 1)
+    VkPipeline CreateBindlessMeshPipeline(const std::string& name, VkRenderPass renderPass,
+                                          VkDescriptorSetLayout bindlessLayout);
 
     
     VkPipeline GetPipeline(const std::string& name) const;
@@ -49,6 +58,10 @@
     {
       return m_pipelineLayout;
     }
+    VkPipelineLayout GetBindlessPipelineLayout() const
+    {
+      return m_bindlessPipelineLayout;
+    }
     VkDescriptorSetLayout GetDescriptorSetLayout() const
     {
       return m_descriptorSetLayout;
@@ -61,9 +74,13 @@
     bool CreatePipelineLayout();
     void DestroyPipelineLayout();
 
+    VkPipeline CreateMeshPipeline(const std::string& name, VkRenderPass renderPass,
+                                  const char* vertexShaderPath, VkPipelineLayout layout,
+                                  bool instanceVertexInput);
     VkPipeline CreateGraphicsPipeline(
         const PipelineConfigInfo& configInfo,
-        const std::vector<VkPipelineShaderStageCreateInfo>& shaderStages);
+        const std::vector<VkPipelineShaderStageCreateInfo>& shaderStages,
+        bool instanceVertexInput);
 
     VkShaderModule CreateShaderModule(const std::vector<char>& code);
     std::vector<char> ReadShaderFile(const std::string& filename);
@@ -72,6 +89,7 @@
     std::shared_ptr<DeviceManager> m_deviceManager;
 
     VkPipelineLayout m_pipelineLayout = VK_NULL_HANDLE;
+    VkPipelineLayout m_bindlessPipelineLayout = VK_NULL_HANDLE;
     std::unordered_map<std::string, VkPipeline> m_pipelines;
 
     
@@ -81,4 +99,5 @@
     // Use the same casing the build copies shaders to (Assets/Shaders)
     static constexpr const char* VERTEX_SHADER_PATH = "Assets/Shaders/mesh_vert.spv";
     static constexpr const char* FRAGMENT_SHADER_PATH = "Assets/Shaders/mesh_frag.spv";
+    static constexpr const char* BINDLESS_VERTEX_SHADER_PATH = "Assets/Shaders/mesh_bindless_vert.spv";
   };
\ No newline at end of file
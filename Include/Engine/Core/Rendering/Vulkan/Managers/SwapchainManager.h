@@ -1,4 +1,5 @@
 #pragma once
+#include <atomic>
 #include <memory>
 #include <vector>
 
@@ -7,14 +8,11 @@
 #include "Engine/Core/Rendering/Vulkan/Utils/VulkanUtils.h"
 #include "vulkan/vulkan.h"
 
-// Forward declare SDL type
-struct SDL_Window;
-
 
   class SwapchainManager
   {
    public:
-    SwapchainManager(VkInstance instance, VkSurfaceKHR surface, std::shared_ptr<DeviceManager> deviceManager, SDL_Window* window);
+    SwapchainManager(VkInstance instance, VkSurfaceKHR surface, std::shared_ptr<DeviceManager> deviceManager);
     ~SwapchainManager();
 
     
@@ -25,6 +23,14 @@ struct SDL_Window;
     void Cleanup();
     void RecreateSwapchain();
 
+    // Размер окна в пикселях с главного потока: при создании окна и из событий SDL.
+    // Пересоздание swapchain идет и на рендер потоке, поэтому само SDL не опрашивает.
+    // Ширина и высота публикуются одним словом, чтобы не прочитать их из разных событий
+    void SetWindowExtent(uint32_t width, uint32_t height)
+    {
+      m_windowExtent.store((static_cast<uint64_t>(width) << 32) | height, std::memory_order_relaxed);
+    }
+
     // Getters
     VkSwapchainKHR GetSwapchain() const
     {
@@ -102,6 +108,5 @@ struct SDL_Window;
     VkImageView m_depthImageView = VK_NULL_HANDLE;
 
     VkRenderPass m_renderPass = VK_NULL_HANDLE;
-    // Window pointer used to query actual framebuffer size when needed
-    SDL_Window* m_window = nullptr;
+    std::atomic<uint64_t> m_windowExtent{0};  // width << 32 | height
   };
\ No newline at end of file
@@ -0,0 +1,58 @@
+#pragma once
+#include <memory>
+#include <string>
+
+#include "CoreMinimal.h"
+#include "Engine/Core/Rendering/Vulkan/Managers/BufferManager.h"
+#include "Engine/Core/Rendering/Vulkan/Managers/DeviceManager.h"
+#include "vulkan/vulkan.h"
+
+  // Кольцевой uniform буфер: по одному региону на кадр в полете, память отображена постоянно.
+  // Данные кадра линейно выделяются из его региона и привязываются через dynamic offset,
+  // поэтому запись не пересекается с кадрами, которые GPU еще читает.
+  class UniformRingBuffer
+  {
+   public:
+    UniformRingBuffer(std::shared_ptr<DeviceManager> deviceManager, std::shared_ptr<BufferManager> bufferManager);
+    ~UniformRingBuffer();
+
+    UniformRingBuffer(const UniformRingBuffer&) = delete;
+    UniformRingBuffer& operator=(const UniformRingBuffer&) = delete;
+
+    bool Initialize(const std::string& name, VkDeviceSize frameSize, uint32_t frameCount);
+    void Shutdown();
+
+    // Сбрасывает курсор на начало региона кадра; вызывать после ожидания фенса этого кадра
+    void BeginFrame(uint32_t frameIndex);
+
+    // Возвращает место для записи и смещение для vkCmdBindDescriptorSets; nullptr если регион кадра исчерпан
+    void* Allocate(VkDeviceSize size, uint32_t& outOffset);
+
+    template <typename T>
+    bool Push(const T& value, uint32_t& outOffset)
+    {
+      void* data = Allocate(sizeof(T), outOffset);
+      if (!data)
+      {
+        return false;
+      }
+      memcpy(data, &value, sizeof(T));
+      return true;
+    }
+
+    const std::string& GetName() const { return m_name; }
+    BufferHandle GetHandle() const { return m_buffer; }
+    VkBuffer GetBuffer() const { return m_bufferManager->GetBuffer(m_buffer); }
+
+   private:
+    std::shared_ptr<DeviceManager> m_deviceManager;
+    std::shared_ptr<BufferManager> m_bufferManager;
+
+    std::string m_name;
+    BufferHandle m_buffer;
+    uint8_t* m_mappedData = nullptr;
+    VkDeviceSize m_alignment = 1;
+    VkDeviceSize m_frameSize = 0;
+    VkDeviceSize m_cursor = 0;
+    VkDeviceSize m_frameEnd = 0;
+  };
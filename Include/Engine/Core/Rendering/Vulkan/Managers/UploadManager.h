@@ -0,0 +1,92 @@
+#pragma once
+#include <algorithm>
+#include <deque>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "CoreMinimal.h"
+#include "Engine/Core/Rendering/Vulkan/Managers/BufferManager.h"
+#include "Engine/Core/Rendering/Vulkan/Managers/DeviceManager.h"
+#include "vulkan/vulkan.h"
+
+  // Асинхронная загрузка данных в device-local буферы.
+  // Копирования за кадр копятся в одном command buffer и уходят одним submit в transfer очередь
+  // (отдельную, если устройство ее предоставляет). Данные лежат в постоянно отображенном
+  // staging кольце; завершение отслеживается фенсом, без vkQueueWaitIdle.
+  class UploadManager
+  {
+   public:
+    UploadManager(std::shared_ptr<DeviceManager> deviceManager, std::shared_ptr<BufferManager> bufferManager);
+    ~UploadManager();
+
+    UploadManager(const UploadManager&) = delete;
+    UploadManager& operator=(const UploadManager&) = delete;
+
+    bool Initialize(VkDeviceSize stagingSize, uint32_t maxBatchesInFlight);
+    void Shutdown();
+
+    // Ставит копирование в текущую партию. Возвращает тикет партии, 0 при ошибке
+    uint64_t UploadBuffer(VkBuffer dstBuffer, const void* data, VkDeviceSize size, VkDeviceSize dstOffset = 0);
+
+    // Отправляет накопленную партию; вызывать раз в кадр
+    void Submit();
+
+    // Забирает завершенные партии и освобождает их место в staging кольце
+    void Update();
+
+    bool IsComplete(uint64_t ticket) const { return ticket <= m_completedTicket && !IsFailed(ticket); }
+    // Партия не ушла в очередь: копии не выполнены, данные нужно загрузить заново
+    bool IsFailed(uint64_t ticket) const
+    {
+      return std::binary_search(m_failedTickets.begin(), m_failedTickets.end(), ticket);
+    }
+    // Забирает тикеты неотправленных партий, после чего IsFailed о них забывает.
+    // Вызывать после Submit каждого кадра и снимать всех владельцев этих тикетов
+    void TakeFailedTickets(std::vector<uint64_t>& outTickets);
+    bool HasPendingUploads() const { return m_recording || !m_inFlight.empty(); }
+
+    // Блокирующе дожидается всех отправленных партий
+    void WaitIdle();
+
+   private:
+    struct UploadBatch
+    {
+      VkCommandBuffer commandBuffer = VK_NULL_HANDLE;
+      VkFence fence = VK_NULL_HANDLE;
+      uint64_t ticket = 0;
+      VkDeviceSize stagingStart = 0;  // голова кольца до первой копии партии
+      VkDeviceSize stagingBytes = 0;  // занято в кольце, включая хвост при переходе через конец
+      std::vector<BufferHandle> oversizedStaging;  // данные крупнее кольца - временные staging буферы
+      bool inFlight = false;
+    };
+
+    bool BeginBatch();
+    bool AllocateStaging(VkDeviceSize size, VkDeviceSize& outOffset);
+    void RetireBatch(UploadBatch& batch);
+    void RetireOldestBatch(bool wait);
+    void DiscardBatch(UploadBatch& batch);
+
+   private:
+    std::shared_ptr<DeviceManager> m_deviceManager;
+    std::shared_ptr<BufferManager> m_bufferManager;
+
+    VkQueue m_queue = VK_NULL_HANDLE;
+    VkCommandPool m_commandPool = VK_NULL_HANDLE;
+
+    BufferHandle m_stagingHandle;
+    VkBuffer m_stagingBuffer = VK_NULL_HANDLE;
+    uint8_t* m_stagingData = nullptr;
+    VkDeviceSize m_stagingSize = 0;
+    VkDeviceSize m_stagingHead = 0;
+    VkDeviceSize m_stagingUsed = 0;
+
+    std::vector<UploadBatch> m_batches;
+    std::deque<uint32_t> m_inFlight;  // индексы партий в порядке отправки
+    uint32_t m_currentBatch = 0;
+    bool m_recording = false;
+
+    uint64_t m_nextTicket = 1;
+    uint64_t m_completedTicket = 0;
+    std::vector<uint64_t> m_failedTickets;  // по возрастанию, до TakeFailedTickets
+  };
@@ -0,0 +1,119 @@
+#pragma once
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+  // Типизированный хэндл ресурса: индекс слота в плотном массиве и поколение слота.
+  // Поколение меняется при освобождении, поэтому устаревший хэндл не попадает в чужой ресурс.
+  // Tag только различает типы: BufferHandle нельзя передать туда, где ждут MeshHandle.
+  template <typename Tag>
+  struct ResourceHandle
+  {
+    uint32_t index = 0;
+    uint32_t generation = 0;  // 0 - невалидный хэндл
+
+    bool IsValid() const { return generation != 0; }
+    explicit operator bool() const { return IsValid(); }
+
+    bool operator==(const ResourceHandle& other) const { return index == other.index && generation == other.generation; }
+    bool operator!=(const ResourceHandle& other) const { return !(*this == other); }
+  };
+
+  // Плотный массив слотов с повторным использованием освобожденных индексов.
+  // Поиск по хэндлу - индексация и сравнение поколения, без хеширования и аллокаций.
+  template <typename T, typename Tag>
+  class ResourcePool
+  {
+   public:
+    using Handle = ResourceHandle<Tag>;
+
+    Handle Create(T&& value)
+    {
+      uint32_t index;
+      if (!m_freeSlots.empty())
+      {
+        index = m_freeSlots.back();
+        m_freeSlots.pop_back();
+      }
+      else
+      {
+        index = static_cast<uint32_t>(m_slots.size());
+        m_slots.emplace_back();
+      }
+
+      Slot& slot = m_slots[index];
+      slot.value = std::move(value);
+      slot.alive = true;
+      ++m_liveCount;
+      return Handle{index, slot.generation};
+    }
+
+    T* Get(Handle handle)
+    {
+      return IsAlive(handle) ? &m_slots[handle.index].value : nullptr;
+    }
+
+    const T* Get(Handle handle) const
+    {
+      return IsAlive(handle) ? &m_slots[handle.index].value : nullptr;
+    }
+
+    bool IsAlive(Handle handle) const
+    {
+      return handle.index < m_slots.size() && m_slots[handle.index].alive &&
+             m_slots[handle.index].generation == handle.generation;
+    }
+
+    // Освобождает слот; возвращает false для устаревшего или пустого хэндла
+    bool Destroy(Handle handle)
+    {
+      if (!IsAlive(handle))
+      {
+        return false;
+      }
+
+      Slot& slot = m_slots[handle.index];
+      slot.value = T{};
+      slot.alive = false;
+      // 0 зарезервирован под невалидный хэндл
+      slot.generation = slot.generation == UINT32_MAX ? 1 : slot.generation + 1;
+      m_freeSlots.push_back(handle.index);
+      --m_liveCount;
+      return true;
+    }
+
+    // Обходит живые слоты: func(Handle, T&)
+    template <typename Func>
+    void ForEach(Func&& func)
+    {
+      for (uint32_t index = 0; index < m_slots.size(); ++index)
+      {
+        if (m_slots[index].alive)
+        {
+          func(Handle{index, m_slots[index].generation}, m_slots[index].value);
+        }
+      }
+    }
+
+    void Clear()
+    {
+      m_slots.clear();
+      m_freeSlots.clear();
+      m_liveCount = 0;
+    }
+
+    uint32_t Size() const { return m_liveCount; }
+    bool Empty() const { return m_liveCount == 0; }
+
+   private:
+    struct Slot
+    {
+      T value{};
+      uint32_t generation = 1;
+      bool alive = false;
+    };
+
+    std::vector<Slot> m_slots;
+    std::vector<uint32_t> m_freeSlots;
+    uint32_t m_liveCount = 0;
+  };
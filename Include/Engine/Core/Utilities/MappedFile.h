@@ -0,0 +1,53 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+/**
+ * @class CMappedFile
+ * @brief Файл, отображенный в память только для чтения
+ *
+ * Данные доступны через GetData() без копирования, пока объект жив.
+ * Пустой файл открывается успешно, но GetData() возвращает nullptr.
+ */
+class CMappedFile
+{
+ public:
+  CMappedFile() = default;
+  ~CMappedFile();
+
+  CMappedFile(const CMappedFile&) = delete;
+  CMappedFile& operator=(const CMappedFile&) = delete;
+  CMappedFile(CMappedFile&& other) noexcept;
+  CMappedFile& operator=(CMappedFile&& other) noexcept;
+
+  bool Open(const std::string& filePath);
+  void Close();
+
+  bool IsOpen() const
+  {
+    return m_IsOpen;
+  }
+  const char* GetData() const
+  {
+    return m_Data;
+  }
+  size_t GetSize() const
+  {
+    return m_Size;
+  }
+
+ private:
+  void MoveFrom(CMappedFile& other) noexcept;
+
+  const char* m_Data = nullptr;
+  size_t m_Size = 0;
+  bool m_IsOpen = false;
+
+#ifdef _WIN32
+  void* m_File = nullptr;
+  void* m_Mapping = nullptr;
+#else
+  int m_Descriptor = -1;
+#endif
+};
@@ -0,0 +1,90 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "Engine/Core/Rendering/Data/Vertex.h"
+
+using FMeshAssetId = uint32_t;
+constexpr FMeshAssetId INVALID_MESH_ASSET_ID = 0;
+
+/**
+ * @brief Неизменяемый меш, общий для всех компонентов, которые его используют
+ */
+struct FMeshAsset
+{
+  FMeshAssetId Id = INVALID_MESH_ASSET_ID;
+  std::string Name;          ///< путь к файлу или имя процедурного меша
+  uint64_t ContentHash = 0;  ///< хеш вершин и индексов
+  FStaticMesh Mesh;
+};
+
+using FMeshAssetRef = std::shared_ptr<const FMeshAsset>;
+
+/**
+ * @class CMeshAssetRegistry
+ * @brief Реестр мешей со счетчиком ссылок
+ *
+ * Меш загружается один раз на путь и один раз на содержимое: одинаковые данные
+ * под разными именами дают один и тот же ассет. Реестр хранит только weak_ptr,
+ * ассет живет, пока на него ссылается хотя бы один компонент. Id не переиспользуются,
+ * поэтому рендер может ключевать по ним GPU буферы.
+ */
+class CMeshAssetRegistry
+{
+ public:
+  static CMeshAssetRegistry& Get();
+
+  /**
+   * @brief Возвращает ассет для файла, загружая его (запеченный или OBJ) при первом обращении
+   * @return nullptr если файл не загрузился или пуст
+   */
+  FMeshAssetRef Load(const std::string& path);
+
+  /**
+   * @brief Регистрирует меш, созданный в коде; совпадающее содержимое переиспользуется
+   * @param name Имя для отладки, в поиске по пути не участвует
+   */
+  FMeshAssetRef Register(const std::string& name, FStaticMesh&& mesh);
+
+  /**
+   * @brief Забирает Id ассетов, на которые больше никто не ссылается
+   *
+   * Вызывается владельцем GPU ресурсов, чтобы освободить буферы освобожденных мешей.
+   */
+  void CollectReleased(std::vector<FMeshAssetId>& outReleased);
+
+  /**
+   * @brief Живой ассет по Id или nullptr, если на него больше никто не ссылается
+   *
+   * Для потребителей, которые знают только Id и сырой указатель, например рендер поток:
+   * пока ассет удерживается возвращенной ссылкой, его данные можно читать.
+   */
+  FMeshAssetRef Find(FMeshAssetId id) const;
+
+  size_t GetLiveAssetCount() const;
+
+  static uint64_t HashMesh(const FStaticMesh& mesh);
+
+ private:
+  CMeshAssetRegistry() = default;
+
+  struct FEntry
+  {
+    std::weak_ptr<const FMeshAsset> Asset;
+    uint64_t ContentHash = 0;
+  };
+
+  FMeshAssetRef FindLiveByHash(uint64_t hash, const FStaticMesh& mesh) const;
+  FMeshAssetRef Insert(const std::string& name, uint64_t hash, FStaticMesh&& mesh);
+
+  mutable std::mutex m_Mutex;
+  FMeshAssetId m_NextId = 1;
+  std::unordered_map<FMeshAssetId, FEntry> m_Entries;
+  std::unordered_map<std::string, FMeshAssetId> m_ByName;
+  std::unordered_multimap<uint64_t, FMeshAssetId> m_ByHash;
+};
@@ -0,0 +1,126 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+
+#include "Engine/Core/Rendering/Data/Vertex.h"
+#include "Engine/Core/Utilities/MappedFile.h"
+
+/**
+ * @brief Заголовок запеченного меша (.cemesh)
+ *
+ * Раскладка файла: заголовок, блок вершин в формате Vertex, блок индексов
+ * (uint16 если вершин не больше 65536, иначе uint32). Блоки выровнены по 16 байт.
+ * Порядок байт - родной для платформы (little-endian).
+ */
+struct FCookedMeshHeader
+{
+  static constexpr uint32_t MAGIC = 0x484D4543;  // "CEMH"
+  static constexpr uint32_t VERSION = 1;
+
+  uint32_t Magic = MAGIC;
+  uint32_t Version = VERSION;
+  uint32_t VertexStride = sizeof(Vertex);
+  uint32_t IndexSize = sizeof(uint32_t);
+  uint32_t VertexCount = 0;
+  uint32_t IndexCount = 0;
+  uint64_t VertexOffset = 0;
+  uint64_t IndexOffset = 0;
+  float BoundsMin[3] = {0.0f, 0.0f, 0.0f};
+  float BoundsMax[3] = {0.0f, 0.0f, 0.0f};
+};
+static_assert(sizeof(FCookedMeshHeader) == 64, "FCookedMeshHeader layout is part of the file format");
+
+/**
+ * @class CCookedMesh
+ * @brief Запеченный меш, отображенный в память
+ *
+ * Вершины и индексы отдаются как span прямо из отображения без разбора;
+ * данные валидны, пока объект жив.
+ */
+class CCookedMesh
+{
+ public:
+  /**
+   * @brief Открывает .cemesh и проверяет заголовок
+   * @return false если файл не найден, поврежден или записан другой версией/раскладкой Vertex
+   */
+  bool Open(const std::string& filePath);
+  void Close();
+
+  bool IsOpen() const
+  {
+    return m_Header != nullptr;
+  }
+
+  std::span<const Vertex> GetVertices() const;
+  uint32_t GetIndexSize() const
+  {
+    return m_Header ? m_Header->IndexSize : 0;
+  }
+  uint32_t GetIndexCount() const
+  {
+    return m_Header ? m_Header->IndexCount : 0;
+  }
+  std::span<const uint16_t> GetIndices16() const;
+  std::span<const uint32_t> GetIndices32() const;
+
+  FVector GetBoundsMin() const;
+  FVector GetBoundsMax() const;
+
+  /**
+   * @brief Копирует данные в FStaticMesh (memcpy вершин, расширение индексов до uint32)
+   *
+   * Копия нужна: FStaticMesh живет в кэше ассетов и переживает отображение файла,
+   * а загрузка на GPU идет позже, при первой отрисовке меша
+   */
+  FStaticMesh ToStaticMesh() const;
+
+ private:
+  CMappedFile m_File;
+  const FCookedMeshHeader* m_Header = nullptr;
+};
+
+/**
+ * @class MeshCooker
+ * @brief Запекание OBJ в бинарный формат и загрузка мешей с учетом запеченных версий
+ */
+class MeshCooker
+{
+ public:
+  /**
+   * @brief Путь запеченного файла для исходника: Meshes/Foo.obj -> Meshes/Foo.cemesh
+   */
+  static std::string GetCookedPath(const std::string& sourcePath);
+
+  /**
+   * @brief Записывает меш в .cemesh (через временный файл, чтобы не оставить обрезанный)
+   */
+  static bool WriteCooked(const FStaticMesh& mesh, const std::string& cookedPath);
+
+  /**
+   * @brief Загружает OBJ и запекает его рядом с исходником (или в cookedPath)
+   */
+  static bool CookOBJ(const std::string& sourcePath, const std::string& cookedPath = "");
+
+  /**
+   * @brief Запекает все .obj в каталоге, у которых запеченная версия отсутствует или устарела
+   * @return Количество запеченных файлов
+   */
+  static uint32_t CookDirectory(const std::string& directory, bool force = false);
+
+  /**
+   * @brief Загружает меш: запеченный файл, если он не старше исходника, иначе разбирает OBJ
+   */
+  static FStaticMesh LoadMesh(const std::string& sourcePath);
+
+  /**
+   * @brief true если запеченный файл существует и не старше исходника (или исходника нет)
+   */
+  static bool IsCookedUpToDate(const std::string& sourcePath, const std::string& cookedPath);
+
+ private:
+  MeshCooker() = default;
+};
@@ -1,13 +1,27 @@
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
 #include <string>
 #include <vector>
 
 #include "Engine/Core/Rendering/Data/Vertex.h"
 
+/**
+ * @brief Параметры загрузки OBJ
+ */
+struct FObjLoadSettings
+{
+  uint32_t MaxThreads = 0;                   ///< 0 = std::thread::hardware_concurrency()
+  size_t MinChunkBytes = 1024 * 1024;        ///< файлы меньше этого размера разбираются в одном потоке
+};
+
 /**
  * @class ObjLoader
  * @brief Загрузчик OBJ файлов для импорта 3D моделей
+ *
+ * Файл отображается в память и разбирается кусками по строкам параллельно.
+ * Вершины дедуплицируются по тройке индексов позиция/uv/нормаль.
  */
 class ObjLoader
 {
@@ -18,6 +32,14 @@ class ObjLoader
    * @return StaticMesh с загруженными вершинами и индексами, или пустой меш при ошибке
    */
   static FStaticMesh LoadOBJ(const std::string& filePath);
+  static FStaticMesh LoadOBJ(const std::string& filePath, const FObjLoadSettings& settings);
+
+  /**
+   * @brief Разбирает OBJ из буфера в памяти
+   * @param name Имя источника для сообщений лога
+   */
+  static FStaticMesh ParseOBJ(const char* data, size_t size, const FObjLoadSettings& settings,
+                              const std::string& name = "<memory>");
 
  private:
   ObjLoader() = default;
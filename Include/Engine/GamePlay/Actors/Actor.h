@@ -53,12 +53,31 @@ class CActor : public CObject
     virtual void Update(float DeltaTime) override;
     virtual void Tick(float DeltaTime) override;
 
+    // Группа, интервал, флаги и пререквизиты тика актора; компоненты тикают отдельно
+    FTickFunction& GetPrimaryTick()
+    {
+      return m_PrimaryTick;
+    }
+
+    // Потокобезопасный тик: актор меняет только свои компоненты и трансформации, поэтому
+    // CLevel тикает его на пуле задач вместе с другими такими акторами.
+    // Спавн, удаление и аттач к чужим компонентам из такого тика запрещены; логировать можно
+    void SetTickInParallel(bool bEnabled)
+    {
+      m_PrimaryTick.SetTickInParallel(bEnabled);
+    }
+    bool CanTickInParallel() const
+    {
+      return m_PrimaryTick.CanTickInParallel();
+    }
+
     FVector Location = FVector(0.0f);
     FVector Rotation = FVector(0.0f);
     FVector Scale = FVector(1.0f);
 
   protected:
     CSceneComponent* m_RootComponent = nullptr;
+    FTickFunction m_PrimaryTick{this};
 
 
   };
@@ -80,14 +99,22 @@ class CActor : public CObject
     auto* component = AddSubObject<T>(Name, std::forward<Args>(args)...);
 
     // Авто-аттач только для SceneComponent
-    if (m_RootComponent && component != m_RootComponent)
+    if constexpr (std::is_base_of_v<CSceneComponent, T>)
     {
-      if (auto* sceneComp = dynamic_cast<CSceneComponent*>(component))
+      if (m_RootComponent && component != m_RootComponent)
       {
-        sceneComp->AttachToComponent(m_RootComponent);
+        component->AttachToComponent(m_RootComponent);
         CORE_DEBUG("Auto-attached ", Name, " to root component");
       }
     }
 
+    if constexpr (std::is_base_of_v<CComponent, T>)
+    {
+      if (CLevel* Level = GetLevel())
+      {
+        Level->RegisterComponent(component);
+      }
+    }
+
     return component;
   }
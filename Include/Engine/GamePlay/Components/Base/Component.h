@@ -1,12 +1,36 @@
 #pragma once
+#include <vector>
+
 #include "Engine/Core/Object.h"
+#include "Engine/GamePlay/World/TickScheduler.h"
+
+class CComponentRegistry;
 
 class CComponent : public CObject
 {
+  CE_DECLARE_CLASS(CComponent, CObject)
+
  public:
   CComponent(CObject* Owner = nullptr, FString NewName = "Component");
-  virtual ~CComponent() = default;
+  virtual ~CComponent();
   virtual void Update(float DeltaTime) override;
   virtual void BeginPlay() override;
   virtual void Tick(float DeltaTime) override;
+
+  // Тик компонента в расписании уровня, независимый от тика актора-владельца
+  FTickFunction& GetPrimaryTick()
+  {
+    return m_PrimaryTick;
+  }
+
+ protected:
+  FTickFunction m_PrimaryTick{this};
+
+ private:
+  friend class CComponentRegistry;
+
+  // Учет в CComponentRegistry уровня: позиция в списке каждого типа от своего класса к корню
+  CComponentRegistry* m_Registry = nullptr;
+  const ClassInfo* m_RegisteredClass = nullptr;
+  std::vector<uint32_t> m_RegistrySlots;
 };
@@ -5,6 +5,8 @@
 
   class CCameraComponent : public CSceneComponent
   {
+    CE_DECLARE_CLASS(CCameraComponent, CSceneComponent)
+
    public:
     CCameraComponent(CObject* Owner = nullptr, FString NewName = "CameraComponent");
     virtual ~CCameraComponent() = default;
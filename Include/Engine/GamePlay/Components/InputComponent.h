@@ -10,6 +10,8 @@
 
 class CInputComponent : public CComponent
 {
+    CE_DECLARE_CLASS(CInputComponent, CComponent)
+
 public:
     CInputComponent(CObject* Owner = nullptr, FString NewName = "InputComponent");
     virtual ~CInputComponent();
@@ -1,5 +1,6 @@
 #pragma once
 #include "Engine/Core/Rendering/Data/Vertex.h"
+#include "Engine/Core/Utilities/MeshAssetRegistry.h"
 #include "Engine/GamePlay/Components/SceneComponent.h"
 
 
@@ -11,6 +12,8 @@
 
   class CMeshComponent : public CSceneComponent
   {
+    CE_DECLARE_CLASS(CMeshComponent, CSceneComponent)
+
    public:
     CMeshComponent(CObject* Owner = nullptr, FString NewName = "MeshComponent");
     virtual ~CMeshComponent() = default;
@@ -21,39 +24,45 @@
     // Для ручного создания меша (пока заглушка для куба)
     void CreateCubeMesh();
 
-    // Установка статического меша напрямую
-    void SetStaticMesh(const FStaticMesh& Mesh)
-    {
-      m_Mesh = Mesh;
-    }
+    // Установка статического меша напрямую (регистрируется в CMeshAssetRegistry,
+    // одинаковые меши разных компонентов хранятся один раз)
+    void SetStaticMesh(const FStaticMesh& Mesh);
+    void SetMeshAsset(FMeshAssetRef Asset);
 
     // Получение данных для рендеринга
-    const FStaticMesh& GetMeshData() const
+    const FStaticMesh& GetMeshData() const;
+    const FMeshAssetRef& GetMeshAsset() const
+    {
+      return m_MeshAsset;
+    }
+    FMeshAssetId GetMeshAssetId() const
     {
-      return m_Mesh;
+      return m_MeshAsset ? m_MeshAsset->Id : INVALID_MESH_ASSET_ID;
     }
     FMatrix GetRenderTransform() const;
 
-    // Цвет материала (временно)
+    virtual bool GetLocalBounds(FBox& OutBounds) const override;
+
+    // Цвет материала (временно), свой у каждого компонента
     void SetColor(const FVector& color)
     {
-      m_Mesh.color = color;
+      m_Color = color;
     }
     void SetColor(const FLinearColor& color)
     {
-      m_Mesh.color = color.toRGB();
+      m_Color = color.toRGB();
     }
     const FVector& GetColor() const
     {
-      return m_Mesh.color;
+      return m_Color;
     }
 
-    virtual void Update(float DeltaTime) override;
-
    protected:
+    // Смена меша меняет границы: помечаем трансформацию, чтобы уровень обновил индекс
+    void OnMeshChanged();
+
     std::string m_MeshPath;
     std::string m_MaterialPath;
-    FStaticMesh m_Mesh;
-
-    void UpdateMeshTransform();
+    FMeshAssetRef m_MeshAsset;
+    FVector m_Color{1.0f, 1.0f, 1.0f};
   };
\ No newline at end of file
@@ -3,13 +3,18 @@
 
 #include "Engine/Core/CoreTypes.h"
 #include "Engine/GamePlay/Components/Base/Component.h"
+#include "Engine/GamePlay/World/TransformStore.h"
+
+class CLevel;
 
 
   class CSceneComponent : public CComponent
   {
+    CE_DECLARE_CLASS(CSceneComponent, CComponent)
+
    public:
     CSceneComponent(CObject* Owner = nullptr, FString NewName = "SceneComponent");
-    virtual ~CSceneComponent() = default;
+    virtual ~CSceneComponent();
 
     // position methods
     void SetPosition(const FVector& Position);
@@ -35,16 +40,33 @@
     void SetRelativeScale(float value);
 
     // getters
-    const FVector& GetPosition() const;
-    const FVector& GetRelativePosition() const;
-    const FVector& GetRotation() const;
+    FVector GetPosition() const;
+    FVector GetRelativePosition() const;
+    FVector GetRotation() const;
     const FVector& GetRelativeRotation() const;
-    const FVector& GetScale() const;
-    const FVector& GetRelativeScale() const;
-    const FMatrix& GetTransformMatrix() const;
+    FVector GetScale() const;
+    FVector GetRelativeScale() const;
+    FMatrix GetTransformMatrix() const;
 
+    // Мировая матрица кэшируется в CTransformStore и пересчитывается только после изменений.
+    // Копией: массивы хранилища растут и переставляются при создании и смене родителя узлов
     FMatrix GetWorldTransform() const;
     FVector GetWorldLocation() const;
+    bool IsWorldTransformDirty() const
+    {
+      return Transforms().IsDirty(m_TransformHandle);
+    }
+    FTransformHandle GetTransformHandle() const
+    {
+      return m_TransformHandle;
+    }
+
+    // Локальные границы для пространственного индекса уровня; false - компонент не имеет объема
+    virtual bool GetLocalBounds(FBox& OutBounds) const
+    {
+      (void)OutBounds;
+      return false;
+    }
 
     // Direction vectors
     FVector GetForwardVector() const;
@@ -57,9 +79,9 @@
     void SetPitchLimits(float MinPitch, float MaxPitch);
 
     // Quaternion access
-    const FQuat& GetRotationQuat() const
+    FQuat GetRotationQuat() const
     {
-      return m_RotationQuat;
+      return Transforms().LocalRotation(m_TransformHandle);
     }
 
     // Hierarchy
@@ -84,6 +106,11 @@
 
    protected:
     void UpdateTransformMatrix();
+    void MarkWorldTransformDirty();
+    CTransformStore& Transforms() const
+    {
+      return CTransformStore::Get();
+    }
     void UpdateRotationFromQuat();
     void UpdateQuatFromRotation();
     void AddChild(CSceneComponent* Child);
@@ -93,32 +120,28 @@
     void ClampPitchRotation();
     bool WouldCreateCycle(CSceneComponent* PotentialParent) const;
 
-    // relative transforms
-    FVector m_RelativeLocation{0.0f, 0.0f, 0.0f};
-    FVector m_RelativeRotation{0.0f, 0.0f, 0.0f};
-    FVector m_RelativeScale{1.0f, 1.0f, 1.0f};
-
-    // world transforms
-    FVector m_WorldRotation{0.0f, 0.0f, 0.0f};
-    FVector m_WorldScale{1.0f, 1.0f, 1.0f};
-    FVector m_WorldLocation{0.0f, 0.0f, 0.0f};
+    // Позиция, вращение, масштаб и мировая матрица живут в CTransformStore.
+    // Если узел грязный, то всё его поддерево тоже грязное.
+    FTransformHandle m_TransformHandle = INVALID_TRANSFORM_HANDLE;
 
-    // matrix
-    FMatrix m_TransformMatrix;
+    // euler углы (градусы) для ограничения pitch
+    FVector m_RelativeRotation{0.0f, 0.0f, 0.0f};
 
     // hierarchy
     CSceneComponent* m_Parent = nullptr;
     std::vector<CSceneComponent*> m_Children;
 
-    // quaternion for rotation
-    FQuat m_RotationQuat = FQuat::Identity();
-
       bool m_IsUpdating = false;
-    mutable bool m_IsComputingWorldTransform = false;
     uint32_t m_UpdateDepth = 0;
     // pitch rotation limits
     float m_MinPitch = -89.0f;
     float m_MaxPitch = 89.0f;
     bool m_UsePitchLimits = false;
     friend class CSpringArmComponent;
+
+   private:
+    friend class CLevel;
+
+    // Уровень, в индексе которого лежит компонент; деструктор снимает с него лист
+    CLevel* m_Level = nullptr;
   };
\ No newline at end of file
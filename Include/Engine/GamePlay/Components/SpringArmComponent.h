@@ -5,6 +5,8 @@
 
   class CSpringArmComponent : public CSceneComponent
   {
+    CE_DECLARE_CLASS(CSpringArmComponent, CSceneComponent)
+
    public:
     CSpringArmComponent(CObject* Owner = nullptr, FString NewName = "SpringArmComponent");
     virtual ~CSpringArmComponent() = default;
@@ -8,6 +8,8 @@
 
   class CStaticMeshComponent : public CMeshComponent
   {
+    CE_DECLARE_CLASS(CStaticMeshComponent, CMeshComponent)
+
    public:
     CStaticMeshComponent(CObject* Owner = nullptr, FString NewName = "CEStaticMeshComponent");
     virtual ~CStaticMeshComponent() = default;
@@ -0,0 +1,37 @@
+#pragma once
+
+#include "Engine/Core/CoreTypes.h"
+#include "Engine/Core/Rendering/Data/Vertex.h"
+#include "Engine/Core/Utilities/MeshAssetRegistry.h"
+
+// Компоненты сущностей CEntityManager: простые структуры без конструкторов-деструкторов,
+// чанки копируют их побайтно
+
+struct FEntityTransform
+{
+  FQuat Rotation;
+  FVector Position{0.0f};
+  FVector Scale{1.0f};
+};
+
+struct FEntityVelocity
+{
+  FVector Linear{0.0f};
+};
+
+// Сущность удаляется, когда время жизни доходит до нуля
+struct FEntityLifetime
+{
+  float Remaining = 0.0f;
+};
+
+// Ссылка на меш без счетчика: ассет держит CEntityManager::MakeMesh
+struct FEntityMesh
+{
+  const FStaticMesh* Mesh = nullptr;
+  FMeshAssetId MeshId = INVALID_MESH_ASSET_ID;
+  FVector Color{1.0f};
+  // Локальная сфера вокруг меша для отсечения
+  FVector BoundsCenter{0.0f};
+  float BoundsRadius = 0.0f;
+};
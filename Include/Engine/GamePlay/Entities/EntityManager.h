@@ -0,0 +1,367 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+#include "Engine/Core/CoreTypes.h"
+#include "Engine/Core/Jobs/JobSystem.h"
+#include "Engine/GamePlay/Entities/EntityComponents.h"
+
+using FEntityComponentMask = uint64_t;
+constexpr uint32_t MAX_ENTITY_COMPONENT_TYPES = 64;
+constexpr uint32_t ENTITY_CHUNK_SIZE = 16 * 1024;
+
+// Хэндл сущности: слот и его поколение, устаревший хэндл не попадает в новую сущность
+struct FEntity
+{
+  uint32_t Index = 0;
+  uint32_t Generation = 0;  // 0 - невалидная сущность
+
+  bool IsValid() const
+  {
+    return Generation != 0;
+  }
+  bool operator==(const FEntity& Other) const
+  {
+    return Index == Other.Index && Generation == Other.Generation;
+  }
+  bool operator!=(const FEntity& Other) const
+  {
+    return !(*this == Other);
+  }
+};
+
+// Номер типа компонента сущности, выдается один раз на тип при первом обращении
+uint32_t RegisterEntityComponentType(uint32_t Size, uint32_t Alignment);
+
+template <typename T>
+uint32_t GetEntityComponentId()
+{
+  static_assert(std::is_trivially_copyable_v<T>, "Entity components must be plain structs");
+  static_assert(alignof(T) <= 64, "Entity component alignment exceeds chunk alignment");
+  static const uint32_t s_Id = RegisterEntityComponentType(sizeof(T), alignof(T));
+  return s_Id;
+}
+
+// Чанк в выборке запроса: Index - номер чанка среди всех подходящих, Count - живые строки
+struct FEntityChunkView
+{
+  uint32_t Index = 0;
+  uint32_t Count = 0;
+  const FEntity* Entities = nullptr;
+};
+
+/**
+ * @class CEntityManager
+ * @brief Хранилище сущностей по архетипам для объектов, которых слишком много для CActor
+ *
+ * Архетип - набор типов компонентов. Сущности архетипа лежат в чанках по 16 КБ:
+ * в каждом чанке массив хэндлов и по массиву на каждый компонент (SoA), так что системы
+ * идут по памяти подряд. Все чанки архетипа, кроме последнего, заполнены; удаление
+ * переносит последнюю сущность архетипа на место удаленной.
+ *
+ * Структурные изменения (создание, удаление, добавление компонентов) - только с игрового
+ * потока и не во время запросов; из систем удаление откладывается через DestroyEntityDeferred.
+ */
+class CEntityManager
+{
+ public:
+  using FSystem = std::function<void(CEntityManager& Entities, float DeltaTime)>;
+
+  CEntityManager() = default;
+  ~CEntityManager() = default;
+
+  CEntityManager(const CEntityManager&) = delete;
+  CEntityManager& operator=(const CEntityManager&) = delete;
+
+  template <typename... Ts>
+  FEntity CreateEntity(const Ts&... Components);
+  void DestroyEntity(FEntity Entity);
+  // Потокобезопасно: удаление выполняется в FlushDeferred (после систем кадра)
+  void DestroyEntityDeferred(FEntity Entity);
+  void FlushDeferred();
+  void Clear();
+
+  bool IsAlive(FEntity Entity) const;
+  uint32_t GetEntityCount() const
+  {
+    return m_LiveCount;
+  }
+
+  template <typename T>
+  bool HasComponent(FEntity Entity) const;
+  // nullptr, если сущность мертва или компонента нет; указатель живет до структурного изменения
+  template <typename T>
+  T* GetComponent(FEntity Entity);
+  // Переносит сущность в архетип с компонентом T; существующий компонент перезаписывается.
+  // nullptr для мертвой сущности
+  template <typename T>
+  T* AddComponent(FEntity Entity, const T& Component);
+  template <typename T>
+  void RemoveComponent(FEntity Entity);
+
+  // Меш ассета для FEntityMesh; менеджер держит ассет, пока живет сам
+  FEntityMesh MakeMesh(const FMeshAssetRef& Asset, const FVector& Color = FVector(1.0f));
+
+  /**
+   * @brief Body(const FEntityChunkView&, Ts*...) для каждого чанка с компонентами Ts
+   *
+   * const T в списке - только чтение. Порядок чанков и их Index стабильны между
+   * вызовами, пока нет структурных изменений.
+   */
+  template <typename... Ts, typename Fn>
+  void ForEachChunk(Fn&& Body);
+  // То же на CJobSystem: Body вызывается параллельно для разных чанков
+  template <typename... Ts, typename Fn>
+  void ParallelForEachChunk(Fn&& Body);
+
+  // Body(Ts&...) для каждой сущности с компонентами Ts
+  template <typename... Ts, typename Fn>
+  void ForEach(Fn&& Body);
+  template <typename... Ts, typename Fn>
+  void ParallelForEach(Fn&& Body);
+
+  template <typename... Ts>
+  uint32_t CountEntities() const;
+  template <typename... Ts>
+  uint32_t CountChunks() const;
+
+  // Системы выполняются по порядку добавления, затем отложенные удаления
+  void AddSystem(const FString& Name, FSystem System);
+  void RunSystems(float DeltaTime);
+
+ private:
+  struct alignas(64) FChunk
+  {
+    std::byte Data[ENTITY_CHUNK_SIZE];
+  };
+
+  // Массив одного компонента в чанке
+  struct FColumn
+  {
+    uint32_t ComponentId = 0;
+    uint32_t Offset = 0;
+    uint32_t Size = 0;
+  };
+
+  struct FArchetype
+  {
+    FEntityComponentMask Mask = 0;
+    uint32_t Capacity = 0;  // сущностей в чанке
+    uint32_t EntityCount = 0;
+    // Смещение массива компонента в чанке по номеру типа; UINT32_MAX - компонента нет.
+    // Массив хэндлов лежит со смещением 0
+    std::array<uint32_t, MAX_ENTITY_COMPONENT_TYPES> Offsets;
+    std::vector<FColumn> Columns;
+    std::vector<std::unique_ptr<FChunk>> Chunks;
+
+    uint32_t GetChunkCount(uint32_t Chunk) const
+    {
+      return Chunk + 1 < Chunks.size() ? Capacity : EntityCount - Chunk * Capacity;
+    }
+  };
+
+  struct FEntityRecord
+  {
+    uint32_t Archetype = UINT32_MAX;
+    uint32_t Row = 0;  // сквозной номер в архетипе: чанк Row / Capacity
+    uint32_t Generation = 1;
+  };
+
+  struct FChunkRef
+  {
+    FArchetype* Archetype = nullptr;
+    uint32_t Chunk = 0;
+  };
+
+  struct FNamedSystem
+  {
+    FString Name;
+    FSystem System;
+  };
+
+  template <typename... Ts>
+  static FEntityComponentMask MakeMask()
+  {
+    return (FEntityComponentMask(0) | ... | (FEntityComponentMask(1) << GetEntityComponentId<std::remove_cv_t<Ts>>()));
+  }
+
+  template <typename... Ts, typename Fn>
+  static void InvokeChunk(const FChunkRef& Ref, uint32_t Index, Fn& Body)
+  {
+    std::byte* data = Ref.Archetype->Chunks[Ref.Chunk]->Data;
+    FEntityChunkView view;
+    view.Index = Index;
+    view.Count = Ref.Archetype->GetChunkCount(Ref.Chunk);
+    view.Entities = reinterpret_cast<const FEntity*>(data);
+    Body(view, reinterpret_cast<Ts*>(data + Ref.Archetype->Offsets[GetEntityComponentId<std::remove_cv_t<Ts>>()])...);
+  }
+
+  void GatherChunks(FEntityComponentMask Mask, std::vector<FChunkRef>& OutChunks) const;
+  uint32_t FindOrCreateArchetype(FEntityComponentMask Mask);
+  FEntity AllocateEntity(uint32_t Archetype);
+  uint32_t AppendRow(FArchetype& Archetype, FEntity Entity);
+  void RemoveRow(FArchetype& Archetype, uint32_t Row);
+  void MoveToArchetype(FEntity Entity, FEntityComponentMask Mask);
+  void* GetComponentData(const FEntityRecord& Record, uint32_t ComponentId, uint32_t Size) const;
+  const FEntityRecord* FindRecord(FEntity Entity) const;
+
+  std::vector<std::unique_ptr<FArchetype>> m_Archetypes;
+  std::unordered_map<FEntityComponentMask, uint32_t> m_ArchetypeByMask;
+
+  std::vector<FEntityRecord> m_Records;
+  std::vector<uint32_t> m_FreeRecords;
+  uint32_t m_LiveCount = 0;
+
+  std::mutex m_DeferredMutex;
+  std::vector<FEntity> m_DeferredDestroys;
+
+  std::unordered_map<FMeshAssetId, FMeshAssetRef> m_RetainedMeshes;
+  std::vector<FNamedSystem> m_Systems;
+};
+
+template <typename... Ts>
+FEntity CEntityManager::CreateEntity(const Ts&... Components)
+{
+  const FEntity entity = AllocateEntity(FindOrCreateArchetype(MakeMask<Ts...>()));
+  const FEntityRecord& record = m_Records[entity.Index];
+  ((*static_cast<Ts*>(GetComponentData(record, GetEntityComponentId<Ts>(), sizeof(Ts))) = Components), ...);
+  return entity;
+}
+
+template <typename T>
+bool CEntityManager::HasComponent(FEntity Entity) const
+{
+  const FEntityRecord* record = FindRecord(Entity);
+  return record && (m_Archetypes[record->Archetype]->Mask & MakeMask<T>()) != 0;
+}
+
+template <typename T>
+T* CEntityManager::GetComponent(FEntity Entity)
+{
+  const FEntityRecord* record = FindRecord(Entity);
+  return record ? static_cast<T*>(GetComponentData(*record, GetEntityComponentId<T>(), sizeof(T))) : nullptr;
+}
+
+template <typename T>
+T* CEntityManager::AddComponent(FEntity Entity, const T& Component)
+{
+  const FEntityRecord* record = FindRecord(Entity);
+  if (!record)
+    return nullptr;
+
+  if ((m_Archetypes[record->Archetype]->Mask & MakeMask<T>()) == 0)
+  {
+    MoveToArchetype(Entity, m_Archetypes[record->Archetype]->Mask | MakeMask<T>());
+  }
+
+  T* result = GetComponent<T>(Entity);
+  *result = Component;
+  return result;
+}
+
+template <typename T>
+void CEntityManager::RemoveComponent(FEntity Entity)
+{
+  if (HasComponent<T>(Entity))
+  {
+    MoveToArchetype(Entity, m_Archetypes[m_Records[Entity.Index].Archetype]->Mask & ~MakeMask<T>());
+  }
+}
+
+template <typename... Ts, typename Fn>
+void CEntityManager::ForEachChunk(Fn&& Body)
+{
+  const FEntityComponentMask mask = MakeMask<Ts...>();
+  uint32_t index = 0;
+  for (auto& archetype : m_Archetypes)
+  {
+    if ((archetype->Mask & mask) != mask)
+      continue;
+
+    for (uint32_t chunk = 0; chunk < archetype->Chunks.size(); ++chunk)
+    {
+      InvokeChunk<Ts...>(FChunkRef{archetype.get(), chunk}, index++, Body);
+    }
+  }
+}
+
+template <typename... Ts, typename Fn>
+void CEntityManager::ParallelForEachChunk(Fn&& Body)
+{
+  std::vector<FChunkRef> chunks;
+  GatherChunks(MakeMask<Ts...>(), chunks);
+
+  CJobSystem& jobs = CJobSystem::Get();
+  // Несколько кусков на поток: чанки последних архетипов бывают неполными
+  const uint32_t count = static_cast<uint32_t>(chunks.size());
+  const uint32_t chunksPerJob = std::max(1u, count / (jobs.GetConcurrency() * 4));
+  jobs.ParallelFor(count, chunksPerJob, [&chunks, &Body](uint32_t Begin, uint32_t End)
+                   {
+                     for (uint32_t i = Begin; i < End; ++i)
+                     {
+                       InvokeChunk<Ts...>(chunks[i], i, Body);
+                     }
+                   });
+}
+
+template <typename... Ts, typename Fn>
+void CEntityManager::ForEach(Fn&& Body)
+{
+  ForEachChunk<Ts...>([&Body](const FEntityChunkView& Chunk, Ts*... Components)
+                      {
+                        for (uint32_t i = 0; i < Chunk.Count; ++i)
+                        {
+                          Body(Components[i]...);
+                        }
+                      });
+}
+
+template <typename... Ts, typename Fn>
+void CEntityManager::ParallelForEach(Fn&& Body)
+{
+  ParallelForEachChunk<Ts...>([&Body](const FEntityChunkView& Chunk, Ts*... Components)
+                              {
+                                for (uint32_t i = 0; i < Chunk.Count; ++i)
+                                {
+                                  Body(Components[i]...);
+                                }
+                              });
+}
+
+template <typename... Ts>
+uint32_t CEntityManager::CountEntities() const
+{
+  const FEntityComponentMask mask = MakeMask<Ts...>();
+  uint32_t count = 0;
+  for (const auto& archetype : m_Archetypes)
+  {
+    if ((archetype->Mask & mask) == mask)
+    {
+      count += archetype->EntityCount;
+    }
+  }
+  return count;
+}
+
+template <typename... Ts>
+uint32_t CEntityManager::CountChunks() const
+{
+  const FEntityComponentMask mask = MakeMask<Ts...>();
+  uint32_t count = 0;
+  for (const auto& archetype : m_Archetypes)
+  {
+    if ((archetype->Mask & mask) == mask)
+    {
+      count += static_cast<uint32_t>(archetype->Chunks.size());
+    }
+  }
+  return count;
+}
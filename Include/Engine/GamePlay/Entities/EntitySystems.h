@@ -0,0 +1,23 @@
+#pragma once
+
+#include "Engine/GamePlay/Entities/EntityManager.h"
+
+struct FrameRenderData;
+
+// Встроенные системы сущностей; CWorld добавляет Movement и Lifetime в свой CEntityManager
+namespace EntitySystems
+{
+  // FEntityTransform::Position += FEntityVelocity * DeltaTime, параллельно по чанкам
+  void Movement(CEntityManager& Entities, float DeltaTime);
+
+  // Уменьшает FEntityLifetime и откладывает удаление истекших сущностей
+  void Lifetime(CEntityManager& Entities, float DeltaTime);
+
+  /**
+   * @brief Дописывает сущности с FEntityTransform и FEntityMesh в renderObjects
+   *
+   * Frustum == nullptr - без отсечения. Счетчики отсечения копятся в RenderData.culling.
+   * Два параллельных прохода: подсчет видимых по чанкам, затем запись на свои места.
+   */
+  void CollectRenderObjects(CEntityManager& Entities, const FFrustum* Frustum, FrameRenderData& RenderData);
+}  // namespace EntitySystems
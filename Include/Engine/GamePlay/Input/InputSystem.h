@@ -99,6 +99,10 @@ public:
     bool ShouldQuit() const { return m_ShouldQuit; }
     void SetShouldQuit(bool quit) { m_ShouldQuit = quit; }
 
+    // Headless mode: no window, SDL events are not polled
+    bool IsHeadless() const { return m_Headless; }
+    void SetHeadless(bool headless) { m_Headless = headless; }
+
 private:
     CInputSystem();
     ~CInputSystem() = default;
@@ -114,6 +118,7 @@ private:
 
     SDL_Window* m_Window = nullptr;
     bool m_ShouldQuit = false;
+    bool m_Headless = false;
 
     // Registered components
     std::vector<CInputComponent*> m_InputComponents;
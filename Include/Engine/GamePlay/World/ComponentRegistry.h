@@ -0,0 +1,41 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+
+#include "Engine/Core/Object.h"
+
+class CComponent;
+
+// Компоненты уровня по типам: все меши, все камеры и т.д. подряд в памяти.
+// Компонент лежит в списке своего типа и всех предков; удаление переставляет
+// последний компонент списка на место удаленного
+class CComponentRegistry
+{
+ public:
+  CComponentRegistry() = default;
+  ~CComponentRegistry();
+
+  CComponentRegistry(const CComponentRegistry&) = delete;
+  CComponentRegistry& operator=(const CComponentRegistry&) = delete;
+
+  // Повторная регистрация безопасна
+  void Register(CComponent* Component);
+  void Unregister(CComponent* Component);
+  void Clear();
+
+  template <typename T>
+  TComponentView<T> Get() const
+  {
+    static_assert(TIsDeclaredClass<T>, "T must use CE_DECLARE_CLASS");
+    const uint32_t typeId = T::StaticClass().GetTypeId();
+    if (typeId < m_ComponentsByType.size())
+    {
+      return TComponentView<T>(&m_ComponentsByType[typeId]);
+    }
+    return TComponentView<T>();
+  }
+
+ private:
+  // Индекс - ClassInfo::GetTypeId()
+  std::vector<std::vector<CComponent*>> m_ComponentsByType;
+};
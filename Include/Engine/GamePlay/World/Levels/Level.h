@@ -4,8 +4,14 @@
 #include <vector>
 
 #include "Engine/Core/Object.h"
+#include "Engine/GamePlay/World/ComponentRegistry.h"
+#include "Engine/GamePlay/World/SpatialTree.h"
+#include "Engine/GamePlay/World/TickScheduler.h"
+#include "Engine/GamePlay/World/TransformStore.h"
 
 class CActor;
+class CComponent;
+class CSceneComponent;
 
 
 class CLevel : public CObject
@@ -25,7 +31,54 @@ class CLevel : public CObject
     return m_Actors;
   }
 
+  // Пространственный индекс по мировым боксам компонентов акторов уровня
+  const CSpatialTree& GetSpatialIndex() const
+  {
+    return m_SpatialIndex;
+  }
+
+  // Все компоненты типа T и его наследников у акторов уровня, без выделения памяти
+  template <typename T>
+  TComponentView<T> GetAllComponents() const
+  {
+    return m_ComponentRegistry.Get<T>();
+  }
+
+  // Расписание тиков акторов и компонентов уровня
+  CTickScheduler& GetTickScheduler()
+  {
+    return m_TickScheduler;
+  }
+
+  // Ставит актора и его компоненты на учет расписания тиков, списков по типам и индекса;
+  // повторный вызов безопасен.
+  // SpawnActor, BeginPlay уровня и CActor::AddDefaultSubObject делают это сами,
+  // вручную нужно только для компонентов, добавленных через AddSubObject после спавна
+  void RegisterActor(CActor* Actor);
+  void RegisterComponent(CComponent* Component);
+
+  // Обновляет боксы компонентов, чьи трансформации пересчитывались (CTransformStore::GetMovedHandles)
+  void SyncSpatialIndex();
 
+  // Компоненты, чьи мировые боксы пересекают область; результат дописывается в OutComponents
+  void QueryBox(const FBox& Box, std::vector<CSceneComponent*>& OutComponents) const;
+  void QuerySphere(const FSphere& Sphere, std::vector<CSceneComponent*>& OutComponents) const;
+  void QueryFrustum(const FFrustum& Frustum, std::vector<CSceneComponent*>& OutComponents) const;
+
+  // Ближайший компонент, чей мировой бокс пересекает луч; Direction - единичный вектор
+  CSceneComponent* RayCast(const FVector& Origin, const FVector& Direction, float MaxDistance,
+                           float* OutDistance = nullptr) const;
+
+  // Тики с CanTickInParallel() выполняются на CJobSystem в начале своей группы;
+  // выключение возвращает все тики на игровой поток
+  void SetParallelTickEnabled(bool Enabled)
+  {
+    m_TickScheduler.SetParallelTickEnabled(Enabled);
+  }
+  bool IsParallelTickEnabled() const
+  {
+    return m_TickScheduler.IsParallelTickEnabled();
+  }
 
   virtual void BeginPlay() override;
   virtual void Update(float DeltaTime) override;
@@ -34,8 +87,27 @@ class CLevel : public CObject
  protected:
   std::vector<std::unique_ptr<CActor>> m_Actors;
 
+ private:
+  struct FTrackedComponent
+  {
+    CSceneComponent* Component = nullptr;
+    FSpatialProxyId Proxy = INVALID_SPATIAL_PROXY;
+  };
+
+  friend class CSceneComponent;
+
+  void UnregisterActor(CActor* Actor);
+  // Снимает лист и запись компонента; зовет и деструктор CSceneComponent
+  void UntrackSceneComponent(CSceneComponent* Component);
+  void UpdateComponentProxy(FTrackedComponent& Tracked);
 
+  CSpatialTree m_SpatialIndex;
+  // Индекс - FTransformHandle компонента: сдвинутая трансформация находит свой лист без поиска
+  std::vector<FTrackedComponent> m_TrackedComponents;
 
+  // Объявлены после m_Actors: разрушаются раньше акторов и отвязывают их тики и компоненты
+  CTickScheduler m_TickScheduler;
+  CComponentRegistry m_ComponentRegistry;
 };
 
 #include "Engine/GamePlay/Actors/Actor.h"
@@ -50,6 +122,7 @@ T* CLevel::SpawnActor(Args&&... args)
   m_Actors.push_back(std::move(actor));
 
   ptr->BeginPlay();
+  RegisterActor(ptr);
   CORE_DEBUG("Spawned actor: ", ptr->GetName(), " in level: ", GetName());
 
   return ptr;
@@ -0,0 +1,203 @@
+#pragma once
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include "Engine/Core/CoreTypes.h"
+
+using FSpatialProxyId = int32_t;
+constexpr FSpatialProxyId INVALID_SPATIAL_PROXY = -1;
+
+// Динамическое BVH дерево боксов (AABB tree).
+// Листья хранят "толстые" боксы с запасом, поэтому мелкие перемещения не трогают дерево,
+// а переезд листа - это удаление и вставка с AVL поворотами, без перестройки целиком.
+// Вставка выбирает соседа по приросту площади поверхности (SAH).
+class CSpatialTree
+{
+ public:
+  // Запас толстого бокса в мировых единицах
+  static constexpr float FAT_BOUNDS_MARGIN = 0.5f;
+
+  FSpatialProxyId CreateProxy(const FBox& Bounds, void* UserData);
+  void DestroyProxy(FSpatialProxyId Proxy);
+
+  // Возвращает true, если лист переставлен (новый бокс вышел за толстый или сильно сжался)
+  bool MoveProxy(FSpatialProxyId Proxy, const FBox& Bounds);
+
+  void* GetUserData(FSpatialProxyId Proxy) const
+  {
+    return m_Nodes[Proxy].UserData;
+  }
+  const FBox& GetFatBounds(FSpatialProxyId Proxy) const
+  {
+    return m_Nodes[Proxy].Bounds;
+  }
+
+  // Visitor(FSpatialProxyId) -> bool; false прекращает обход
+  template <typename Visitor>
+  void QueryBox(const FBox& Box, Visitor&& Visit) const
+  {
+    Traverse([&Box](const FBox& node) { return node.Intersects(Box); }, Visit);
+  }
+
+  template <typename Visitor>
+  void QuerySphere(const FSphere& Sphere, Visitor&& Visit) const
+  {
+    Traverse([&Sphere](const FBox& node) { return node.IntersectsSphere(Sphere.center, Sphere.radius); }, Visit);
+  }
+
+  template <typename Visitor>
+  void QueryFrustum(const FFrustum& Frustum, Visitor&& Visit) const
+  {
+    Traverse([&Frustum](const FBox& node) { return Frustum.IntersectsBox(node); }, Visit);
+  }
+
+  // Visitor(FSpatialProxyId, float EntryDistance) -> float:
+  // < 0 - промах, обход продолжается; 0 - остановить; > 0 - укоротить луч до этой дистанции
+  template <typename Visitor>
+  void RayCast(const FVector& Origin, const FVector& Direction, float MaxDistance, Visitor&& Visit) const;
+
+  uint32_t GetProxyCount() const
+  {
+    return m_ProxyCount;
+  }
+  int32_t GetHeight() const
+  {
+    return m_Root == NULL_NODE ? 0 : m_Nodes[m_Root].Height;
+  }
+
+  void Clear();
+
+ private:
+  static constexpr int32_t NULL_NODE = -1;
+
+  struct FNode
+  {
+    FBox Bounds;
+    void* UserData = nullptr;
+    int32_t Parent = NULL_NODE;  // у свободного узла - следующий в списке свободных
+    int32_t Child1 = NULL_NODE;
+    int32_t Child2 = NULL_NODE;
+    int32_t Height = -1;  // 0 - лист, -1 - свободный узел
+
+    bool IsLeaf() const
+    {
+      return Child1 == NULL_NODE;
+    }
+  };
+
+  // Стек обхода: глубина сбалансированного дерева мала, куча нужна только в вырожденных случаях
+  class FNodeStack
+  {
+   public:
+    void Push(int32_t Node)
+    {
+      if (m_Count < INLINE_CAPACITY)
+        m_Inline[m_Count] = Node;
+      else
+        m_Overflow.push_back(Node);
+      ++m_Count;
+    }
+    int32_t Pop()
+    {
+      --m_Count;
+      if (m_Count < INLINE_CAPACITY)
+        return m_Inline[m_Count];
+      const int32_t node = m_Overflow.back();
+      m_Overflow.pop_back();
+      return node;
+    }
+    bool Empty() const
+    {
+      return m_Count == 0;
+    }
+
+   private:
+    static constexpr int32_t INLINE_CAPACITY = 64;
+    int32_t m_Inline[INLINE_CAPACITY];
+    std::vector<int32_t> m_Overflow;
+    int32_t m_Count = 0;
+  };
+
+  template <typename Overlaps, typename Visitor>
+  void Traverse(Overlaps&& NodeOverlaps, Visitor& Visit) const;
+
+  int32_t AllocateNode();
+  void FreeNode(int32_t Node);
+  void InsertLeaf(int32_t Leaf);
+  void RemoveLeaf(int32_t Leaf);
+  int32_t Balance(int32_t Node);
+  void RefitAncestors(int32_t Node);
+
+  std::vector<FNode> m_Nodes;
+  int32_t m_Root = NULL_NODE;
+  int32_t m_FreeList = NULL_NODE;
+  uint32_t m_ProxyCount = 0;
+};
+
+template <typename Overlaps, typename Visitor>
+void CSpatialTree::Traverse(Overlaps&& NodeOverlaps, Visitor& Visit) const
+{
+  if (m_Root == NULL_NODE)
+    return;
+
+  FNodeStack stack;
+  stack.Push(m_Root);
+  while (!stack.Empty())
+  {
+    const int32_t index = stack.Pop();
+    const FNode& node = m_Nodes[index];
+    if (!NodeOverlaps(node.Bounds))
+      continue;
+
+    if (node.IsLeaf())
+    {
+      if (!Visit(static_cast<FSpatialProxyId>(index)))
+        return;
+    }
+    else
+    {
+      stack.Push(node.Child1);
+      stack.Push(node.Child2);
+    }
+  }
+}
+
+template <typename Visitor>
+void CSpatialTree::RayCast(const FVector& Origin, const FVector& Direction, float MaxDistance, Visitor&& Visit) const
+{
+  if (m_Root == NULL_NODE)
+    return;
+
+  const float inf = std::numeric_limits<float>::infinity();
+  const FVector invDirection(Direction.x != 0.0f ? 1.0f / Direction.x : inf,
+                             Direction.y != 0.0f ? 1.0f / Direction.y : inf,
+                             Direction.z != 0.0f ? 1.0f / Direction.z : inf);
+
+  float maxDistance = MaxDistance;
+  FNodeStack stack;
+  stack.Push(m_Root);
+  while (!stack.Empty())
+  {
+    const int32_t index = stack.Pop();
+    const FNode& node = m_Nodes[index];
+
+    float entry = 0.0f;
+    if (!node.Bounds.IntersectsRay(Origin, invDirection, maxDistance, entry))
+      continue;
+
+    if (node.IsLeaf())
+    {
+      const float result = Visit(static_cast<FSpatialProxyId>(index), entry);
+      if (result == 0.0f)
+        return;
+      if (result > 0.0f && result < maxDistance)
+        maxDistance = result;
+    }
+    else
+    {
+      stack.Push(node.Child1);
+      stack.Push(node.Child2);
+    }
+  }
+}
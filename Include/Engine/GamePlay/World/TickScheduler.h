@@ -0,0 +1,169 @@
+#pragma once
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+class CObject;
+class CTickScheduler;
+
+// Группы выполняются строго по порядку; внутри группы порядок задают пререквизиты
+enum class ETickGroup : uint8_t
+{
+  PrePhysics,
+  DuringPhysics,
+  PostPhysics,
+  PostUpdateWork,
+  Count
+};
+
+// Тик одного объекта (актора или компонента): группа, интервал, флаги и зависимости.
+// Планировщик уровня строит по ним расписание один раз и перестраивает только после изменений
+struct FTickFunction
+{
+ public:
+  explicit FTickFunction(CObject* Target);
+  ~FTickFunction();
+
+  FTickFunction(const FTickFunction&) = delete;
+  FTickFunction& operator=(const FTickFunction&) = delete;
+
+  void SetTickGroup(ETickGroup Group);
+  ETickGroup GetTickGroup() const
+  {
+    return m_Group;
+  }
+
+  // Секунды между тиками, 0 - каждый кадр. Накопленное время приходит в DeltaTime тика
+  void SetTickInterval(float Interval)
+  {
+    m_Interval = std::max(Interval, 0.0f);
+  }
+  float GetTickInterval() const
+  {
+    return m_Interval;
+  }
+
+  void SetTickEnabled(bool bEnabled);
+  bool IsTickEnabled() const
+  {
+    return m_bEnabled;
+  }
+
+  // false - объект не попадает в расписание совсем (его обновляет другая система)
+  void SetCanEverTick(bool bCanEverTick);
+  bool CanEverTick() const
+  {
+    return m_bCanEverTick;
+  }
+
+  // Потокобезопасный тик: объект трогает только свое состояние. Выполняется на CJobSystem
+  // в начале своей группы, если у него нет пререквизитов в той же группе
+  void SetTickInParallel(bool bEnabled);
+  bool CanTickInParallel() const
+  {
+    return m_bTickInParallel;
+  }
+
+  // Тик выполняется после Prerequisite в том же кадре; если Prerequisite в более поздней
+  // группе, этот тик переезжает в нее же
+  void AddPrerequisite(FTickFunction& Prerequisite);
+  void RemovePrerequisite(FTickFunction& Prerequisite);
+
+  CObject* GetTarget() const
+  {
+    return m_Target;
+  }
+
+ private:
+  friend class CTickScheduler;
+
+  void MarkScheduleDirty();
+
+  CObject* m_Target = nullptr;
+  CTickScheduler* m_Scheduler = nullptr;
+  std::vector<FTickFunction*> m_Prerequisites;
+  std::vector<FTickFunction*> m_Dependents;
+
+  float m_Interval = 0.0f;
+  float m_TimeSinceTick = 0.0f;
+
+  // Позиции в массивах планировщика: снятие с учета без поиска
+  uint32_t m_RegisteredIndex = UINT32_MAX;
+  uint32_t m_ScheduledIndex = UINT32_MAX;
+
+  ETickGroup m_Group = ETickGroup::PrePhysics;
+  ETickGroup m_EffectiveGroup = ETickGroup::PrePhysics;  // с учетом пререквизитов
+  uint8_t m_VisitState = 0;                              // обход при построении расписания
+  bool m_bEnabled = true;
+  bool m_bCanEverTick = true;
+  bool m_bTickInParallel = false;
+};
+
+// Расписание тиков уровня: плоский массив по группам в топологическом порядке.
+// Каждый объект тикает ровно один раз за кадр; выключенные в расписание не попадают.
+// Регистрация и снятие во время тика безопасны, изменения вступают в силу со следующего кадра
+class CTickScheduler
+{
+ public:
+  CTickScheduler() = default;
+  ~CTickScheduler();
+
+  CTickScheduler(const CTickScheduler&) = delete;
+  CTickScheduler& operator=(const CTickScheduler&) = delete;
+
+  // Повторная регистрация безопасна
+  void Register(FTickFunction& Function);
+  void Unregister(FTickFunction& Function);
+  void Clear();
+
+  void MarkDirty()
+  {
+    m_Dirty = true;
+  }
+
+  // Выключение тикает всех на вызывающем потоке
+  void SetParallelTickEnabled(bool Enabled)
+  {
+    m_ParallelTickEnabled = Enabled;
+    m_Dirty = true;
+  }
+  bool IsParallelTickEnabled() const
+  {
+    return m_ParallelTickEnabled;
+  }
+
+  void RunTicks(float DeltaTime);
+
+  uint32_t GetRegisteredCount() const
+  {
+    return static_cast<uint32_t>(m_Functions.size());
+  }
+  uint32_t GetScheduledCount() const
+  {
+    return static_cast<uint32_t>(m_Schedule.size());
+  }
+
+ private:
+  // [Begin, ParallelEnd) - параллельная часть группы, [ParallelEnd, End) - последовательная
+  struct FGroupRange
+  {
+    uint32_t Begin = 0;
+    uint32_t ParallelEnd = 0;
+    uint32_t End = 0;
+  };
+
+  void Rebuild();
+  void Visit(FTickFunction& Function);
+  bool IsSchedulable(const FTickFunction& Function) const;
+  bool CanRunInParallel(const FTickFunction& Function) const;
+  static void TickFunction(FTickFunction& Function, float DeltaTime);
+
+  std::vector<FTickFunction*> m_Functions;
+  // nullptr - функция снята с учета посреди кадра
+  std::vector<FTickFunction*> m_Schedule;
+  std::vector<FTickFunction*> m_BuildOrder;
+  FGroupRange m_Groups[static_cast<size_t>(ETickGroup::Count)];
+
+  bool m_Dirty = false;
+  bool m_ParallelTickEnabled = true;
+};
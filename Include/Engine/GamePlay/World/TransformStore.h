@@ -0,0 +1,120 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+#include "Engine/Core/CoreTypes.h"
+
+using FTransformHandle = uint32_t;
+constexpr FTransformHandle INVALID_TRANSFORM_HANDLE = UINT32_MAX;
+
+// Хранилище трансформаций в виде structure-of-arrays.
+// Плотные массивы отсортированы так, что родитель всегда идёт раньше детей,
+// поэтому мировые матрицы считаются одним линейным проходом.
+// CSceneComponent хранит только FTransformHandle.
+// Из нескольких потоков можно читать и менять узлы разных иерархий (параллельный тик
+// акторов); структурные изменения (Allocate, Release, SetParent) - только с игрового потока.
+class CTransformStore
+{
+ public:
+  static CTransformStore& Get();
+
+  FTransformHandle Allocate();
+  void Release(FTransformHandle Handle);
+
+  // Грязность поддерева выставляет вызывающий (CSceneComponent)
+  void SetParent(FTransformHandle Handle, FTransformHandle Parent);
+  FTransformHandle GetParent(FTransformHandle Handle) const
+  {
+    return m_Parent[m_HandleToDense[Handle]];
+  }
+
+  // Локальные данные (после изменения нужно вызвать MarkDirty)
+  FVector& LocalPosition(FTransformHandle Handle)
+  {
+    return m_LocalPosition[m_HandleToDense[Handle]];
+  }
+  FQuat& LocalRotation(FTransformHandle Handle)
+  {
+    return m_LocalRotation[m_HandleToDense[Handle]];
+  }
+  FVector& LocalScale(FTransformHandle Handle)
+  {
+    return m_LocalScale[m_HandleToDense[Handle]];
+  }
+  FVector& WorldScale(FTransformHandle Handle)
+  {
+    return m_WorldScale[m_HandleToDense[Handle]];
+  }
+
+  FMatrix GetLocalMatrix(FTransformHandle Handle) const;
+
+  // Translation * Rotation * Scale той же формы, что и локальные матрицы узлов
+  static FMatrix ComposeMatrix(const FVector& Position, const FQuat& Rotation, const FVector& Scale);
+
+  // Мировые данные, при необходимости пересчитываются по цепочке родителей.
+  // Ссылка живет до следующего Allocate, Release или UpdateWorldTransforms: использовать сразу
+  const FMatrix& GetWorldMatrix(FTransformHandle Handle);
+  const FVector& GetWorldScale(FTransformHandle Handle);
+
+  bool IsDirty(FTransformHandle Handle) const
+  {
+    return m_Dirty[m_HandleToDense[Handle]] != 0;
+  }
+  void MarkDirty(FTransformHandle Handle)
+  {
+    m_Dirty[m_HandleToDense[Handle]] = 1;
+  }
+
+  // Пакетный проход по всем грязным узлам (раз в кадр)
+  void UpdateWorldTransforms();
+
+  // Узлы, чья мировая матрица пересчитывалась с последнего ClearMovedHandles.
+  // Каждый хэндл попадает в список один раз (лениво пересчитанные - на UpdateWorldTransforms);
+  // по нему обновляются пространственные индексы
+  const std::vector<FTransformHandle>& GetMovedHandles() const
+  {
+    return m_MovedHandles;
+  }
+  void ClearMovedHandles();
+
+  size_t GetCount() const
+  {
+    return m_DenseToHandle.size();
+  }
+
+ private:
+  CTransformStore() = default;
+
+  void RefreshWorld(uint32_t Dense);
+  void ComposeWorld(uint32_t Dense);
+  void RecordMoved(FTransformHandle Handle);
+  void SortHierarchy();
+
+  // SoA, индексируются плотным индексом
+  std::vector<FVector> m_LocalPosition;
+  std::vector<FQuat> m_LocalRotation;
+  std::vector<FVector> m_LocalScale;
+  std::vector<FVector> m_WorldScale;
+  std::vector<FMatrix> m_WorldMatrix;
+  std::vector<FTransformHandle> m_Parent;
+  std::vector<uint8_t> m_Dirty;
+  std::vector<FTransformHandle> m_DenseToHandle;
+
+  std::vector<uint32_t> m_HandleToDense;
+  std::vector<FTransformHandle> m_FreeHandles;
+
+  enum : uint8_t
+  {
+    MOVED_NONE = 0,
+    MOVED_LISTED = 1,  // хэндл уже в m_MovedHandles
+    MOVED_LAZY = 2     // пересчитан через GetWorldMatrix, в список попадет в UpdateWorldTransforms
+  };
+
+  // Индексируется хэндлом, не плотным индексом: сортировка иерархии его не трогает
+  std::vector<uint8_t> m_MovedFlag;
+  std::vector<FTransformHandle> m_MovedHandles;
+  std::atomic<bool> m_HasLazyMoves{false};
+
+  bool m_NeedsSort = false;
+};
@@ -5,6 +5,7 @@
 
 #include "Engine/Core/Object.h"
 #include "Engine/Core/Rendering/Data/RenderData.h"
+#include "Engine/GamePlay/Entities/EntityManager.h"
 #include "Engine/GamePlay/World/Levels/Level.h"
 
 class CCameraComponent;
@@ -24,8 +25,36 @@ class CWorld : public CObject
   }
 
   void CollectRenderData(class FrameRenderData& renderData);
+
+  // Объекты вне пирамиды видимости камеры не попадают в FrameRenderData
+  void SetFrustumCullingEnabled(bool Enabled)
+  {
+    m_FrustumCullingEnabled = Enabled;
+  }
+  bool IsFrustumCullingEnabled() const
+  {
+    return m_FrustumCullingEnabled;
+  }
+  const CullingStats& GetLastCullingStats() const
+  {
+    return m_LastCullingStats;
+  }
   CCameraComponent* FindActiveCamera();
 
+  // Все компоненты типа T на текущем уровне (все меши, все камеры), без выделения памяти
+  template <typename T>
+  TComponentView<T> GetAllComponents() const
+  {
+    return m_CurrentLevel ? m_CurrentLevel->GetAllComponents<T>() : TComponentView<T>();
+  }
+
+  // Сущности без акторов (снаряды, толпы): системы идут в Tick после уровня,
+  // сущности с FEntityTransform и FEntityMesh попадают в CollectRenderData
+  CEntityManager& GetEntities()
+  {
+    return m_Entities;
+  }
+
   // Управление уровнями
   void AddLevel(std::unique_ptr<CLevel> Level);
   void RemoveLevel(const FString& LevelName);
@@ -59,4 +88,9 @@ class CWorld : public CObject
   CLevel* m_CurrentLevel = nullptr;
   CLevel* m_PendingLevel = nullptr;  
   LightingUBO m_defaultLighting;
+  bool m_FrustumCullingEnabled = true;
+  CullingStats m_LastCullingStats;
+  // Буфер результата запроса пирамиды, переиспользуется между кадрами
+  std::vector<CSceneComponent*> m_VisibleComponents;
+  CEntityManager m_Entities;
 };
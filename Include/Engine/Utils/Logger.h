@@ -1,19 +1,32 @@
 #pragma once
 
+#include <array>
+#include <atomic>
+#include <charconv>
 #include <chrono>
-#include <cstdarg>
+#include <condition_variable>
+#include <cstdint>
 #include <filesystem>
 #include <fstream>
 #include <iomanip>
 #include <iostream>
+#include <mutex>
 #include <sstream>
 #include <string>
-#include <unordered_map>
+#include <string_view>
+#include <thread>
+#include <type_traits>
 
 #ifdef _WIN32
 #include <windows.h>
 #endif
 
+// Самый подробный уровень, который попадает в сборку (значение ELogLevel, 0..6).
+// Вызовы подробнее вырезаются на этапе компиляции; CMake задает его через CE_COMPILED_LOG_LEVEL
+#ifndef CE_COMPILED_LOG_LEVEL
+#define CE_COMPILED_LOG_LEVEL 6
+#endif
+
 namespace CE
 {
   enum class ELogLevel
@@ -27,11 +40,15 @@ namespace CE
     VeryVerbose = 6  // Самый подробный
   };
 
+  // Категорий с собственным уровнем; лишние делят последний слот
+  constexpr uint32_t MAX_LOG_CATEGORIES = 256;
+
   class CLogCategory
   {
    public:
-    constexpr CLogCategory(const char* name, ELogLevel defaultLevel = ELogLevel::Log)
-        : name(name), defaultLevel(defaultLevel)
+    // Индекс выдается при конструировании: уровень категории - ячейка массива в CLogger
+    CLogCategory(const char* name, ELogLevel defaultLevel = ELogLevel::Log)
+        : name(name), defaultLevel(defaultLevel), index(AllocateIndex())
     {
     }
 
@@ -43,12 +60,77 @@ namespace CE
     {
       return defaultLevel;
     }
+    uint32_t GetIndex() const
+    {
+      return index;
+    }
 
    private:
+    static uint32_t AllocateIndex()
+    {
+      // Счетчик инициализируется константой: безопасно при статической инициализации категорий
+      static constinit std::atomic<uint32_t> nextIndex{0};
+      const uint32_t allocated = nextIndex.fetch_add(1, std::memory_order_relaxed);
+      return allocated < MAX_LOG_CATEGORIES ? allocated : MAX_LOG_CATEGORIES - 1;
+    }
+
     const char* name;
     ELogLevel defaultLevel;
+    uint32_t index;
   };
 
+  namespace LogFormat
+  {
+    // Дописывает один аргумент сообщения; числа - через to_chars, без локали и потоков
+    template <typename T>
+    void AppendArgument(std::string& Out, const T& Value)
+    {
+      using Type = std::decay_t<T>;
+      // Только указатель может быть нулевым; строковые литералы (массивы) идут ниже
+      if constexpr (std::is_pointer_v<T> && (std::is_same_v<Type, const char*> || std::is_same_v<Type, char*>))
+      {
+        Out += Value ? Value : "(null)";
+      }
+      else if constexpr (std::is_convertible_v<const T&, std::string_view>)
+      {
+        Out += std::string_view(Value);
+      }
+      else if constexpr (std::is_same_v<Type, bool>)
+      {
+        Out += Value ? "true" : "false";
+      }
+      else if constexpr (std::is_same_v<Type, char>)
+      {
+        Out += Value;
+      }
+      else if constexpr (std::is_enum_v<Type>)
+      {
+        AppendArgument(Out, static_cast<std::underlying_type_t<Type>>(Value));
+      }
+      else if constexpr (std::is_arithmetic_v<Type>)
+      {
+        char buffer[64];
+        const auto result = std::to_chars(buffer, buffer + sizeof(buffer), Value);
+        Out.append(buffer, result.ptr);
+      }
+      else if constexpr (std::is_pointer_v<Type> || std::is_null_pointer_v<Type>)
+      {
+        char buffer[2 + sizeof(uintptr_t) * 2];
+        buffer[0] = '0';
+        buffer[1] = 'x';
+        const auto result = std::to_chars(buffer + 2, buffer + sizeof(buffer), reinterpret_cast<uintptr_t>(Value), 16);
+        Out.append(buffer, result.ptr);
+      }
+      else
+      {
+        // Остальное (пути, свои типы) - через operator<<
+        std::ostringstream stream;
+        stream << Value;
+        Out += stream.str();
+      }
+    }
+  }  // namespace LogFormat
+
   extern CLogCategory LogTemp;
   extern CLogCategory LogCore;
   extern CLogCategory LogRender;
@@ -58,6 +140,20 @@ namespace CE
   extern CLogCategory LogEditor;
   extern CLogCategory LogSystem;
 
+  /**
+   * @class CLogger
+   * @brief Асинхронный логгер: вызывающий поток только кладет запись в очередь
+   *
+   * Уровень проверяется макросами до форматирования (IsEnabled). Запись - метка времени,
+   * уровень, указатель на категорию и готовое сообщение - уходит в lock-free очередь
+   * (много писателей, один читатель). Фоновый поток форматирует метки времени и пишет
+   * пачками: консоль после каждой пачки, файл сбрасывается по SetFlushLevel/SetFlushInterval.
+   * Fatal дожидается записи всей очереди до выхода.
+   *
+   * Текст сообщения (FormatString) собирается на вызывающем потоке, в очередь аргументы
+   * не попадают: const char*, string_view и ссылки на временные объекты к моменту записи
+   * могли бы уже умереть. Фоновому потоку отданы только метка времени и ввод-вывод.
+   */
   class CLogger
 {
  public:
@@ -69,51 +165,35 @@ namespace CE
   static void SetConsoleOutput(bool enable);
   static void SetFileOutput(bool enable);
 
-  static std::string FormatString(const char* format, ...)
-  {
-    va_list args;
-    va_start(args, format);
-    char buffer[1024];
-    vsnprintf(buffer, sizeof(buffer), format, args);
-    va_end(args);
-    return std::string(buffer);
-  }
+  // Записи этого уровня и важнее сбрасывают файл сразу (по умолчанию Warning)
+  static void SetFlushLevel(ELogLevel level);
+  // Остальные записи попадают на диск не позже чем через интервал
+  static void SetFlushInterval(uint32_t milliseconds);
+  // Ждет, пока фоновый поток запишет все, что было в очереди на момент вызова
+  static void Flush();
 
-  static void Log(const CLogCategory& category, ELogLevel level, const std::string& message)
+  // Дешевая проверка до форматирования: макросы не собирают строку для отключенных уровней
+  static bool IsEnabled(const CLogCategory& category, ELogLevel level)
   {
-    if (!s_initialized)
-      return;
+    if (!s_initialized.load(std::memory_order_relaxed))
+      return false;
 
-    ELogLevel categoryLevel = s_globalLevel;
-    auto it = s_categoryLevels.find(&category);
-    if (it != s_categoryLevels.end())
-    {
-      categoryLevel = it->second;
-    }
-
-    if (static_cast<int>(level) > static_cast<int>(categoryLevel))
-      return;
-
-    std::string fullMessage = GetCurrentTimeStamp() + " " + GetLevelDisplayName(level) +
-                              ": [" + category.GetName() + "] " + message;
-
-    if (s_consoleOutput)
-    {
-      WriteToConsole(level, category, fullMessage);
-    }
-
-    if (s_fileOutput)
-    {
-      WriteToFile(fullMessage);
-    }
+    const uint8_t categoryLevel = s_categoryLevels[category.GetIndex()].load(std::memory_order_relaxed);
+    const int limit = categoryLevel != 0 ? categoryLevel - 1 : static_cast<int>(s_globalLevel.load(std::memory_order_relaxed));
+    return static_cast<int>(level) <= limit;
+  }
 
-    if (level == ELogLevel::Fatal)
-    {
-      Shutdown();
-      std::exit(1);
-    }
+  // Склеивает аргументы по порядку: CORE_LOG("Moving from (", x, ", ", y, ")")
+  template <typename... Args>
+  static std::string FormatString(const Args&... args)
+  {
+    std::string message;
+    (LogFormat::AppendArgument(message, args), ...);
+    return message;
   }
 
+  static void Log(const CLogCategory& category, ELogLevel level, std::string message);
+
   static void LogFatal(const CLogCategory& category, const std::string& message);
   static void LogError(const CLogCategory& category, const std::string& message);
   static void LogWarning(const CLogCategory& category, const std::string& message);
@@ -123,21 +203,37 @@ namespace CE
   static void LogVeryVerbose(const CLogCategory& category, const std::string& message);
 
  private:
+  static void WriterLoop();
+  static void WakeWriter();
   static void WriteToConsole(ELogLevel level, const CLogCategory& category, const std::string& message);
   static void WriteToFile(const std::string& message);
-  static std::string GetCurrentTimeStamp();
   static std::string GetLevelString(ELogLevel level);
   static std::string GetLevelDisplayName(ELogLevel level);
   static std::string GetLogFilePath();
 
-  static ELogLevel s_globalLevel;
-  static bool s_consoleOutput;
-  static bool s_fileOutput;
-  static bool s_initialized;
+  static std::atomic<ELogLevel> s_globalLevel;
+  static std::atomic<ELogLevel> s_flushLevel;
+  static std::atomic<uint32_t> s_flushIntervalMs;
+  static std::atomic<bool> s_consoleOutput;
+  static std::atomic<bool> s_fileOutput;
+  static std::atomic<bool> s_initialized;
   static bool s_useUniqueLogFile;
   static bool s_overwriteExisting;
   static std::ofstream s_logFile;
-  static std::unordered_map<const CLogCategory*, ELogLevel> s_categoryLevels;
+  // Уровень + 1 по индексу категории; 0 - действует глобальный
+  static std::array<std::atomic<uint8_t>, MAX_LOG_CATEGORIES> s_categoryLevels;
+
+  // Фоновый поток записи и его пробуждение
+  static std::thread s_writer;
+  static std::mutex s_wakeMutex;
+  static std::condition_variable s_wakeCondition;
+  static bool s_wakeRequested;
+  static bool s_stopping;
+
+  // Flush ждет, пока число записанных догонит число поставленных в очередь
+  static std::mutex s_flushMutex;
+  static std::condition_variable s_flushCondition;
+  static uint64_t s_writtenRecords;
 };
 
 
@@ -153,76 +249,90 @@ using CE::LogGameplay;
 using CE::LogEditor;
 using CE::LogSystem;
 
-#define CORE_FATAL(...) CE::CLogger::LogFatal(LogCore, CE::CLogger::FormatString(__VA_ARGS__))
-#define CORE_ERROR(...) CE::CLogger::LogError(LogCore, CE::CLogger::FormatString(__VA_ARGS__))
-#define CORE_WARN(...) CE::CLogger::LogWarning(LogCore, CE::CLogger::FormatString(__VA_ARGS__))
-#define CORE_DISPLAY(...) CE::CLogger::LogDisplay(LogCore, CE::CLogger::FormatString(__VA_ARGS__))
-#define CORE_LOG(...) CE::CLogger::LogMsg(LogCore, CE::CLogger::FormatString(__VA_ARGS__))
-#define CORE_DEBUG(...) CE::CLogger::LogVerbose(LogCore, CE::CLogger::FormatString(__VA_ARGS__))
-#define CORE_TRACE(...) CE::CLogger::LogVeryVerbose(LogCore, CE::CLogger::FormatString(__VA_ARGS__))
-
-
-#define RENDER_FATAL(...) CE::CLogger::LogFatal(LogRender, CE::CLogger::FormatString(__VA_ARGS__))
-#define RENDER_ERROR(...) CE::CLogger::LogError(LogRender, CE::CLogger::FormatString(__VA_ARGS__))
-#define RENDER_WARN(...) CE::CLogger::LogWarning(LogRender, CE::CLogger::FormatString(__VA_ARGS__))
-#define RENDER_DISPLAY(...) CE::CLogger::LogDisplay(LogRender, CE::CLogger::FormatString(__VA_ARGS__))
-#define RENDER_LOG(...) CE::CLogger::LogMsg(LogRender, CE::CLogger::FormatString(__VA_ARGS__))
-#define RENDER_DEBUG(...) CE::CLogger::LogVerbose(LogRender, CE::CLogger::FormatString(__VA_ARGS__))
-#define RENDER_TRACE(...) CE::CLogger::LogVeryVerbose(LogRender, CE::CLogger::FormatString(__VA_ARGS__))
-
-
-#define INPUT_FATAL(...) CE::CLogger::LogFatal(LogInput, CE::CLogger::FormatString(__VA_ARGS__))
-#define INPUT_ERROR(...) CE::CLogger::LogError(LogInput, CE::CLogger::FormatString(__VA_ARGS__))
-#define INPUT_WARN(...) CE::CLogger::LogWarning(LogInput, CE::CLogger::FormatString(__VA_ARGS__))
-#define INPUT_DISPLAY(...) CE::CLogger::LogDisplay(LogInput, CE::CLogger::FormatString(__VA_ARGS__))
-#define INPUT_LOG(...) CE::CLogger::LogMsg(LogInput, CE::CLogger::FormatString(__VA_ARGS__))
-#define INPUT_DEBUG(...) CE::CLogger::LogVerbose(LogInput, CE::CLogger::FormatString(__VA_ARGS__))
-#define INPUT_TRACE(...) CE::CLogger::LogVeryVerbose(LogInput, CE::CLogger::FormatString(__VA_ARGS__))
-
-
-#define AUDIO_FATAL(...) CE::CLogger::LogFatal(LogAudio, CE::CLogger::FormatString(__VA_ARGS__))
-#define AUDIO_ERROR(...) CE::CLogger::LogError(LogAudio, CE::CLogger::FormatString(__VA_ARGS__))
-#define AUDIO_WARN(...) CE::CLogger::LogWarning(LogAudio, CE::CLogger::FormatString(__VA_ARGS__))
-#define AUDIO_DISPLAY(...) CE::CLogger::LogDisplay(LogAudio, CE::CLogger::FormatString(__VA_ARGS__))
-#define AUDIO_LOG(...) CE::CLogger::LogMsg(LogAudio, CE::CLogger::FormatString(__VA_ARGS__))
-#define AUDIO_DEBUG(...) CE::CLogger::LogVerbose(LogAudio, CE::CLogger::FormatString(__VA_ARGS__))
-#define AUDIO_TRACE(...) CE::CLogger::LogVeryVerbose(LogAudio, CE::CLogger::FormatString(__VA_ARGS__))
-
-
-#define GAMEPLAY_FATAL(...) CE::CLogger::LogFatal(LogGameplay, CE::CLogger::FormatString(__VA_ARGS__))
-#define GAMEPLAY_ERROR(...) CE::CLogger::LogError(LogGameplay, CE::CLogger::FormatString(__VA_ARGS__))
-#define GAMEPLAY_WARN(...) CE::CLogger::LogWarning(LogGameplay, CE::CLogger::FormatString(__VA_ARGS__))
-#define GAMEPLAY_DISPLAY(...) CE::CLogger::LogDisplay(LogGameplay, CE::CLogger::FormatString(__VA_ARGS__))
-#define GAMEPLAY_LOG(...) CE::CLogger::LogMsg(LogGameplay, CE::CLogger::FormatString(__VA_ARGS__))
-#define GAMEPLAY_DEBUG(...) CE::CLogger::LogVerbose(LogGameplay, CE::CLogger::FormatString(__VA_ARGS__))
-#define GAMEPLAY_TRACE(...) CE::CLogger::LogVeryVerbose(LogGameplay, CE::CLogger::FormatString(__VA_ARGS__))
-
-
-#define EDITOR_FATAL(...) CE::CLogger::LogFatal(LogEditor, CE::CLogger::FormatString(__VA_ARGS__))
-#define EDITOR_ERROR(...) CE::CLogger::LogError(LogEditor, CE::CLogger::FormatString(__VA_ARGS__))
-#define EDITOR_WARN(...) CE::CLogger::LogWarning(LogEditor, CE::CLogger::FormatString(__VA_ARGS__))
-#define EDITOR_DISPLAY(...) CE::CLogger::LogDisplay(LogEditor, CE::CLogger::FormatString(__VA_ARGS__))
-#define EDITOR_LOG(...) CE::CLogger::LogMsg(LogEditor, CE::CLogger::FormatString(__VA_ARGS__))
-#define EDITOR_DEBUG(...) CE::CLogger::LogVerbose(LogEditor, CE::CLogger::FormatString(__VA_ARGS__))
-#define EDITOR_TRACE(...) CE::CLogger::LogVeryVerbose(LogEditor, CE::CLogger::FormatString(__VA_ARGS__))
-
-
-#define SYSTEM_FATAL(...) CE::CLogger::LogFatal(LogSystem, CE::CLogger::FormatString(__VA_ARGS__))
-#define SYSTEM_ERROR(...) CE::CLogger::LogError(LogSystem, CE::CLogger::FormatString(__VA_ARGS__))
-#define SYSTEM_WARN(...) CE::CLogger::LogWarning(LogSystem, CE::CLogger::FormatString(__VA_ARGS__))
-#define SYSTEM_DISPLAY(...) CE::CLogger::LogDisplay(LogSystem, CE::CLogger::FormatString(__VA_ARGS__))
-#define SYSTEM_LOG(...) CE::CLogger::LogMsg(LogSystem, CE::CLogger::FormatString(__VA_ARGS__))
-#define SYSTEM_DEBUG(...) CE::CLogger::LogVerbose(LogSystem, CE::CLogger::FormatString(__VA_ARGS__))
-#define SYSTEM_TRACE(...) CE::CLogger::LogVeryVerbose(LogSystem, CE::CLogger::FormatString(__VA_ARGS__))
-
-
-#define CFATAL(...) CE::CLogger::LogFatal(LogTemp, CE::CLogger::FormatString(__VA_ARGS__))
-#define CERROR(...) CE::CLogger::LogError(LogTemp, CE::CLogger::FormatString(__VA_ARGS__))
-#define CWARN(...) CE::CLogger::LogWarning(LogTemp, CE::CLogger::FormatString(__VA_ARGS__))
-#define CDISPLAY(...) CE::CLogger::LogDisplay(LogTemp, CE::CLogger::FormatString(__VA_ARGS__))
-#define CLOG(...) CE::CLogger::LogMsg(LogTemp, CE::CLogger::FormatString(__VA_ARGS__))
-#define CDEBUG(...) CE::CLogger::LogVerbose(LogTemp, CE::CLogger::FormatString(__VA_ARGS__))
-#define CTRACE(...) CE::CLogger::LogVeryVerbose(LogTemp, CE::CLogger::FormatString(__VA_ARGS__))
+// Уровни подробнее CE_COMPILED_LOG_LEVEL не попадают в код; остальные проверяются
+// до FormatString: отключенное сообщение не форматируется
+#define CE_LOG_IMPL(Category, Level, ...)                                                             \
+  do                                                                                                  \
+  {                                                                                                   \
+    if constexpr (static_cast<int>(CE::ELogLevel::Level) <= CE_COMPILED_LOG_LEVEL)                    \
+    {                                                                                                 \
+      if (CE::CLogger::IsEnabled(Category, CE::ELogLevel::Level))                                     \
+      {                                                                                               \
+        CE::CLogger::Log(Category, CE::ELogLevel::Level, CE::CLogger::FormatString(__VA_ARGS__));     \
+      }                                                                                               \
+    }                                                                                                 \
+  } while (0)
+
+#define CORE_FATAL(...) CE_LOG_IMPL(LogCore, Fatal, __VA_ARGS__)
+#define CORE_ERROR(...) CE_LOG_IMPL(LogCore, Error, __VA_ARGS__)
+#define CORE_WARN(...) CE_LOG_IMPL(LogCore, Warning, __VA_ARGS__)
+#define CORE_DISPLAY(...) CE_LOG_IMPL(LogCore, Display, __VA_ARGS__)
+#define CORE_LOG(...) CE_LOG_IMPL(LogCore, Log, __VA_ARGS__)
+#define CORE_DEBUG(...) CE_LOG_IMPL(LogCore, Verbose, __VA_ARGS__)
+#define CORE_TRACE(...) CE_LOG_IMPL(LogCore, VeryVerbose, __VA_ARGS__)
+
+
+#define RENDER_FATAL(...) CE_LOG_IMPL(LogRender, Fatal, __VA_ARGS__)
+#define RENDER_ERROR(...) CE_LOG_IMPL(LogRender, Error, __VA_ARGS__)
+#define RENDER_WARN(...) CE_LOG_IMPL(LogRender, Warning, __VA_ARGS__)
+#define RENDER_DISPLAY(...) CE_LOG_IMPL(LogRender, Display, __VA_ARGS__)
+#define RENDER_LOG(...) CE_LOG_IMPL(LogRender, Log, __VA_ARGS__)
+#define RENDER_DEBUG(...) CE_LOG_IMPL(LogRender, Verbose, __VA_ARGS__)
+#define RENDER_TRACE(...) CE_LOG_IMPL(LogRender, VeryVerbose, __VA_ARGS__)
+
+
+#define INPUT_FATAL(...) CE_LOG_IMPL(LogInput, Fatal, __VA_ARGS__)
+#define INPUT_ERROR(...) CE_LOG_IMPL(LogInput, Error, __VA_ARGS__)
+#define INPUT_WARN(...) CE_LOG_IMPL(LogInput, Warning, __VA_ARGS__)
+#define INPUT_DISPLAY(...) CE_LOG_IMPL(LogInput, Display, __VA_ARGS__)
+#define INPUT_LOG(...) CE_LOG_IMPL(LogInput, Log, __VA_ARGS__)
+#define INPUT_DEBUG(...) CE_LOG_IMPL(LogInput, Verbose, __VA_ARGS__)
+#define INPUT_TRACE(...) CE_LOG_IMPL(LogInput, VeryVerbose, __VA_ARGS__)
+
+
+#define AUDIO_FATAL(...) CE_LOG_IMPL(LogAudio, Fatal, __VA_ARGS__)
+#define AUDIO_ERROR(...) CE_LOG_IMPL(LogAudio, Error, __VA_ARGS__)
+#define AUDIO_WARN(...) CE_LOG_IMPL(LogAudio, Warning, __VA_ARGS__)
+#define AUDIO_DISPLAY(...) CE_LOG_IMPL(LogAudio, Display, __VA_ARGS__)
+#define AUDIO_LOG(...) CE_LOG_IMPL(LogAudio, Log, __VA_ARGS__)
+#define AUDIO_DEBUG(...) CE_LOG_IMPL(LogAudio, Verbose, __VA_ARGS__)
+#define AUDIO_TRACE(...) CE_LOG_IMPL(LogAudio, VeryVerbose, __VA_ARGS__)
+
+
+#define GAMEPLAY_FATAL(...) CE_LOG_IMPL(LogGameplay, Fatal, __VA_ARGS__)
+#define GAMEPLAY_ERROR(...) CE_LOG_IMPL(LogGameplay, Error, __VA_ARGS__)
+#define GAMEPLAY_WARN(...) CE_LOG_IMPL(LogGameplay, Warning, __VA_ARGS__)
+#define GAMEPLAY_DISPLAY(...) CE_LOG_IMPL(LogGameplay, Display, __VA_ARGS__)
+#define GAMEPLAY_LOG(...) CE_LOG_IMPL(LogGameplay, Log, __VA_ARGS__)
+#define GAMEPLAY_DEBUG(...) CE_LOG_IMPL(LogGameplay, Verbose, __VA_ARGS__)
+#define GAMEPLAY_TRACE(...) CE_LOG_IMPL(LogGameplay, VeryVerbose, __VA_ARGS__)
+
+
+#define EDITOR_FATAL(...) CE_LOG_IMPL(LogEditor, Fatal, __VA_ARGS__)
+#define EDITOR_ERROR(...) CE_LOG_IMPL(LogEditor, Error, __VA_ARGS__)
+#define EDITOR_WARN(...) CE_LOG_IMPL(LogEditor, Warning, __VA_ARGS__)
+#define EDITOR_DISPLAY(...) CE_LOG_IMPL(LogEditor, Display, __VA_ARGS__)
+#define EDITOR_LOG(...) CE_LOG_IMPL(LogEditor, Log, __VA_ARGS__)
+#define EDITOR_DEBUG(...) CE_LOG_IMPL(LogEditor, Verbose, __VA_ARGS__)
+#define EDITOR_TRACE(...) CE_LOG_IMPL(LogEditor, VeryVerbose, __VA_ARGS__)
+
+
+#define SYSTEM_FATAL(...) CE_LOG_IMPL(LogSystem, Fatal, __VA_ARGS__)
+#define SYSTEM_ERROR(...) CE_LOG_IMPL(LogSystem, Error, __VA_ARGS__)
+#define SYSTEM_WARN(...) CE_LOG_IMPL(LogSystem, Warning, __VA_ARGS__)
+#define SYSTEM_DISPLAY(...) CE_LOG_IMPL(LogSystem, Display, __VA_ARGS__)
+#define SYSTEM_LOG(...) CE_LOG_IMPL(LogSystem, Log, __VA_ARGS__)
+#define SYSTEM_DEBUG(...) CE_LOG_IMPL(LogSystem, Verbose, __VA_ARGS__)
+#define SYSTEM_TRACE(...) CE_LOG_IMPL(LogSystem, VeryVerbose, __VA_ARGS__)
+
+
+#define CFATAL(...) CE_LOG_IMPL(LogTemp, Fatal, __VA_ARGS__)
+#define CERROR(...) CE_LOG_IMPL(LogTemp, Error, __VA_ARGS__)
+#define CWARN(...) CE_LOG_IMPL(LogTemp, Warning, __VA_ARGS__)
+#define CDISPLAY(...) CE_LOG_IMPL(LogTemp, Display, __VA_ARGS__)
+#define CLOG(...) CE_LOG_IMPL(LogTemp, Log, __VA_ARGS__)
+#define CDEBUG(...) CE_LOG_IMPL(LogTemp, Verbose, __VA_ARGS__)
+#define CTRACE(...) CE_LOG_IMPL(LogTemp, VeryVerbose, __VA_ARGS__)
 
 
 #define CHECK(Expression, ...)                            \
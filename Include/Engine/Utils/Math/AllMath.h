@@ -6,6 +6,8 @@
 #include "Vector4D.hpp"
 #include "Matrix4x4.hpp"
 #include "Quaternion.hpp"
+#include "Bounds.hpp"
+#include "Frustum.hpp"
 
 #include "Color.h"
 
@@ -0,0 +1,154 @@
+#pragma once
+
+#include "Math/Matrix4x4.hpp"
+#include "Math/Vector3D.hpp"
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <utility>
+
+namespace CEMath
+{
+    // Бокс, выровненный по осям. Пустой бокс (min > max) не содержит ни одной точки
+    struct BoundingBox
+    {
+        Vector3D min{FLT_MAX};
+        Vector3D max{-FLT_MAX};
+
+        BoundingBox() noexcept = default;
+        BoundingBox(const Vector3D& min_, const Vector3D& max_) noexcept : min(min_), max(max_)
+        {
+        }
+
+        bool IsValid() const noexcept
+        {
+            return min.x <= max.x && min.y <= max.y && min.z <= max.z;
+        }
+
+        void Expand(const Vector3D& point) noexcept
+        {
+            min = Vector3D(std::min(min.x, point.x), std::min(min.y, point.y), std::min(min.z, point.z));
+            max = Vector3D(std::max(max.x, point.x), std::max(max.y, point.y), std::max(max.z, point.z));
+        }
+
+        Vector3D GetCenter() const noexcept
+        {
+            return (min + max) * 0.5f;
+        }
+
+        // Половина размера по каждой оси
+        Vector3D GetExtents() const noexcept
+        {
+            return (max - min) * 0.5f;
+        }
+
+        BoundingBox Merged(const BoundingBox& other) const noexcept
+        {
+            return BoundingBox(
+                Vector3D(std::min(min.x, other.min.x), std::min(min.y, other.min.y), std::min(min.z, other.min.z)),
+                Vector3D(std::max(max.x, other.max.x), std::max(max.y, other.max.y), std::max(max.z, other.max.z)));
+        }
+
+        BoundingBox Expanded(float margin) const noexcept
+        {
+            return BoundingBox(min - Vector3D(margin), max + Vector3D(margin));
+        }
+
+        // Половина площади поверхности - стоимость узла в эвристике SAH
+        float GetHalfSurfaceArea() const noexcept
+        {
+            const Vector3D size = max - min;
+            return size.x * size.y + size.y * size.z + size.z * size.x;
+        }
+
+        bool Contains(const BoundingBox& other) const noexcept
+        {
+            return min.x <= other.min.x && min.y <= other.min.y && min.z <= other.min.z &&
+                   max.x >= other.max.x && max.y >= other.max.y && max.z >= other.max.z;
+        }
+
+        bool Intersects(const BoundingBox& other) const noexcept
+        {
+            return min.x <= other.max.x && max.x >= other.min.x &&
+                   min.y <= other.max.y && max.y >= other.min.y &&
+                   min.z <= other.max.z && max.z >= other.min.z;
+        }
+
+        bool IntersectsSphere(const Vector3D& center, float radius) const noexcept
+        {
+            // Квадрат расстояния от центра до ближайшей точки бокса
+            float distanceSquared = 0.0f;
+            for (uint32_t axis = 0; axis < 3; ++axis)
+            {
+                const float value = center[axis];
+                const float clamped = std::clamp(value, min[axis], max[axis]);
+                distanceSquared += (value - clamped) * (value - clamped);
+            }
+            return distanceSquared <= radius * radius;
+        }
+
+        // Slab тест; invDirection = 1 / direction (бесконечность для нулевых компонент).
+        // outEntry - расстояние входа луча, 0 если начало внутри бокса
+        bool IntersectsRay(const Vector3D& origin, const Vector3D& invDirection, float maxDistance, float& outEntry) const noexcept
+        {
+            float entry = 0.0f;
+            float exit = maxDistance;
+            for (uint32_t axis = 0; axis < 3; ++axis)
+            {
+                float t0 = (min[axis] - origin[axis]) * invDirection[axis];
+                float t1 = (max[axis] - origin[axis]) * invDirection[axis];
+                if (t0 > t1)
+                    std::swap(t0, t1);
+                // NaN (0 * inf на грани) не сужает интервал
+                entry = t0 > entry ? t0 : entry;
+                exit = t1 < exit ? t1 : exit;
+                if (entry > exit)
+                    return false;
+            }
+            outEntry = entry;
+            return true;
+        }
+
+        // Бокс, охватывающий преобразованный бокс (метод Арво: |M| * extents)
+        BoundingBox TransformedBy(const Matrix4x4& matrix) const noexcept
+        {
+            const Vector3D center = matrix * GetCenter();
+            const Vector3D extents = GetExtents();
+
+            Vector3D worldExtents;
+            for (uint32_t row = 0; row < 3; ++row)
+            {
+                worldExtents[row] = std::abs(matrix.m[row][0]) * extents.x +
+                                    std::abs(matrix.m[row][1]) * extents.y +
+                                    std::abs(matrix.m[row][2]) * extents.z;
+            }
+            return BoundingBox(center - worldExtents, center + worldExtents);
+        }
+    };
+
+    struct BoundingSphere
+    {
+        Vector3D center;
+        float radius = 0.0f;
+
+        BoundingSphere() noexcept = default;
+        BoundingSphere(const Vector3D& center_, float radius_) noexcept : center(center_), radius(radius_)
+        {
+        }
+
+        // Радиус масштабируется по самой длинной оси, поэтому сфера остается описанной и при неравномерном масштабе
+        BoundingSphere TransformedBy(const Matrix4x4& matrix) const noexcept
+        {
+            float maxScaleSquared = 0.0f;
+            for (uint32_t column = 0; column < 3; ++column)
+            {
+                const float scaleSquared = matrix.m[0][column] * matrix.m[0][column] +
+                                           matrix.m[1][column] * matrix.m[1][column] +
+                                           matrix.m[2][column] * matrix.m[2][column];
+                maxScaleSquared = std::max(maxScaleSquared, scaleSquared);
+            }
+            return BoundingSphere(matrix * center, radius * std::sqrt(maxScaleSquared));
+        }
+    };
+}
@@ -0,0 +1,129 @@
+#pragma once
+
+#include "Math/Bounds.hpp"
+#include "Math/MathSIMD.hpp"
+#include "Math/Matrix4x4.hpp"
+#include "Math/Vector3D.hpp"
+#include "Math/Vector4D.hpp"
+
+namespace CEMath
+{
+    // Пирамида видимости из шести плоскостей, нормали смотрят внутрь.
+    // Плоскости хранятся SoA по четыре в регистре, так что тест объекта - два прохода по 4 плоскости.
+    class Frustum
+    {
+    public:
+        enum EPlane
+        {
+            Left,
+            Right,
+            Bottom,
+            Top,
+            Near,
+            Far,
+            PlaneCount
+        };
+
+        // Пустая пирамида пропускает все
+        Frustum() noexcept;
+        // Плоскости из матрицы clip = M * p с глубиной Vulkan [0, 1]
+        explicit Frustum(const Matrix4x4& viewProjection) noexcept;
+
+        void SetFromMatrix(const Matrix4x4& viewProjection) noexcept;
+
+        // (nx, ny, nz, d): точка внутри, если n·p + d >= 0
+        Vector4D GetPlane(EPlane plane) const noexcept;
+
+        bool IntersectsSphere(const Vector3D& center, float radius) const noexcept;
+        bool IntersectsSphere(const BoundingSphere& sphere) const noexcept
+        {
+            return IntersectsSphere(sphere.center, sphere.radius);
+        }
+
+        bool IntersectsBox(const Vector3D& center, const Vector3D& extents) const noexcept;
+        bool IntersectsBox(const BoundingBox& box) const noexcept
+        {
+            return IntersectsBox(box.GetCenter(), box.GetExtents());
+        }
+
+    private:
+        void SetPlane(int index, float a, float b, float c, float d) noexcept;
+
+        // Два блока по 4 плоскости; слоты 6 и 7 дублируют плоскость Left и на результат не влияют
+        static constexpr int PLANE_SLOTS = 8;
+        alignas(SIMD::ALIGNMENT) float m_nx[PLANE_SLOTS];
+        alignas(SIMD::ALIGNMENT) float m_ny[PLANE_SLOTS];
+        alignas(SIMD::ALIGNMENT) float m_nz[PLANE_SLOTS];
+        alignas(SIMD::ALIGNMENT) float m_d[PLANE_SLOTS];
+    };
+
+    inline bool Frustum::IntersectsSphere(const Vector3D& center, float radius) const noexcept
+    {
+#if defined(CE_MATH_SSE2)
+        const __m128 cx = _mm_set1_ps(center.x);
+        const __m128 cy = _mm_set1_ps(center.y);
+        const __m128 cz = _mm_set1_ps(center.z);
+        const __m128 negRadius = _mm_set1_ps(-radius);
+
+        __m128 outside = _mm_setzero_ps();
+        for (int block = 0; block < PLANE_SLOTS; block += 4)
+        {
+            __m128 dist = SIMD::MulAdd(_mm_load_ps(m_nx + block), cx, _mm_load_ps(m_d + block));
+            dist = SIMD::MulAdd(_mm_load_ps(m_ny + block), cy, dist);
+            dist = SIMD::MulAdd(_mm_load_ps(m_nz + block), cz, dist);
+            outside = _mm_or_ps(outside, _mm_cmplt_ps(dist, negRadius));
+        }
+        return _mm_movemask_ps(outside) == 0;
+#else
+        for (int i = 0; i < PlaneCount; ++i)
+        {
+            if (m_nx[i] * center.x + m_ny[i] * center.y + m_nz[i] * center.z + m_d[i] < -radius)
+                return false;
+        }
+        return true;
+#endif
+    }
+
+    inline bool Frustum::IntersectsBox(const Vector3D& center, const Vector3D& extents) const noexcept
+    {
+#if defined(CE_MATH_SSE2)
+        const __m128 cx = _mm_set1_ps(center.x);
+        const __m128 cy = _mm_set1_ps(center.y);
+        const __m128 cz = _mm_set1_ps(center.z);
+        const __m128 ex = _mm_set1_ps(extents.x);
+        const __m128 ey = _mm_set1_ps(extents.y);
+        const __m128 ez = _mm_set1_ps(extents.z);
+        const __m128 absMask = _mm_castsi128_ps(_mm_set1_epi32(0x7FFFFFFF));
+
+        __m128 outside = _mm_setzero_ps();
+        for (int block = 0; block < PLANE_SLOTS; block += 4)
+        {
+            const __m128 nx = _mm_load_ps(m_nx + block);
+            const __m128 ny = _mm_load_ps(m_ny + block);
+            const __m128 nz = _mm_load_ps(m_nz + block);
+
+            // Расстояние от центра и проекция полуразмеров на нормаль
+            __m128 dist = SIMD::MulAdd(nx, cx, _mm_load_ps(m_d + block));
+            dist = SIMD::MulAdd(ny, cy, dist);
+            dist = SIMD::MulAdd(nz, cz, dist);
+
+            __m128 reach = _mm_mul_ps(_mm_and_ps(nx, absMask), ex);
+            reach = SIMD::MulAdd(_mm_and_ps(ny, absMask), ey, reach);
+            reach = SIMD::MulAdd(_mm_and_ps(nz, absMask), ez, reach);
+
+            outside = _mm_or_ps(outside, _mm_cmplt_ps(_mm_add_ps(dist, reach), _mm_setzero_ps()));
+        }
+        return _mm_movemask_ps(outside) == 0;
+#else
+        for (int i = 0; i < PlaneCount; ++i)
+        {
+            const float dist = m_nx[i] * center.x + m_ny[i] * center.y + m_nz[i] * center.z + m_d[i];
+            const float reach = std::abs(m_nx[i]) * extents.x + std::abs(m_ny[i]) * extents.y +
+                                std::abs(m_nz[i]) * extents.z;
+            if (dist + reach < 0.0f)
+                return false;
+        }
+        return true;
+#endif
+    }
+}
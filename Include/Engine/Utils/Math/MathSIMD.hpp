@@ -0,0 +1,320 @@
+#pragma once
+
+// Низкоуровневые SIMD ядра для CEMath.
+// Бэкенд выбирается на этапе компиляции:
+//   CE_MATH_AVX2   - AVX2 (+FMA, если доступно)
+//   CE_MATH_SSE4   - SSE4.1
+//   CE_MATH_SSE2   - базовый SSE2 (любой x86-64)
+//   CE_MATH_SCALAR - переносимый скалярный код
+// Скалярный путь можно включить принудительно через CE_MATH_FORCE_SCALAR.
+// Все матрицы row-major (float[4][4]), как в Matrix4x4.
+
+#include <cmath>
+#include <cstddef>
+
+#if !defined(CE_MATH_FORCE_SCALAR) && defined(__AVX2__)
+#define CE_MATH_AVX2 1
+#define CE_MATH_SSE4 1
+#define CE_MATH_SSE2 1
+#elif !defined(CE_MATH_FORCE_SCALAR) && defined(__SSE4_1__)
+#define CE_MATH_SSE4 1
+#define CE_MATH_SSE2 1
+#elif !defined(CE_MATH_FORCE_SCALAR) && (defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64))
+#define CE_MATH_SSE2 1
+#else
+#define CE_MATH_SCALAR 1
+#endif
+
+#if defined(CE_MATH_AVX2)
+#include <immintrin.h>
+#elif defined(CE_MATH_SSE4)
+#include <smmintrin.h>
+#elif defined(CE_MATH_SSE2)
+#include <emmintrin.h>
+#endif
+
+namespace CEMath
+{
+    namespace SIMD
+    {
+        constexpr size_t ALIGNMENT = 16;
+
+        inline const char* GetBackendName() noexcept
+        {
+#if defined(CE_MATH_AVX2)
+            return "AVX2";
+#elif defined(CE_MATH_SSE4)
+            return "SSE4.1";
+#elif defined(CE_MATH_SSE2)
+            return "SSE2";
+#else
+            return "Scalar";
+#endif
+        }
+
+#if defined(CE_MATH_SSE2)
+        inline __m128 MulAdd(__m128 a, __m128 b, __m128 c) noexcept
+        {
+#if defined(__FMA__)
+            return _mm_fmadd_ps(a, b, c);
+#else
+            return _mm_add_ps(_mm_mul_ps(a, b), c);
+#endif
+        }
+
+        // Строка результата = a_row * B
+        inline __m128 LinearCombine(const float* aRow, __m128 b0, __m128 b1, __m128 b2, __m128 b3) noexcept
+        {
+            __m128 row = _mm_mul_ps(_mm_set1_ps(aRow[0]), b0);
+            row = MulAdd(_mm_set1_ps(aRow[1]), b1, row);
+            row = MulAdd(_mm_set1_ps(aRow[2]), b2, row);
+            row = MulAdd(_mm_set1_ps(aRow[3]), b3, row);
+            return row;
+        }
+#endif
+
+        // out = a * b; out может совпадать с a или b
+        inline void MultiplyMatrix(const float a[4][4], const float b[4][4], float out[4][4]) noexcept
+        {
+#if defined(CE_MATH_AVX2)
+            // Две строки результата за одну 256-битную операцию
+            const __m256 b0 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(b[0]));
+            const __m256 b1 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(b[1]));
+            const __m256 b2 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(b[2]));
+            const __m256 b3 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(b[3]));
+            const __m256 a01 = _mm256_loadu_ps(a[0]);
+            const __m256 a23 = _mm256_loadu_ps(a[2]);
+
+            __m256 r01 = _mm256_mul_ps(_mm256_permute_ps(a01, 0x00), b0);
+            __m256 r23 = _mm256_mul_ps(_mm256_permute_ps(a23, 0x00), b0);
+#if defined(__FMA__)
+            r01 = _mm256_fmadd_ps(_mm256_permute_ps(a01, 0x55), b1, r01);
+            r23 = _mm256_fmadd_ps(_mm256_permute_ps(a23, 0x55), b1, r23);
+            r01 = _mm256_fmadd_ps(_mm256_permute_ps(a01, 0xAA), b2, r01);
+            r23 = _mm256_fmadd_ps(_mm256_permute_ps(a23, 0xAA), b2, r23);
+            r01 = _mm256_fmadd_ps(_mm256_permute_ps(a01, 0xFF), b3, r01);
+            r23 = _mm256_fmadd_ps(_mm256_permute_ps(a23, 0xFF), b3, r23);
+#else
+            r01 = _mm256_add_ps(r01, _mm256_mul_ps(_mm256_permute_ps(a01, 0x55), b1));
+            r23 = _mm256_add_ps(r23, _mm256_mul_ps(_mm256_permute_ps(a23, 0x55), b1));
+            r01 = _mm256_add_ps(r01, _mm256_mul_ps(_mm256_permute_ps(a01, 0xAA), b2));
+            r23 = _mm256_add_ps(r23, _mm256_mul_ps(_mm256_permute_ps(a23, 0xAA), b2));
+            r01 = _mm256_add_ps(r01, _mm256_mul_ps(_mm256_permute_ps(a01, 0xFF), b3));
+            r23 = _mm256_add_ps(r23, _mm256_mul_ps(_mm256_permute_ps(a23, 0xFF), b3));
+#endif
+            _mm256_storeu_ps(out[0], r01);
+            _mm256_storeu_ps(out[2], r23);
+#elif defined(CE_MATH_SSE2)
+            const __m128 b0 = _mm_loadu_ps(b[0]);
+            const __m128 b1 = _mm_loadu_ps(b[1]);
+            const __m128 b2 = _mm_loadu_ps(b[2]);
+            const __m128 b3 = _mm_loadu_ps(b[3]);
+            const __m128 r0 = LinearCombine(a[0], b0, b1, b2, b3);
+            const __m128 r1 = LinearCombine(a[1], b0, b1, b2, b3);
+            const __m128 r2 = LinearCombine(a[2], b0, b1, b2, b3);
+            const __m128 r3 = LinearCombine(a[3], b0, b1, b2, b3);
+            _mm_storeu_ps(out[0], r0);
+            _mm_storeu_ps(out[1], r1);
+            _mm_storeu_ps(out[2], r2);
+            _mm_storeu_ps(out[3], r3);
+#else
+            float result[4][4];
+            for (int i = 0; i < 4; ++i)
+            {
+                for (int j = 0; j < 4; ++j)
+                {
+                    result[i][j] = a[i][0] * b[0][j] + a[i][1] * b[1][j] + a[i][2] * b[2][j] + a[i][3] * b[3][j];
+                }
+            }
+            for (int i = 0; i < 4; ++i)
+                for (int j = 0; j < 4; ++j)
+                    out[i][j] = result[i][j];
+#endif
+        }
+
+        // out = m * v (v - 4 компоненты)
+        inline void TransformVector(const float m[4][4], const float v[4], float out[4]) noexcept
+        {
+#if defined(CE_MATH_SSE2)
+            // Транспонируем на лету: out = col0*v.x + col1*v.y + col2*v.z + col3*v.w
+            __m128 r0 = _mm_loadu_ps(m[0]);
+            __m128 r1 = _mm_loadu_ps(m[1]);
+            __m128 r2 = _mm_loadu_ps(m[2]);
+            __m128 r3 = _mm_loadu_ps(m[3]);
+            _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+            __m128 result = _mm_mul_ps(r0, _mm_set1_ps(v[0]));
+            result = MulAdd(r1, _mm_set1_ps(v[1]), result);
+            result = MulAdd(r2, _mm_set1_ps(v[2]), result);
+            result = MulAdd(r3, _mm_set1_ps(v[3]), result);
+            _mm_storeu_ps(out, result);
+#else
+            const float x = v[0], y = v[1], z = v[2], w = v[3];
+            for (int i = 0; i < 4; ++i)
+            {
+                out[i] = m[i][0] * x + m[i][1] * y + m[i][2] * z + m[i][3] * w;
+            }
+#endif
+        }
+
+        inline void TransposeMatrix(const float m[4][4], float out[4][4]) noexcept
+        {
+#if defined(CE_MATH_SSE2)
+            __m128 r0 = _mm_loadu_ps(m[0]);
+            __m128 r1 = _mm_loadu_ps(m[1]);
+            __m128 r2 = _mm_loadu_ps(m[2]);
+            __m128 r3 = _mm_loadu_ps(m[3]);
+            _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+            _mm_storeu_ps(out[0], r0);
+            _mm_storeu_ps(out[1], r1);
+            _mm_storeu_ps(out[2], r2);
+            _mm_storeu_ps(out[3], r3);
+#else
+            float result[4][4];
+            for (int i = 0; i < 4; ++i)
+                for (int j = 0; j < 4; ++j)
+                    result[i][j] = m[j][i];
+            for (int i = 0; i < 4; ++i)
+                for (int j = 0; j < 4; ++j)
+                    out[i][j] = result[i][j];
+#endif
+        }
+
+#if defined(CE_MATH_SSE2)
+        // Перестановка компонент одного вектора
+        template <int X, int Y, int Z, int W>
+        inline __m128 Swizzle(__m128 v) noexcept
+        {
+            return _mm_shuffle_ps(v, v, _MM_SHUFFLE(W, Z, Y, X));
+        }
+
+        template <int X, int Y, int Z, int W>
+        inline __m128 Shuffle(__m128 a, __m128 b) noexcept
+        {
+            return _mm_shuffle_ps(a, b, _MM_SHUFFLE(W, Z, Y, X));
+        }
+
+        // Операции над 2x2 блоками, упакованными в один __m128 (row-major)
+        inline __m128 Mat2Mul(__m128 a, __m128 b) noexcept
+        {
+            return _mm_add_ps(_mm_mul_ps(a, Swizzle<0, 3, 0, 3>(b)),
+                                                _mm_mul_ps(Swizzle<1, 0, 3, 2>(a), Swizzle<2, 1, 2, 1>(b)));
+        }
+        // adj(a) * b
+        inline __m128 Mat2AdjMul(__m128 a, __m128 b) noexcept
+        {
+            return _mm_sub_ps(_mm_mul_ps(Swizzle<3, 3, 0, 0>(a), b),
+                                                _mm_mul_ps(Swizzle<1, 1, 2, 2>(a), Swizzle<2, 3, 0, 1>(b)));
+        }
+        // a * adj(b)
+        inline __m128 Mat2MulAdj(__m128 a, __m128 b) noexcept
+        {
+            return _mm_sub_ps(_mm_mul_ps(a, Swizzle<3, 0, 3, 0>(b)),
+                                                _mm_mul_ps(Swizzle<1, 0, 3, 2>(a), Swizzle<2, 1, 2, 1>(b)));
+        }
+#endif
+
+        // Возвращает определитель; если |det| < epsilon, out не изменяется
+        inline float InverseMatrix(const float m[4][4], float out[4][4], float epsilon) noexcept
+        {
+#if defined(CE_MATH_SSE2)
+            // Блочный метод: M = | A B |
+            //                    | C D |
+            const __m128 r0 = _mm_loadu_ps(m[0]);
+            const __m128 r1 = _mm_loadu_ps(m[1]);
+            const __m128 r2 = _mm_loadu_ps(m[2]);
+            const __m128 r3 = _mm_loadu_ps(m[3]);
+
+            const __m128 A = _mm_movelh_ps(r0, r1);
+            const __m128 B = _mm_movehl_ps(r1, r0);
+            const __m128 C = _mm_movelh_ps(r2, r3);
+            const __m128 D = _mm_movehl_ps(r3, r2);
+
+            // (|A| |B| |C| |D|)
+            const __m128 detSub = _mm_sub_ps(
+                    _mm_mul_ps(Shuffle<0, 2, 0, 2>(r0, r2), Shuffle<1, 3, 1, 3>(r1, r3)),
+                    _mm_mul_ps(Shuffle<1, 3, 1, 3>(r0, r2), Shuffle<0, 2, 0, 2>(r1, r3)));
+            const __m128 detA = Swizzle<0, 0, 0, 0>(detSub);
+            const __m128 detB = Swizzle<1, 1, 1, 1>(detSub);
+            const __m128 detC = Swizzle<2, 2, 2, 2>(detSub);
+            const __m128 detD = Swizzle<3, 3, 3, 3>(detSub);
+
+            const __m128 D_C = Mat2AdjMul(D, C);
+            const __m128 A_B = Mat2AdjMul(A, B);
+
+            __m128 X_ = _mm_sub_ps(_mm_mul_ps(detD, A), Mat2Mul(B, D_C));
+            __m128 W_ = _mm_sub_ps(_mm_mul_ps(detA, D), Mat2Mul(C, A_B));
+            __m128 Y_ = _mm_sub_ps(_mm_mul_ps(detB, C), Mat2MulAdj(D, A_B));
+            __m128 Z_ = _mm_sub_ps(_mm_mul_ps(detC, B), Mat2MulAdj(A, D_C));
+
+            // |M| = |A||D| + |B||C| - tr((A#B)(D#C))
+            __m128 tr = _mm_mul_ps(A_B, Swizzle<0, 2, 1, 3>(D_C));
+            tr = _mm_add_ps(tr, Swizzle<2, 3, 0, 1>(tr));
+            tr = _mm_add_ps(tr, Swizzle<1, 0, 3, 2>(tr));
+            __m128 detM = _mm_add_ps(_mm_mul_ps(detA, detD), _mm_mul_ps(detB, detC));
+            detM = _mm_sub_ps(detM, tr);
+
+            const float det = _mm_cvtss_f32(detM);
+            if (std::abs(det) < epsilon)
+                return det;
+
+            const __m128 rDetM = _mm_div_ps(_mm_setr_ps(1.0f, -1.0f, -1.0f, 1.0f), detM);
+            X_ = _mm_mul_ps(X_, rDetM);
+            Y_ = _mm_mul_ps(Y_, rDetM);
+            Z_ = _mm_mul_ps(Z_, rDetM);
+            W_ = _mm_mul_ps(W_, rDetM);
+
+            _mm_storeu_ps(out[0], Shuffle<3, 1, 3, 1>(X_, Y_));
+            _mm_storeu_ps(out[1], Shuffle<2, 0, 2, 0>(X_, Y_));
+            _mm_storeu_ps(out[2], Shuffle<3, 1, 3, 1>(Z_, W_));
+            _mm_storeu_ps(out[3], Shuffle<2, 0, 2, 0>(Z_, W_));
+            return det;
+#else
+            // Разложение по 2x2 минорам
+            const float s0 = m[0][0] * m[1][1] - m[1][0] * m[0][1];
+            const float s1 = m[0][0] * m[1][2] - m[1][0] * m[0][2];
+            const float s2 = m[0][0] * m[1][3] - m[1][0] * m[0][3];
+            const float s3 = m[0][1] * m[1][2] - m[1][1] * m[0][2];
+            const float s4 = m[0][1] * m[1][3] - m[1][1] * m[0][3];
+            const float s5 = m[0][2] * m[1][3] - m[1][2] * m[0][3];
+
+            const float c5 = m[2][2] * m[3][3] - m[3][2] * m[2][3];
+            const float c4 = m[2][1] * m[3][3] - m[3][1] * m[2][3];
+            const float c3 = m[2][1] * m[3][2] - m[3][1] * m[2][2];
+            const float c2 = m[2][0] * m[3][3] - m[3][0] * m[2][3];
+            const float c1 = m[2][0] * m[3][2] - m[3][0] * m[2][2];
+            const float c0 = m[2][0] * m[3][1] - m[3][0] * m[2][1];
+
+            const float det = s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+            if (std::abs(det) < epsilon)
+                return det;
+
+            const float invDet = 1.0f / det;
+            float r[4][4];
+            r[0][0] = ( m[1][1] * c5 - m[1][2] * c4 + m[1][3] * c3) * invDet;
+            r[0][1] = (-m[0][1] * c5 + m[0][2] * c4 - m[0][3] * c3) * invDet;
+            r[0][2] = ( m[3][1] * s5 - m[3][2] * s4 + m[3][3] * s3) * invDet;
+            r[0][3] = (-m[2][1] * s5 + m[2][2] * s4 - m[2][3] * s3) * invDet;
+
+            r[1][0] = (-m[1][0] * c5 + m[1][2] * c2 - m[1][3] * c1) * invDet;
+            r[1][1] = ( m[0][0] * c5 - m[0][2] * c2 + m[0][3] * c1) * invDet;
+            r[1][2] = (-m[3][0] * s5 + m[3][2] * s2 - m[3][3] * s1) * invDet;
+            r[1][3] = ( m[2][0] * s5 - m[2][2] * s2 + m[2][3] * s1) * invDet;
+
+            r[2][0] = ( m[1][0] * c4 - m[1][1] * c2 + m[1][3] * c0) * invDet;
+            r[2][1] = (-m[0][0] * c4 + m[0][1] * c2 - m[0][3] * c0) * invDet;
+            r[2][2] = ( m[3][0] * s4 - m[3][1] * s2 + m[3][3] * s0) * invDet;
+            r[2][3] = (-m[2][0] * s4 + m[2][1] * s2 - m[2][3] * s0) * invDet;
+
+            r[3][0] = (-m[1][0] * c3 + m[1][1] * c1 - m[1][2] * c0) * invDet;
+            r[3][1] = ( m[0][0] * c3 - m[0][1] * c1 + m[0][2] * c0) * invDet;
+            r[3][2] = (-m[3][0] * s3 + m[3][1] * s1 - m[3][2] * s0) * invDet;
+            r[3][3] = ( m[2][0] * s3 - m[2][1] * s1 + m[2][2] * s0) * invDet;
+
+            for (int i = 0; i < 4; ++i)
+                for (int j = 0; j < 4; ++j)
+                    out[i][j] = r[i][j];
+            return det;
+#endif
+        }
+    }
+}
@@ -1,11 +1,13 @@
 #pragma once
 
 #include "Math/MathConstants.hpp"
+#include "Math/MathSIMD.hpp"
 #include "Math/Vector3D.hpp"
 #include "Math/Vector4D.hpp"
 
 
 #include <cmath>
+#include <cstddef>
 #include <cstdint>
 #include <iostream>
 #include <iomanip>
@@ -14,10 +16,11 @@ namespace CEMath
 {
     class Quaternion;
 
+    // Хранилище выровнено по 16 байт, чтобы строки грузились одной SIMD инструкцией
     class Matrix4x4
     {
     public:
-        float m[4][4];
+        alignas(16) float m[4][4];
         
         // Constructors
         Matrix4x4() noexcept;
@@ -79,6 +82,16 @@ namespace CEMath
         // For Vulkan (Y-axis down, Z-axis [0, 1])
         static Matrix4x4 VulkanPerspective(float fovY, float aspect, float zNear, float zFar) noexcept;
         static Matrix4x4 VulkanOrthographic(float left, float right, float bottom, float top, float zNear, float zFar) noexcept;
+
+        // Batch operations
+        // out[i] = matrix * points[i] (w = 1); in и out могут совпадать
+        static void TransformPoints(const Matrix4x4& matrix, const Vector3D* points, Vector3D* out, size_t count) noexcept;
+        // out[i] = matrix * vectors[i]; in и out могут совпадать
+        static void TransformVectors(const Matrix4x4& matrix, const Vector4D* vectors, Vector4D* out, size_t count) noexcept;
+        // out[i] = lhs[i] * rhs[i]
+        static void MultiplyBatch(const Matrix4x4* lhs, const Matrix4x4* rhs, Matrix4x4* out, size_t count) noexcept;
+        // out[i] = lhs * rhs[i]
+        static void MultiplyBatch(const Matrix4x4& lhs, const Matrix4x4* rhs, Matrix4x4* out, size_t count) noexcept;
         
          friend std::ostream& operator<<(std::ostream& os, const Matrix4x4& mat);
          std::string ToString() const;
@@ -88,7 +101,68 @@ namespace CEMath
          static const Matrix4x4 Identity;
          static const Matrix4x4 Zero;
     };
-    
+
+    // Горячие операции определены в заголовке, чтобы компилятор мог их встроить
+    inline Matrix4x4::Matrix4x4() noexcept
+        : m{{1.0f, 0.0f, 0.0f, 0.0f},
+            {0.0f, 1.0f, 0.0f, 0.0f},
+            {0.0f, 0.0f, 1.0f, 0.0f},
+            {0.0f, 0.0f, 0.0f, 1.0f}}
+    {
+    }
+
+    inline Matrix4x4 Matrix4x4::operator*(const Matrix4x4& other) const noexcept
+    {
+        Matrix4x4 result;
+        SIMD::MultiplyMatrix(m, other.m, result.m);
+        return result;
+    }
+
+    inline Matrix4x4& Matrix4x4::operator*=(const Matrix4x4& other) noexcept
+    {
+        SIMD::MultiplyMatrix(m, other.m, m);
+        return *this;
+    }
+
+    inline Vector4D Matrix4x4::operator*(const Vector4D& vector) const noexcept
+    {
+        Vector4D result;
+        SIMD::TransformVector(m, &vector.x, &result.x);
+        return result;
+    }
+
+    inline Vector3D Matrix4x4::operator*(const Vector3D& vector) const noexcept
+    {
+        Vector4D result = *this * Vector4D(vector, 1.0f);
+        return result.ToVector3D();
+    }
+
+    inline Matrix4x4 Matrix4x4::Transposed() const noexcept
+    {
+        Matrix4x4 result;
+        SIMD::TransposeMatrix(m, result.m);
+        return result;
+    }
+
+    inline Matrix4x4& Matrix4x4::Transpose() noexcept
+    {
+        SIMD::TransposeMatrix(m, m);
+        return *this;
+    }
+
+    inline Matrix4x4 Matrix4x4::Inversed() const noexcept
+    {
+        Matrix4x4 inv;
+        SIMD::InverseMatrix(m, inv.m, EPSILON); // Identity if matrix is singular
+        return inv;
+    }
+
+    inline Matrix4x4& Matrix4x4::Inverse() noexcept
+    {
+        *this = Inversed();
+        return *this;
+    }
+
      inline std::ostream& operator<<(std::ostream& os, const Matrix4x4& mat)
     {
         os << "Matrix4x4:\n";
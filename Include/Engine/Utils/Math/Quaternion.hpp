@@ -13,7 +13,7 @@
 namespace CEMath
 {
   class Matrix4x4;
-  class Quaternion
+  class alignas(16) Quaternion
   {
    public:
     float x, y, z, w;
@@ -104,4 +104,30 @@ namespace CEMath
         os << "(x=" << quat.x << ", y=" << quat.y << ", z=" << quat.z << ", w=" << quat.w << ")";
         return os;
     }
+
+    // Простые операции встраиваются в месте вызова
+    inline Quaternion Quaternion::operator*(const Quaternion& other) const noexcept
+    {
+        return Quaternion(
+            w * other.x + x * other.w + y * other.z - z * other.y,
+            w * other.y - x * other.z + y * other.w + z * other.x,
+            w * other.z + x * other.y - y * other.x + z * other.w,
+            w * other.w - x * other.x - y * other.y - z * other.z
+        );
+    }
+
+    inline float Quaternion::Length() const noexcept
+    {
+        return std::sqrt(x * x + y * y + z * z + w * w);
+    }
+
+    inline float Quaternion::LengthSquared() const noexcept
+    {
+        return x * x + y * y + z * z + w * w;
+    }
+
+    inline float Quaternion::Dot(const Quaternion& other) const noexcept
+    {
+        return x * other.x + y * other.y + z * other.z + w * other.w;
+    }
 }
\ No newline at end of file
@@ -125,4 +125,78 @@ namespace CEMath
         os << "(x=" << vec.x << ", y=" << vec.y << ", z=" << vec.z << ")";
         return os;
     }
+
+    // Простые операции встраиваются в месте вызова
+    inline Vector3D Vector3D::operator+(const Vector3D& other) const noexcept
+    {
+        return Vector3D(x + other.x, y + other.y, z + other.z);
+    }
+
+    inline Vector3D Vector3D::operator-(const Vector3D& other) const noexcept
+    {
+        return Vector3D(x - other.x, y - other.y, z - other.z);
+    }
+
+    inline Vector3D Vector3D::operator*(const Vector3D& other) const noexcept
+    {
+        return Vector3D(x * other.x, y * other.y, z * other.z);
+    }
+
+    inline Vector3D Vector3D::operator*(float scalar) const noexcept
+    {
+        return Vector3D(x * scalar, y * scalar, z * scalar);
+    }
+
+    inline Vector3D& Vector3D::operator+=(const Vector3D& other) noexcept
+    {
+        x += other.x;
+        y += other.y;
+        z += other.z;
+        return *this;
+    }
+
+    inline Vector3D& Vector3D::operator-=(const Vector3D& other) noexcept
+    {
+        x -= other.x;
+        y -= other.y;
+        z -= other.z;
+        return *this;
+    }
+
+    inline Vector3D& Vector3D::operator*=(float scalar) noexcept
+    {
+        x *= scalar;
+        y *= scalar;
+        z *= scalar;
+        return *this;
+    }
+
+    inline Vector3D Vector3D::operator-() const noexcept
+    {
+        return Vector3D(-x, -y, -z);
+    }
+
+    inline float Vector3D::Length() const noexcept
+    {
+        return std::sqrt(x * x + y * y + z * z);
+    }
+
+    inline float Vector3D::LengthSquared() const noexcept
+    {
+        return x * x + y * y + z * z;
+    }
+
+    inline float Vector3D::Dot(const Vector3D& other) const noexcept
+    {
+        return x * other.x + y * other.y + z * other.z;
+    }
+
+    inline Vector3D Vector3D::Cross(const Vector3D& other) const noexcept
+    {
+        return Vector3D(
+            y * other.z - z * other.y,
+            z * other.x - x * other.z,
+            x * other.y - y * other.x
+        );
+    }
 }
\ No newline at end of file
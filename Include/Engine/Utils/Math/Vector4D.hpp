@@ -7,7 +7,7 @@
 
 namespace CEMath
 {
-    class Vector4D
+    class alignas(16) Vector4D
     {
     public:
         float x, y, z, w;
@@ -45,12 +45,12 @@ void Application::Initialize()
     CORE_ERROR("Failed to get SDL window for input system");
   }
 
-
-
-  
-  m_RenderData.SetupDefaultLighting();  
-
-
+  // 3. Рендер поток: игровой поток готовит кадр N + 1, пока рисуется кадр N
+  m_RenderThread = std::make_unique<RenderThread>(m_RenderSystem.get(), static_cast<uint32_t>(m_info->RenderFrameBuffers));
+  if (m_info->UseRenderThread)
+  {
+    m_RenderThread->Start();
+  }
 
   m_LastFrameTime = CEGetCurrentTime();
 
@@ -62,16 +62,10 @@ void Application::Run()
   CORE_DEBUG("Starting main loop");
 
   // ВЫЗЫВАЕМ BeginPlay ПЕРЕД ОСНОВНЫМ ЦИКЛОМ
+  // Освещение мира по умолчанию попадает в каждый снимок через CollectRenderData
   if (m_GameInstance)
   {
     m_GameInstance->BeginPlay();
-
-    // Настраиваем освещение после того как мир загружен в BeginPlay
-    if (auto* world = m_GameInstance->GetCurrentWorld())
-    {
-      m_RenderData.lighting = world->GetDefaultLighting();
-      CORE_DEBUG("RenderData lighting initialized from world default (lights=", m_RenderData.lighting.lightCount, ")");
-    }
   }
   m_IsRunning = true;
 
@@ -86,6 +80,7 @@ void Application::Run()
 
     Render();
 
+    CE_PROFILE_END_FRAME();
 
     if (m_RenderSystem->ShouldClose())
     {
@@ -94,6 +89,12 @@ void Application::Run()
 
     m_RenderSystem->PollEvents();
   }
+
+  // Дорисовываем отданные кадры; ошибка рендер потока всплывает здесь
+  if (m_RenderThread)
+  {
+    m_RenderThread->Stop();
+  }
 }
 
 void Application::CalculateDeltaTime()
@@ -114,6 +115,7 @@ void Application::ProcessInput()
 
 void Application::Update()
 {
+  CE_PROFILE_SCOPE("Application::Update");
 
   CInputSystem::Get().Update(m_DeltaTime);
 
@@ -126,20 +128,22 @@ void Application::Update()
 
 void Application::Render()
 {
+  CE_PROFILE_SCOPE("Application::Render");
 
-  m_RenderData.Clear();
+  if (!m_RenderThread)
+    return;
 
+  // Ждет свободный снимок, если рендер отстает больше чем на RenderFrameBuffers - 1 кадр
+  FrameRenderData* renderData = m_RenderThread->BeginFrame();
+  if (!renderData)
+    return;
 
   if (m_GameInstance && m_GameInstance->GetCurrentWorld())
   {
-    m_GameInstance->GetCurrentWorld()->CollectRenderData(m_RenderData);
+    m_GameInstance->GetCurrentWorld()->CollectRenderData(*renderData);
   }
 
-
-  if (m_RenderSystem)
-  {
-    m_RenderSystem->DrawFrame(m_RenderData);
-  }
+  m_RenderThread->EndFrame();
 }
 
 void Application::Shutdown()
@@ -148,6 +152,8 @@ void Application::Shutdown()
 
   m_IsRunning = false;
 
+  // Рендер поток останавливается первым: он читает снимки мира и использует RenderSystem
+  m_RenderThread.reset();
 
   CInputSystem::Get().Shutdown();
 
@@ -0,0 +1,240 @@
+#include "Engine/Application/HeadlessApplication.h"
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+#include "Engine/Core/CommandLine.h"
+#include "Engine/GamePlay/Input/InputSystem.h"
+#include "Engine/GamePlay/World/Levels/Level.h"
+#include "Engine/Utils/Logger.h"
+
+namespace
+{
+  using HeadlessClock = std::chrono::steady_clock;
+
+  double ElapsedMs(HeadlessClock::time_point start, HeadlessClock::time_point end)
+  {
+    return std::chrono::duration<double, std::milli>(end - start).count();
+  }
+
+  void WritePhase(std::ostringstream& out, const char* name, const FPhaseTimings& phase, bool last)
+  {
+    const size_t count = phase.Samples.size();
+    const double total = phase.Total();
+    out << "    \"" << name << "\": {"
+        << "\"total_ms\": " << total
+        << ", \"mean_ms\": " << (count ? total / count : 0.0)
+        << ", \"min_ms\": " << phase.Percentile(0.0)
+        << ", \"p50_ms\": " << phase.Percentile(0.5)
+        << ", \"p99_ms\": " << phase.Percentile(0.99)
+        << ", \"max_ms\": " << phase.Percentile(1.0)
+        << "}" << (last ? "\n" : ",\n");
+  }
+}  // namespace
+
+FHeadlessSettings FHeadlessSettings::FromCommandLine()
+{
+  auto& cmd = CommandLine::Get();
+  FHeadlessSettings settings;
+
+  settings.Duration = std::max(0.0f, cmd.GetFloat("duration", settings.Duration));
+  // Если задан только бюджет времени, количество кадров не ограничиваем
+  int defaultFrames = (settings.Duration > 0.0f && !cmd.HasFlag("frames")) ? 0 : static_cast<int>(settings.Frames);
+  settings.Frames = static_cast<uint32_t>(std::max(0, cmd.GetInt("frames", defaultFrames)));
+
+  float fixedDt = cmd.GetFloat("fixed-dt", settings.FixedDeltaTime);
+  if (fixedDt > 0.0f)
+  {
+    settings.FixedDeltaTime = fixedDt;
+  }
+  settings.OutputPath = cmd.GetString("bench-output", settings.OutputPath);
+  return settings;
+}
+
+double FPhaseTimings::Total() const
+{
+  double total = 0.0;
+  for (double sample : Samples)
+  {
+    total += sample;
+  }
+  return total;
+}
+
+double FPhaseTimings::Percentile(double p) const
+{
+  if (Samples.empty())
+    return 0.0;
+
+  std::vector<double> sorted = Samples;
+  size_t index = static_cast<size_t>(p * (sorted.size() - 1) + 0.5);
+  index = std::min(index, sorted.size() - 1);
+  std::nth_element(sorted.begin(), sorted.begin() + index, sorted.end());
+  return sorted[index];
+}
+
+HeadlessApplication::HeadlessApplication(const FHeadlessSettings& settings) : m_Settings{settings}
+{
+  CORE_DEBUG("HeadlessApplication created");
+}
+
+HeadlessApplication::~HeadlessApplication()
+{
+  Shutdown();
+}
+
+void HeadlessApplication::Initialize()
+{
+  CORE_DISPLAY("=== Initializing Headless Application ===");
+
+  // Окна нет: InputSystem не опрашивает SDL и только обновляет компоненты
+  CInputSystem::Get().SetHeadless(true);
+
+  if (!m_GameInstance)
+  {
+    m_GameInstance = std::make_unique<CGameInstance>();
+  }
+  m_GameInstance->Initialize();
+
+  m_RenderData.SetupDefaultLighting();
+
+  size_t reserve = m_Settings.Frames > 0 ? m_Settings.Frames : 4096;
+  m_InputTimings.Reserve(reserve);
+  m_TickTimings.Reserve(reserve);
+  m_CollectTimings.Reserve(reserve);
+  m_FrameTimings.Reserve(reserve);
+
+  CORE_DISPLAY("=== Headless Application Initialized ===");
+}
+
+void HeadlessApplication::Run()
+{
+  if (!m_GameInstance)
+    return;
+
+  m_GameInstance->BeginPlay();
+  if (auto* world = m_GameInstance->GetCurrentWorld())
+  {
+    m_RenderData.lighting = world->GetDefaultLighting();
+  }
+
+  CORE_DISPLAY("Headless run: frames=", m_Settings.Frames, " dt=", m_Settings.FixedDeltaTime, " budget=", m_Settings.Duration);
+
+  const auto runStart = HeadlessClock::now();
+  while (true)
+  {
+    if (m_Settings.Frames > 0 && m_FrameCount >= m_Settings.Frames)
+      break;
+    if (m_Settings.Duration > 0.0f && ElapsedMs(runStart, HeadlessClock::now()) >= m_Settings.Duration * 1000.0)
+      break;
+    if (m_Settings.Frames == 0 && m_Settings.Duration <= 0.0f)
+      break;
+
+    StepFrame();
+  }
+  m_WallTime = ElapsedMs(runStart, HeadlessClock::now()) / 1000.0;
+
+  CORE_DISPLAY("Headless run finished: ", m_FrameCount, " frames");
+}
+
+void HeadlessApplication::StepFrame()
+{
+  const float dt = m_Settings.FixedDeltaTime;
+
+  const auto frameStart = HeadlessClock::now();
+  CInputSystem::Get().Update(dt);
+  const auto inputEnd = HeadlessClock::now();
+
+  m_GameInstance->Tick(dt);
+  const auto tickEnd = HeadlessClock::now();
+
+  // Данные рендера собираются как обычно, но никуда не отправляются
+  m_RenderData.Clear();
+  if (auto* world = m_GameInstance->GetCurrentWorld())
+  {
+    world->CollectRenderData(m_RenderData);
+  }
+  const auto collectEnd = HeadlessClock::now();
+
+  m_LastRenderObjectCount = m_RenderData.renderObjects.size();
+  m_LastCulledObjectCount = m_RenderData.culling.culledObjects;
+
+  m_InputTimings.Add(ElapsedMs(frameStart, inputEnd));
+  m_TickTimings.Add(ElapsedMs(inputEnd, tickEnd));
+  m_CollectTimings.Add(ElapsedMs(tickEnd, collectEnd));
+  m_FrameTimings.Add(ElapsedMs(frameStart, collectEnd));
+  ++m_FrameCount;
+
+  CE_PROFILE_END_FRAME();
+}
+
+std::string HeadlessApplication::BuildReport() const
+{
+  size_t actorCount = 0;
+  if (m_GameInstance && m_GameInstance->GetCurrentWorld())
+  {
+    if (auto* level = m_GameInstance->GetCurrentWorld()->GetCurrentLevel())
+    {
+      actorCount = level->GetActors().size();
+    }
+  }
+
+  std::ostringstream out;
+  out << "{\n";
+  out << "  \"mode\": \"headless\",\n";
+  out << "  \"frames\": " << m_FrameCount << ",\n";
+  out << "  \"fixed_dt\": " << m_Settings.FixedDeltaTime << ",\n";
+  out << "  \"simulated_seconds\": " << m_FrameCount * static_cast<double>(m_Settings.FixedDeltaTime) << ",\n";
+  out << "  \"wall_seconds\": " << m_WallTime << ",\n";
+  out << "  \"actors\": " << actorCount << ",\n";
+  out << "  \"render_objects\": " << m_LastRenderObjectCount << ",\n";
+  out << "  \"culled_objects\": " << m_LastCulledObjectCount << ",\n";
+  out << "  \"phases\": {\n";
+  WritePhase(out, "input", m_InputTimings, false);
+  WritePhase(out, "tick", m_TickTimings, false);
+  WritePhase(out, "collect_render_data", m_CollectTimings, false);
+  WritePhase(out, "frame", m_FrameTimings, true);
+  out << "  }\n";
+  out << "}\n";
+  return out.str();
+}
+
+bool HeadlessApplication::WriteReport() const
+{
+  const std::string report = BuildReport();
+
+  if (m_Settings.OutputPath.empty())
+  {
+    // Логгер пишет в консоль со своего потока: дописываем очередь и отдаем stdout отчету.
+    // Второй Flush дожидается пачки, начатой до выключения консоли; дальше лог идет только в файл
+    CE::CLogger::Flush();
+    CE::CLogger::SetConsoleOutput(false);
+    CE::CLogger::Flush();
+    std::cout << report << std::flush;
+    return true;
+  }
+
+  std::ofstream file(m_Settings.OutputPath, std::ios::trunc);
+  if (!file.is_open())
+  {
+    CORE_ERROR("Failed to write headless report: ", m_Settings.OutputPath);
+    return false;
+  }
+  file << report;
+  CORE_DISPLAY("Headless report written to: ", m_Settings.OutputPath);
+  return true;
+}
+
+void HeadlessApplication::Shutdown()
+{
+  CInputSystem::Get().Shutdown();
+
+  if (m_GameInstance)
+  {
+    m_GameInstance->Shutdown();
+    m_GameInstance.reset();
+  }
+}
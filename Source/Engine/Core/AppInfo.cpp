@@ -1,5 +1,7 @@
 #include "Engine/Core/AppInfo.h"
 
+#include <algorithm>
+
 #include "Engine/Core/Config.h"
 
 void AppInfo::LoadFromConfig()
@@ -12,6 +14,9 @@ void AppInfo::LoadFromConfig()
   VSync = config.GetBool("VSync", true);
   MSAA = config.GetInt("MSAASamples", 4);
   MaxFPS = config.GetInt("MaxFPS", 120);
+  Bindless = config.GetBool("Bindless", true);
+  UseRenderThread = config.GetBool("RenderThread", true);
+  RenderFrameBuffers = std::clamp(config.GetInt("RenderFrameBuffers", 2), 2, 3);
 
   CORE_DEBUG("AppInfo loaded from config: ", Width, "x", Height,
                 " Fullscreen:", Fullscreen, " VSync:", VSync);
@@ -4,11 +4,19 @@
 #include "Engine/Core/AppInfo.h"
 #include "Engine/Core/CommandLine.h"
 #include "Engine/Core/Config.h"
+#include "Engine/Core/Jobs/JobSystem.h"
+#include "Engine/Application/HeadlessApplication.h"
+#include "Engine/Core/Utilities/MeshCooker.h"
 #include "Game/Application/GameApplication.h"
+#include "Game/GameInstance/GameInstance.h"
 
 
   void ApplyCommandLineOverrides(Config& config);
   AppInfo CreateAppInfoFromConfig();
+  int RunHeadless();
+  int RunMeshCook();
+  void StartProfiling();
+  void FinishProfiling();
 
   int GuardedMain(int argc, char* argv[])
   {
@@ -20,12 +28,29 @@
       CommandLine::Parse(argc, argv);
     }
 
+    // Пул задач: --job-workers=<N>, 0 - все выполняется на игровом потоке
+    if (CommandLine::Get().HasFlag("job-workers"))
+    {
+      int workers = std::max(0, CommandLine::Get().GetInt("job-workers", static_cast<int>(CJobSystem::GetDefaultWorkerCount())));
+      CJobSystem::Get().Start(static_cast<uint32_t>(workers));
+      CORE_DISPLAY("Command line override: JobWorkers = ", workers);
+    }
+
+    // Профилирование: --profile - сводка по кадрам в лог, --profile-trace[=<file>] - Chrome trace
+    StartProfiling();
+
+    // Офлайн-запекание мешей: --cook-meshes[=<dir>] [--force]
+    if (CommandLine::Get().HasFlag("cook-meshes"))
+    {
+      return RunMeshCook();
+    }
+
     // Check for headless mode
     bool isHeadless = CommandLine::Get().HasFlag("headless") || CommandLine::Get().HasFlag("h");
     if (isHeadless)
     {
       CORE_DISPLAY("Running in headless mode - skipping rendering");
-      return 0;  // Exit early in headless mode
+      return RunHeadless();
     }
 
     std::string configFile = CommandLine::Get().GetString("config", "engine.cfg");
@@ -47,6 +72,7 @@
     auto app = GameApp(&ApInfo);
     app.Initialize();
     app.Run();
+    FinishProfiling();
     app.Shutdown();
 
 
@@ -55,6 +81,68 @@
     return 0;
   }
 
+  // Headless: мир тикается с фиксированным шагом без RenderSystem/SDL,
+  // тайминги фаз пишутся в JSON (--frames, --duration, --fixed-dt, --bench-output)
+  int RunHeadless()
+  {
+    HeadlessApplication app(FHeadlessSettings::FromCommandLine());
+    app.SetGameInstance(std::make_unique<MainGameInstance>());
+    app.Initialize();
+    app.Run();
+    FinishProfiling();
+    bool written = app.WriteReport();
+    app.Shutdown();
+
+    return written ? 0 : 1;
+  }
+
+  int RunMeshCook()
+  {
+    auto& cmd = CommandLine::Get();
+    std::string directory = cmd.GetString("cook-meshes", "true");
+    if (directory == "true")
+    {
+      directory = "Assets/Meshes";
+    }
+
+    uint32_t cooked = MeshCooker::CookDirectory(directory, cmd.HasFlag("force"));
+    CORE_DISPLAY("Mesh cook finished, cooked files: ", cooked);
+    return 0;
+  }
+
+  void StartProfiling()
+  {
+    auto& cmd = CommandLine::Get();
+    CProfiler::SetThreadName("Game Thread");
+    if (!cmd.HasFlag("profile") && !cmd.HasFlag("profile-trace"))
+      return;
+
+    CProfiler& profiler = CProfiler::Get();
+    profiler.SetSummaryWindow(static_cast<uint32_t>(std::max(1, cmd.GetInt("profile-window", 120))));
+    profiler.SetLogSummary(cmd.HasFlag("profile"));
+    if (cmd.HasFlag("profile-trace"))
+    {
+      profiler.BeginCapture();
+    }
+    profiler.SetEnabled(true);
+    CORE_DISPLAY("Profiler enabled", CE_ENABLE_PROFILER ? "" : " (markers compiled out, ENGINE_PROFILER=OFF)");
+  }
+
+  void FinishProfiling()
+  {
+    CProfiler& profiler = CProfiler::Get();
+    if (!profiler.IsCapturing())
+      return;
+
+    profiler.EndCapture();
+    std::string path = CommandLine::Get().GetString("profile-trace", "true");
+    if (path == "true")
+    {
+      path = "profile_trace.json";
+    }
+    profiler.WriteChromeTrace(path);
+  }
+
   void ApplyCommandLineOverrides(Config& config)
   {
     auto& cmd = CommandLine::Get();
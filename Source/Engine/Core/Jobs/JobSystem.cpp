@@ -0,0 +1,194 @@
+#include "Engine/Core/Jobs/JobSystem.h"
+
+#include "CoreMinimal.h"
+
+namespace
+{
+  // Индекс очереди текущего потока; 0 у всех потоков вне пула
+  thread_local uint32_t t_QueueIndex = 0;
+
+  // xorshift: случайная жертва кражи, чтобы воры не толпились у одной очереди
+  uint32_t NextVictimSeed()
+  {
+    thread_local uint32_t state = 0x9E3779B9u ^ static_cast<uint32_t>(std::hash<std::thread::id>{}(std::this_thread::get_id()));
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    return state;
+  }
+}  // namespace
+
+CJobSystem& CJobSystem::Get()
+{
+  static CJobSystem instance;
+  return instance;
+}
+
+CJobSystem::CJobSystem()
+{
+  Start(GetDefaultWorkerCount());
+}
+
+CJobSystem::~CJobSystem()
+{
+  Stop();
+}
+
+void CJobSystem::Start(uint32_t WorkerCount)
+{
+  Stop();
+
+  m_Stopping = false;
+  m_QueuedJobs.store(0);
+  m_Queues.clear();
+  for (uint32_t i = 0; i < WorkerCount + 1; ++i)
+  {
+    m_Queues.push_back(std::make_unique<FWorkerQueue>());
+  }
+
+  m_Workers.reserve(WorkerCount);
+  for (uint32_t i = 0; i < WorkerCount; ++i)
+  {
+    m_Workers.emplace_back(&CJobSystem::WorkerLoop, this, i + 1);
+  }
+  CORE_DEBUG("Job system started, workers: ", WorkerCount);
+}
+
+uint32_t CJobSystem::GetDefaultWorkerCount()
+{
+  const uint32_t hardwareThreads = std::thread::hardware_concurrency();
+  return hardwareThreads > 1 ? hardwareThreads - 1 : 0;
+}
+
+void CJobSystem::Stop()
+{
+  if (m_Workers.empty())
+    return;
+
+  {
+    std::lock_guard<std::mutex> lock(m_SleepMutex);
+    m_Stopping = true;
+  }
+  m_WakeUp.notify_all();
+
+  for (auto& worker : m_Workers)
+  {
+    worker.join();
+  }
+  m_Workers.clear();
+  // Очереди остаются: без рабочих Dispatch и Wait работают на вызывающем потоке
+}
+
+void CJobSystem::Dispatch(const FJob& Job)
+{
+  if (Job.Counter)
+  {
+    Job.Counter->Pending.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  FWorkerQueue& queue = *m_Queues[GetCurrentQueueIndex()];
+  {
+    std::lock_guard<std::mutex> lock(queue.Mutex);
+    queue.Jobs.push_back(Job);
+  }
+
+  // Пара seq_cst с WorkerLoop: либо рабочий увидит задачу, либо мы увидим, что он спит
+  m_QueuedJobs.fetch_add(1);
+  if (m_SleepingWorkers.load() > 0)
+  {
+    std::lock_guard<std::mutex> lock(m_SleepMutex);
+    m_WakeUp.notify_one();
+  }
+}
+
+void CJobSystem::Wait(FJobCounter& Counter)
+{
+  const uint32_t queueIndex = GetCurrentQueueIndex();
+  while (!Counter.IsDone())
+  {
+    FJob job;
+    if (TryPop(queueIndex, job) || TrySteal(queueIndex, job))
+    {
+      Execute(job);
+    }
+    else
+    {
+      // Оставшиеся задачи уже выполняются другими потоками
+      std::this_thread::yield();
+    }
+  }
+}
+
+void CJobSystem::WorkerLoop(uint32_t QueueIndex)
+{
+  t_QueueIndex = QueueIndex;
+  CProfiler::SetThreadName("Job Worker " + std::to_string(QueueIndex));
+
+  while (true)
+  {
+    FJob job;
+    if (TryPop(QueueIndex, job) || TrySteal(QueueIndex, job))
+    {
+      Execute(job);
+      continue;
+    }
+
+    std::unique_lock<std::mutex> lock(m_SleepMutex);
+    m_SleepingWorkers.fetch_add(1);
+    m_WakeUp.wait(lock, [this] { return m_Stopping || m_QueuedJobs.load() > 0; });
+    m_SleepingWorkers.fetch_sub(1);
+    if (m_Stopping)
+      return;
+  }
+}
+
+bool CJobSystem::TryPop(uint32_t QueueIndex, FJob& OutJob)
+{
+  FWorkerQueue& queue = *m_Queues[QueueIndex];
+  std::lock_guard<std::mutex> lock(queue.Mutex);
+  if (queue.Jobs.empty())
+    return false;
+
+  OutJob = queue.Jobs.back();
+  queue.Jobs.pop_back();
+  m_QueuedJobs.fetch_sub(1);
+  return true;
+}
+
+bool CJobSystem::TrySteal(uint32_t ThiefIndex, FJob& OutJob)
+{
+  const uint32_t queueCount = static_cast<uint32_t>(m_Queues.size());
+  const uint32_t start = NextVictimSeed() % queueCount;
+  for (uint32_t i = 0; i < queueCount; ++i)
+  {
+    const uint32_t victim = (start + i) % queueCount;
+    if (victim == ThiefIndex)
+      continue;
+
+    FWorkerQueue& queue = *m_Queues[victim];
+    std::lock_guard<std::mutex> lock(queue.Mutex);
+    if (queue.Jobs.empty())
+      continue;
+
+    OutJob = queue.Jobs.front();
+    queue.Jobs.pop_front();
+    m_QueuedJobs.fetch_sub(1);
+    return true;
+  }
+  return false;
+}
+
+void CJobSystem::Execute(const FJob& Job)
+{
+  CE_PROFILE_SCOPE("Job");
+  Job.Function(Job.Context, Job.Begin, Job.End);
+  if (Job.Counter)
+  {
+    Job.Counter->Pending.fetch_sub(1, std::memory_order_acq_rel);
+  }
+}
+
+uint32_t CJobSystem::GetCurrentQueueIndex() const
+{
+  return t_QueueIndex;
+}
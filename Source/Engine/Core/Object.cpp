@@ -1,5 +1,7 @@
 #include "Engine/Core/Object.h"
 
+#include <algorithm>
+
 #include "Engine/GamePlay/Components/Base/Component.h"
 
 CObject::CObject(CObject* Owner, FString NewName)
@@ -11,6 +13,12 @@ CObject::~CObject()
 {
 }
 
+const ClassInfo& CObject::StaticClass()
+{
+  static const ClassInfo* s_ClassInfo = RegisterStaticClass("CObject", nullptr);
+  return *s_ClassInfo;
+}
+
 CObject* CObject::GetOwner() const
 {
   return m_Owner;
@@ -27,7 +35,7 @@ void CObject::BeginPlay()
 
 void CObject::Update(float DeltaTime)
 {
-  for (auto& [name, component] : m_Components)
+  for (CComponent* component : GetComponents<CComponent>())
   {
     component->Update(DeltaTime);
   }
@@ -37,3 +45,39 @@ void CObject::Tick(float DeltaTime)
 {
   Update(DeltaTime);
 }
+
+void CObject::ForEachComponent(std::function<void(CComponent*)> callback) const
+{
+  for (CComponent* component : GetComponents<CComponent>())
+  {
+    callback(component);
+  }
+}
+
+const ClassInfo* CObject::GetComponentClass(const CComponent* Component)
+{
+  return Component->GetClassInfo();
+}
+
+void CObject::AddComponentToTypeLists(CComponent* Component)
+{
+  for (const ClassInfo* info = Component->GetClassInfo(); info; info = info->GetParent())
+  {
+    const uint32_t typeId = info->GetTypeId();
+    if (typeId >= m_ComponentsByType.size())
+    {
+      m_ComponentsByType.resize(typeId + 1);
+    }
+    m_ComponentsByType[typeId].push_back(Component);
+  }
+}
+
+void CObject::RemoveComponentFromTypeLists(CComponent* Component)
+{
+  // Удаление со сдвигом: списки сохраняют порядок добавления
+  for (const ClassInfo* info = Component->GetClassInfo(); info; info = info->GetParent())
+  {
+    std::vector<CComponent*>& components = m_ComponentsByType[info->GetTypeId()];
+    components.erase(std::find(components.begin(), components.end(), Component));
+  }
+}
@@ -0,0 +1,325 @@
+#include "Engine/Core/Profiling/Profiler.h"
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+
+#include "CoreMinimal.h"
+
+namespace
+{
+  thread_local std::string t_ThreadName;
+  // Индекс буфера потока в m_Buffers, пока буфер не создан - UINT32_MAX
+  thread_local uint32_t t_BufferIndex = UINT32_MAX;
+
+  const std::chrono::steady_clock::time_point& GetEpoch()
+  {
+    static const std::chrono::steady_clock::time_point epoch = std::chrono::steady_clock::now();
+    return epoch;
+  }
+
+  double NsToMs(uint64_t Ns)
+  {
+    return static_cast<double>(Ns) / 1000000.0;
+  }
+
+  // Имена маркеров - литералы, но на всякий случай экранируем кавычки и слеши
+  void WriteJsonString(std::ofstream& Out, const char* Text)
+  {
+    Out << '"';
+    for (const char* c = Text; *c; ++c)
+    {
+      if (*c == '"' || *c == '\\')
+      {
+        Out << '\\';
+      }
+      Out << *c;
+    }
+    Out << '"';
+  }
+}  // namespace
+
+std::atomic<bool> CProfiler::s_Enabled{false};
+
+CProfiler& CProfiler::Get()
+{
+  static CProfiler profiler;
+  return profiler;
+}
+
+CProfiler::CProfiler()
+{
+  GetEpoch();
+}
+
+CProfiler::~CProfiler()
+{
+  s_Enabled = false;
+}
+
+void CProfiler::SetEnabled(bool bEnabled)
+{
+  if (bEnabled && !s_Enabled)
+  {
+    // Первый кадр окна отсчитывается от включения, а не от запуска
+    m_LastFrameNs = Now();
+  }
+  s_Enabled = bEnabled;
+}
+
+uint64_t CProfiler::Now()
+{
+  return static_cast<uint64_t>(
+      std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - GetEpoch()).count());
+}
+
+void CProfiler::SetThreadName(const std::string& Name)
+{
+  t_ThreadName = Name;
+  if (t_BufferIndex == UINT32_MAX)
+    return;
+
+  // Буфер уже создан первым маркером: имя читает экспорт, поэтому меняем под мьютексом
+  CProfiler& profiler = Get();
+  std::lock_guard<std::mutex> lock(profiler.m_Mutex);
+  profiler.m_Buffers[t_BufferIndex]->Name = Name;
+}
+
+CProfiler::FThreadBuffer& CProfiler::GetThreadBuffer()
+{
+  // Буфер принадлежит профилировщику и переживает поток: его события еще заберет EndFrame
+  thread_local FThreadBuffer* t_Buffer = nullptr;
+  if (!t_Buffer)
+  {
+    auto buffer = std::make_unique<FThreadBuffer>();
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    buffer->ThreadId = static_cast<uint32_t>(m_Buffers.size());
+    buffer->Name = t_ThreadName.empty() ? "Thread " + std::to_string(buffer->ThreadId) : t_ThreadName;
+    t_Buffer = buffer.get();
+    t_BufferIndex = buffer->ThreadId;
+    m_Buffers.push_back(std::move(buffer));
+  }
+  return *t_Buffer;
+}
+
+void CProfiler::Record(const char* Name, uint64_t StartNs, uint64_t EndNs, uint32_t Depth)
+{
+  Push(GetThreadBuffer(), Name, StartNs, EndNs, Depth);
+}
+
+uint32_t CProfiler::CreateTrack(const std::string& Name)
+{
+  auto buffer = std::make_unique<FThreadBuffer>();
+  std::lock_guard<std::mutex> lock(m_Mutex);
+  buffer->ThreadId = static_cast<uint32_t>(m_Buffers.size());
+  buffer->Name = Name;
+  m_Buffers.push_back(std::move(buffer));
+  return m_Buffers.back()->ThreadId;
+}
+
+void CProfiler::RecordOnTrack(uint32_t Track, const char* Name, uint64_t StartNs, uint64_t EndNs, uint32_t Depth)
+{
+  // Под мьютексом только поиск: вектор буферов может расти из других потоков
+  FThreadBuffer* buffer = nullptr;
+  {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    if (Track >= m_Buffers.size())
+      return;
+    buffer = m_Buffers[Track].get();
+  }
+  Push(*buffer, Name, StartNs, EndNs, Depth);
+}
+
+void CProfiler::Push(FThreadBuffer& Buffer, const char* Name, uint64_t StartNs, uint64_t EndNs, uint32_t Depth)
+{
+  const uint64_t write = Buffer.Write.load(std::memory_order_relaxed);
+  if (write - Buffer.Read.load(std::memory_order_acquire) >= FThreadBuffer::CAPACITY)
+  {
+    // Кадр не закрывали слишком долго: событие теряется, счетчик попадет в лог
+    Buffer.Dropped.fetch_add(1, std::memory_order_relaxed);
+    return;
+  }
+
+  FProfileEvent& event = Buffer.Events[write % FThreadBuffer::CAPACITY];
+  event.Name = Name;
+  event.StartNs = StartNs;
+  event.EndNs = EndNs;
+  event.ThreadId = Buffer.ThreadId;
+  event.Depth = Depth;
+  Buffer.Write.store(write + 1, std::memory_order_release);
+}
+
+void CProfiler::EndFrame()
+{
+  if (!IsEnabled())
+    return;
+
+  const uint64_t frameEnd = Now();
+  uint64_t dropped = 0;
+  {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    for (const auto& buffer : m_Buffers)
+    {
+      const uint64_t read = buffer->Read.load(std::memory_order_relaxed);
+      const uint64_t write = buffer->Write.load(std::memory_order_acquire);
+      for (uint64_t i = read; i < write; ++i)
+      {
+        const FProfileEvent& event = buffer->Events[i % FThreadBuffer::CAPACITY];
+        FScopeAccumulator& scope = m_Scopes[event.Name];
+        scope.Depth = std::min(scope.Depth, event.Depth);
+        scope.FrameMs += NsToMs(event.EndNs - event.StartNs);
+        ++scope.FrameCalls;
+
+        if (m_Capturing)
+        {
+          if (m_Captured.size() < m_MaxCapturedEvents)
+          {
+            m_Captured.push_back(event);
+          }
+          else
+          {
+            ++m_LostCapturedEvents;
+          }
+        }
+      }
+      buffer->Read.store(write, std::memory_order_release);
+      dropped += buffer->Dropped.exchange(0, std::memory_order_relaxed);
+    }
+  }
+
+  if (dropped > 0)
+  {
+    CORE_WARN("Profiler: ", dropped, " events dropped, thread buffers overflowed within a frame");
+  }
+
+  for (auto& [name, scope] : m_Scopes)
+  {
+    scope.TotalMs += scope.FrameMs;
+    scope.MaxMs = std::max(scope.MaxMs, scope.FrameMs);
+    scope.TotalCalls += scope.FrameCalls;
+    scope.FrameMs = 0.0;
+    scope.FrameCalls = 0;
+  }
+
+  const double frameMs = m_LastFrameNs > 0 ? NsToMs(frameEnd - m_LastFrameNs) : 0.0;
+  m_LastFrameNs = frameEnd;
+  m_WindowFrameMs += frameMs;
+  m_WindowMaxFrameMs = std::max(m_WindowMaxFrameMs, frameMs);
+
+  if (++m_WindowFrames >= m_SummaryWindow)
+  {
+    PublishSummary();
+  }
+}
+
+void CProfiler::PublishSummary()
+{
+  FProfileSummary summary;
+  summary.Frames = m_WindowFrames;
+  summary.AverageFrameMs = m_WindowFrameMs / m_WindowFrames;
+  summary.MaxFrameMs = m_WindowMaxFrameMs;
+  for (const auto& [name, scope] : m_Scopes)
+  {
+    if (scope.TotalCalls == 0)
+      continue;
+
+    FProfileStat stat;
+    stat.Name = name;
+    stat.Depth = scope.Depth;
+    stat.AverageMs = scope.TotalMs / m_WindowFrames;
+    stat.MaxMs = scope.MaxMs;
+    stat.CallsPerFrame = static_cast<double>(scope.TotalCalls) / m_WindowFrames;
+    summary.Stats.push_back(stat);
+  }
+  std::sort(summary.Stats.begin(), summary.Stats.end(),
+            [](const FProfileStat& A, const FProfileStat& B) { return A.AverageMs > B.AverageMs; });
+
+  if (m_LogSummary)
+  {
+    CORE_DISPLAY("Profile (", summary.Frames, " frames): frame avg ", summary.AverageFrameMs, " ms, max ",
+                 summary.MaxFrameMs, " ms");
+    for (const FProfileStat& stat : summary.Stats)
+    {
+      CORE_DISPLAY("  ", std::string(stat.Depth * 2, ' '), stat.Name, ": avg ", stat.AverageMs, " ms, max ", stat.MaxMs,
+                   " ms, calls ", stat.CallsPerFrame);
+    }
+  }
+
+  m_LastSummary = std::move(summary);
+  m_Scopes.clear();
+  m_WindowFrames = 0;
+  m_WindowFrameMs = 0.0;
+  m_WindowMaxFrameMs = 0.0;
+}
+
+void CProfiler::SetSummaryWindow(uint32_t Frames)
+{
+  m_SummaryWindow = std::max(1u, Frames);
+}
+
+void CProfiler::SetLogSummary(bool bEnabled)
+{
+  m_LogSummary = bEnabled;
+}
+
+FProfileSummary CProfiler::GetLastSummary() const
+{
+  return m_LastSummary;
+}
+
+void CProfiler::BeginCapture(size_t MaxEvents)
+{
+  std::lock_guard<std::mutex> lock(m_Mutex);
+  m_Captured.clear();
+  m_MaxCapturedEvents = MaxEvents;
+  m_LostCapturedEvents = 0;
+  m_Capturing = true;
+}
+
+void CProfiler::EndCapture()
+{
+  std::lock_guard<std::mutex> lock(m_Mutex);
+  m_Capturing = false;
+  if (m_LostCapturedEvents > 0)
+  {
+    CORE_WARN("Profiler capture is full, lost events: ", m_LostCapturedEvents);
+  }
+}
+
+bool CProfiler::WriteChromeTrace(const std::string& Path) const
+{
+  std::ofstream out(Path, std::ios::out | std::ios::trunc);
+  if (!out.is_open())
+  {
+    CORE_ERROR("Failed to open profile trace: ", Path);
+    return false;
+  }
+
+  std::lock_guard<std::mutex> lock(m_Mutex);
+  // Формат Trace Event: "X" - интервал с длительностью, "M" - имя потока; время в микросекундах
+  out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+  bool first = true;
+  for (const auto& buffer : m_Buffers)
+  {
+    out << (first ? "" : ",\n") << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << buffer->ThreadId
+        << ",\"args\":{\"name\":";
+    WriteJsonString(out, buffer->Name.c_str());
+    out << "}}";
+    first = false;
+  }
+
+  out.setf(std::ios::fixed);
+  out.precision(3);
+  for (const FProfileEvent& event : m_Captured)
+  {
+    out << (first ? "" : ",\n") << "{\"name\":";
+    WriteJsonString(out, event.Name);
+    out << ",\"ph\":\"X\",\"pid\":1,\"tid\":" << event.ThreadId << ",\"ts\":" << event.StartNs / 1000.0
+        << ",\"dur\":" << (event.EndNs - event.StartNs) / 1000.0 << "}";
+    first = false;
+  }
+  out << "\n]}\n";
+
+  CORE_DISPLAY("Profile trace written: ", Path, " (", m_Captured.size(), " events)");
+  return out.good();
+}
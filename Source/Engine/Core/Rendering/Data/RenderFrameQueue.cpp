@@ -0,0 +1,95 @@
+#include "Engine/Core/Rendering/Data/RenderFrameQueue.h"
+
+#include <algorithm>
+
+#include "CoreMinimal.h"
+
+CRenderFrameQueue::CRenderFrameQueue(uint32_t SlotCount)
+{
+  SlotCount = std::clamp(SlotCount, MIN_SLOTS, MAX_SLOTS);
+  for (uint32_t i = 0; i < SlotCount; ++i)
+  {
+    m_Slots.push_back(std::make_unique<FrameRenderData>());
+    m_Free.push_back(i);
+  }
+}
+
+FrameRenderData* CRenderFrameQueue::BeginWrite()
+{
+  uint32_t slot = NO_SLOT;
+  {
+    std::unique_lock<std::mutex> lock(m_Mutex);
+    if (m_Free.empty() && !m_Closed)
+    {
+      // Здесь игровой поток стоит, когда кадр ограничен рендером или GPU
+      CE_PROFILE_SCOPE("CRenderFrameQueue::WaitForFreeSlot");
+      m_SlotFreed.wait(lock, [this] { return !m_Free.empty() || m_Closed; });
+    }
+    if (m_Closed)
+      return nullptr;
+
+    slot = m_Free.front();
+    m_Free.pop_front();
+    m_Writing = slot;
+  }
+
+  // Очистка вне блокировки: емкость массивов снимка сохраняется между кадрами
+  FrameRenderData* data = m_Slots[slot].get();
+  data->Clear();
+  return data;
+}
+
+void CRenderFrameQueue::EndWrite()
+{
+  {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    if (m_Writing == NO_SLOT)
+      return;
+
+    m_Ready.push_back(m_Writing);
+    m_Writing = NO_SLOT;
+  }
+  m_FramePublished.notify_one();
+}
+
+const FrameRenderData* CRenderFrameQueue::BeginRead()
+{
+  std::unique_lock<std::mutex> lock(m_Mutex);
+  m_FramePublished.wait(lock, [this] { return !m_Ready.empty() || m_Closed; });
+  if (m_Ready.empty())
+    return nullptr;
+
+  m_Reading = m_Ready.front();
+  m_Ready.pop_front();
+  return m_Slots[m_Reading].get();
+}
+
+void CRenderFrameQueue::EndRead()
+{
+  {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    if (m_Reading == NO_SLOT)
+      return;
+
+    m_Free.push_back(m_Reading);
+    m_Reading = NO_SLOT;
+  }
+  // Свободный снимок ждет игровой поток, а WaitIdle - пустую очередь
+  m_SlotFreed.notify_all();
+}
+
+void CRenderFrameQueue::WaitIdle()
+{
+  std::unique_lock<std::mutex> lock(m_Mutex);
+  m_SlotFreed.wait(lock, [this] { return (m_Ready.empty() && m_Reading == NO_SLOT) || m_Closed; });
+}
+
+void CRenderFrameQueue::Close()
+{
+  {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    m_Closed = true;
+  }
+  m_SlotFreed.notify_all();
+  m_FramePublished.notify_all();
+}
@@ -1,5 +1,8 @@
 #include "Engine/Core/Rendering/Data/Vertex.h"
 
+#include <algorithm>
+#include <cmath>
+
 
   VkVertexInputBindingDescription Vertex::GetBindingDescription()
   {
@@ -34,4 +37,61 @@
     attributeDescriptions[3].offset = offsetof(Vertex, texCoord);
 
     return attributeDescriptions;
-  }
\ No newline at end of file
+  }
+
+  VkVertexInputBindingDescription FInstanceData::GetBindingDescription()
+  {
+    VkVertexInputBindingDescription bindingDescription{};
+    bindingDescription.binding = 1;
+    bindingDescription.stride = sizeof(FInstanceData);
+    bindingDescription.inputRate = VK_VERTEX_INPUT_RATE_INSTANCE;
+    return bindingDescription;
+  }
+
+  std::array<VkVertexInputAttributeDescription, 5> FInstanceData::GetAttributeDescriptions()
+  {
+    std::array<VkVertexInputAttributeDescription, 5> attributeDescriptions{};
+
+    for (uint32_t column = 0; column < 4; ++column)
+    {
+      attributeDescriptions[column].binding = 1;
+      attributeDescriptions[column].location = 4 + column;
+      attributeDescriptions[column].format = VK_FORMAT_R32G32B32A32_SFLOAT;
+      attributeDescriptions[column].offset = offsetof(FInstanceData, model) + column * sizeof(float) * 4;
+    }
+
+    attributeDescriptions[4].binding = 1;
+    attributeDescriptions[4].location = 8;
+    attributeDescriptions[4].format = VK_FORMAT_R32G32B32A32_SFLOAT;
+    attributeDescriptions[4].offset = offsetof(FInstanceData, color);
+
+    return attributeDescriptions;
+  }
+
+  void FStaticMesh::ComputeBounds()
+  {
+    bounds = FBox();
+    for (const Vertex& vertex : vertices)
+    {
+      bounds.Expand(vertex.position);
+    }
+    ComputeBoundingSphere();
+  }
+
+  void FStaticMesh::ComputeBoundingSphere()
+  {
+    if (!bounds.IsValid())
+    {
+      boundingSphere = FSphere();
+      return;
+    }
+
+    // Центр бокса не дает минимальную сферу, но радиус по вершинам заметно туже полудиагонали
+    const FVector center = bounds.GetCenter();
+    float maxDistanceSquared = 0.0f;
+    for (const Vertex& vertex : vertices)
+    {
+      maxDistanceSquared = std::max(maxDistanceSquared, (vertex.position - center).LengthSquared());
+    }
+    boundingSphere = FSphere(center, std::sqrt(maxDistanceSquared));
+  }
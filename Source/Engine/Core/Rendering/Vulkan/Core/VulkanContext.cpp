@@ -1,5 +1,7 @@
 #include "Engine/Core/Rendering/Vulkan/Core/VulkanContext.h"
 
+#include <algorithm>
+
 #include <SDL3/SDL.h>
 #include <SDL3/SDL_vulkan.h>
 
@@ -38,14 +40,18 @@ void VulkanContext::Initialize()
   }
 
   m_deviceManager = std::make_shared<DeviceManager>();
-  if (!m_deviceManager->Initialize(m_instance, m_surface))
+  if (!m_deviceManager->Initialize(m_instance, m_surface, m_apiVersion))
   {
     CORE_ERROR("Failed to initialize DeviceManager");
     Shutdown();
     return;
   }
 
-  m_swapchainManager = std::make_shared<SwapchainManager>(m_instance, m_surface, m_deviceManager, m_window);
+  m_swapchainManager = std::make_shared<SwapchainManager>(m_instance, m_surface, m_deviceManager);
+  // Дальше размер приходит событиями; SDL опрашивается только здесь, на главном потоке
+  int windowWidth = 0, windowHeight = 0;
+  SDL_GetWindowSizeInPixels(m_window, &windowWidth, &windowHeight);
+  m_swapchainManager->SetWindowExtent(static_cast<uint32_t>(windowWidth), static_cast<uint32_t>(windowHeight));
   if (!m_swapchainManager->Initialize())
   {
     CORE_ERROR("Failed to initialize SwapchainManager");
@@ -69,34 +75,40 @@ void VulkanContext::Initialize()
     return;
   }
 
-  // Создаем UBO буферы и проверяем их создание
-  if (!m_bufferManager->CreateUniformBuffer(m_sceneUBOBufferName, sizeof(SceneUBO)))
+  // Scene и lighting UBO пишутся каждый кадр, поэтому у каждого кадра в полете свой регион
+  m_uniformRing = std::make_shared<UniformRingBuffer>(m_deviceManager, m_bufferManager);
+  if (!m_uniformRing->Initialize(m_uniformRingBufferName, UNIFORM_RING_FRAME_SIZE, MAX_FRAMES_IN_FLIGHT))
   {
-    CORE_ERROR("Failed to create scene UBO buffer");
+    CORE_ERROR("Failed to create uniform ring buffer");
     Shutdown();
     return;
   }
 
-  if (!m_bufferManager->CreateUniformBuffer(m_lightingUBOBufferName, sizeof(LightingUBO)))
+  m_uploadManager = std::make_shared<UploadManager>(m_deviceManager, m_bufferManager);
+  if (!m_uploadManager->Initialize(UPLOAD_STAGING_SIZE, MAX_FRAMES_IN_FLIGHT))
   {
-    CORE_ERROR("Failed to create lighting UBO buffer");
+    CORE_ERROR("Failed to initialize UploadManager");
     Shutdown();
     return;
   }
 
-  // Проверяем что буферы созданы
-  if (m_bufferManager->GetBuffer(m_sceneUBOBufferName) == VK_NULL_HANDLE ||
-      m_bufferManager->GetBuffer(m_lightingUBOBufferName) == VK_NULL_HANDLE)
+  m_descriptorManager = std::make_shared<DescriptorManager>(m_deviceManager, m_bufferManager);
+  if (!m_descriptorManager->Initialize())
   {
-    CORE_ERROR("UBO buffers are null after creation");
+    CORE_ERROR("Failed to initialize DescriptorManager");
     Shutdown();
     return;
   }
 
-  m_descriptorManager = std::make_shared<DescriptorManager>(m_deviceManager, m_bufferManager);
-  if (!m_descriptorManager->Initialize())
+  // Scene и lighting UBO общие для всех объектов кадра, поэтому descriptor set один
+  m_sceneDescriptorSet = m_descriptorManager->CreateMeshDescriptorSet(m_pipelineManager->GetDescriptorSetLayout(), "scene");
+  if (!m_sceneDescriptorSet ||
+      !m_descriptorManager->UpdateMeshDescriptorSet(m_sceneDescriptorSet,
+                                                    m_uniformRing->GetHandle(),
+                                                    sizeof(SceneUBO),
+                                                    sizeof(LightingUBO)))
   {
-    CORE_ERROR("Failed to initialize DescriptorManager");
+    CORE_ERROR("Failed to create scene descriptor set");
     Shutdown();
     return;
   }
@@ -118,6 +130,13 @@ void VulkanContext::Initialize()
     return;
   }
 
+  // Без timestamp запросов рендер работает как обычно, только без дорожки GPU
+  m_gpuProfiler = std::make_shared<GpuProfiler>(m_deviceManager, m_commandBufferManager);
+  if (!m_gpuProfiler->Initialize(MAX_FRAMES_IN_FLIGHT))
+  {
+    m_gpuProfiler.reset();
+  }
+
   // Create default mesh pipeline
   if (!m_pipelineManager->CreateMeshPipeline("mesh", m_swapchainManager->GetRenderPass()))
   {
@@ -126,6 +145,8 @@ void VulkanContext::Initialize()
     return;
   }
 
+  InitializeBindless();
+
   CreateSyncObjects();
 
   CORE_DEBUG("VulkanContext initialized successfully");
@@ -140,11 +161,39 @@ void VulkanContext::Shutdown()
 
   CleanupSyncObjects();
 
-  for (auto& [name, buffers] : m_meshBufferMap)
+  while (!m_meshHandles.empty())
+  {
+    UnregisterMesh(m_meshHandles.begin()->first);
+  }
+  for (BufferHandle instanceBuffer : m_instanceBuffers)
+  {
+    m_bufferManager->DestroyBuffer(instanceBuffer);
+  }
+  m_instanceBuffers.clear();
+  if (m_descriptorManager)
   {
-    UnregisterMesh(name);
+    for (uint32_t slot : m_instanceBindlessSlots)
+    {
+      m_descriptorManager->ReleaseBindlessSlot(slot);
+    }
+  }
+  m_instanceBindlessSlots.clear();
+  m_useBindless = false;
+  m_instanceBatches.clear();
+  m_pendingMeshReleases.clear();
+  m_sceneDescriptorSet = {};
+
+  if (m_uploadManager)
+  {
+    m_uploadManager->Shutdown();
+    m_uploadManager.reset();
+  }
+
+  if (m_uniformRing)
+  {
+    m_uniformRing->Shutdown();
+    m_uniformRing.reset();
   }
-  m_meshBufferMap.clear();
 
   if (m_descriptorManager)
   {
@@ -152,6 +201,12 @@ void VulkanContext::Shutdown()
     m_descriptorManager.reset();
   }
 
+  if (m_gpuProfiler)
+  {
+    m_gpuProfiler->Shutdown();
+    m_gpuProfiler.reset();
+  }
+
   if (m_commandBufferManager)
   {
     m_commandBufferManager->Shutdown();
@@ -222,6 +277,7 @@ void VulkanContext::Shutdown()
 
 void VulkanContext::DrawFrame(const FrameRenderData& renderData)
 {
+  CE_PROFILE_SCOPE("VulkanContext::DrawFrame");
   VkDevice device = m_deviceManager->GetDevice();
 
   vkWaitForFences(device, 1, &m_inFlightFences[m_currentFrame], VK_TRUE, UINT64_MAX);
@@ -230,13 +286,14 @@ void VulkanContext::DrawFrame(const FrameRenderData& renderData)
   VkResult result = vkAcquireNextImageKHR(device, m_swapchainManager->GetSwapchain(), UINT64_MAX,
                                           m_imageAvailableSemaphores[m_currentFrame], VK_NULL_HANDLE, &imageIndex);
 
-  if (result == VK_ERROR_OUT_OF_DATE_KHR || result == VK_SUBOPTIMAL_KHR || m_frameBufferResized)
+  // Изображение уже получено и его семафор будет просигнален: при SUBOPTIMAL или смене размера
+  // кадр дорисовывается, а swapchain пересоздается после present
+  if (result == VK_ERROR_OUT_OF_DATE_KHR)
   {
-    m_frameBufferResized = false;
     m_swapchainManager->RecreateSwapchain();
     return;
   }
-  else if (result != VK_SUCCESS)
+  else if (result != VK_SUCCESS && result != VK_SUBOPTIMAL_KHR)
   {
     RENDER_ERROR("Failed to acquire swap chain image");
     return;
@@ -250,9 +307,26 @@ void VulkanContext::DrawFrame(const FrameRenderData& renderData)
 
   vkResetFences(device, 1, &m_inFlightFences[m_currentFrame]);
 
+  // Timestamp запросы прошлого использования кадра уже записаны: переносим их на дорожку GPU
+  if (m_gpuProfiler)
+  {
+    m_gpuProfiler->BeginFrame(m_currentFrame);
+  }
+
+  // Меши, чьи загрузки завершились, становятся доступны для отрисовки в этом кадре
+  m_uploadManager->Update();
+
+  ReleaseUnusedMeshes();
+
   UpdateUniformBuffers(renderData);
 
-  RecordCommandBuffer(imageIndex, renderData);
+  PrepareInstances(renderData);
+
+  // Загрузки новых мешей этого кадра уходят одной партией, рендер их не ждет
+  m_uploadManager->Submit();
+  DropFailedUploads();
+
+  RecordCommandBuffer(imageIndex);
 
   VkSubmitInfo submitInfo{};
   submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
@@ -269,6 +343,10 @@ void VulkanContext::DrawFrame(const FrameRenderData& renderData)
   submitInfo.signalSemaphoreCount = 1;
   submitInfo.pSignalSemaphores = signalSemaphores;
 
+  if (m_gpuProfiler)
+  {
+    m_gpuProfiler->MarkSubmit();
+  }
   result = vkQueueSubmit(m_deviceManager->GetGraphicsQueue(), 1, &submitInfo, m_inFlightFences[m_currentFrame]);
   VK_CHECK(result, "Failed to submit draw command buffer");
 
@@ -285,9 +363,8 @@ void VulkanContext::DrawFrame(const FrameRenderData& renderData)
 
   result = vkQueuePresentKHR(m_deviceManager->GetPresentQueue(), &presentInfo);
 
-  if (result == VK_ERROR_OUT_OF_DATE_KHR || result == VK_SUBOPTIMAL_KHR || m_frameBufferResized)
+  if (m_frameBufferResized.exchange(false) || result == VK_ERROR_OUT_OF_DATE_KHR || result == VK_SUBOPTIMAL_KHR)
   {
-    m_frameBufferResized = false;
     m_swapchainManager->RecreateSwapchain();
   }
   else if (result != VK_SUCCESS)
@@ -296,76 +373,289 @@ void VulkanContext::DrawFrame(const FrameRenderData& renderData)
   }
 
   m_currentFrame = (m_currentFrame + 1) % MAX_FRAMES_IN_FLIGHT;
+  ++m_frameNumber;
 }
 
-void VulkanContext::RegisterMesh(const std::string& name, const FStaticMesh& mesh)
+MeshHandle VulkanContext::RegisterMesh(FMeshAssetId meshId, const FStaticMesh& mesh)
 {
-  std::string vertexBufferName = name + "_vertices";
-  if (!m_bufferManager->CreateVertexBuffer(vertexBufferName, mesh.vertices))
+  const std::string name = "mesh_" + std::to_string(meshId);
+  const VkDeviceSize vertexBytes = sizeof(Vertex) * mesh.vertices.size();
+  const VkDeviceSize indexBytes = sizeof(uint32_t) * mesh.indices.size();
+
+  // Имена буферов - только метки для логов, рендер обращается к ним по хэндлам
+  BufferHandle vertexBuffer = mesh.vertices.empty()
+                                  ? BufferHandle{}
+                                  : m_bufferManager->CreateDeviceBuffer(name + "_vertices", vertexBytes,
+                                                                        VK_BUFFER_USAGE_VERTEX_BUFFER_BIT, BufferType::VERTEX);
+  if (!vertexBuffer)
   {
     RENDER_ERROR("Failed to create vertex buffer for mesh: ", name);
-    return;
+    return {};
   }
 
-  std::string indexBufferName = name + "_indices";
-  if (!m_bufferManager->CreateIndexBuffer(indexBufferName, mesh.indices))
+  BufferHandle indexBuffer = mesh.indices.empty()
+                                 ? BufferHandle{}
+                                 : m_bufferManager->CreateDeviceBuffer(name + "_indices", indexBytes,
+                                                                       VK_BUFFER_USAGE_INDEX_BUFFER_BIT, BufferType::INDEX);
+  if (!indexBuffer)
   {
     RENDER_ERROR("Failed to create index buffer for mesh: ", name);
-    m_bufferManager->DestroyBuffer(vertexBufferName);
+    m_bufferManager->DestroyBuffer(vertexBuffer);
+    return {};
+  }
+
+  // Обе копии попадают в одну партию, поэтому тикет у них общий
+  const uint64_t vertexTicket = m_uploadManager->UploadBuffer(m_bufferManager->GetBuffer(vertexBuffer),
+                                                              mesh.vertices.data(), vertexBytes);
+  const uint64_t indexTicket = m_uploadManager->UploadBuffer(m_bufferManager->GetBuffer(indexBuffer),
+                                                             mesh.indices.data(), indexBytes);
+  if (vertexTicket == 0 || indexTicket == 0)
+  {
+    RENDER_ERROR("Failed to schedule upload for mesh: ", name);
+    // Копия могла уже попасть в партию, буферы нельзя удалять до ее завершения
+    m_uploadManager->WaitIdle();
+    m_bufferManager->DestroyBuffer(vertexBuffer);
+    m_bufferManager->DestroyBuffer(indexBuffer);
+    return {};
+  }
+
+  MeshBuffers buffers;
+  buffers.vertexBuffer = vertexBuffer;
+  buffers.indexBuffer = indexBuffer;
+  buffers.indexCount = static_cast<uint32_t>(mesh.indices.size());
+  buffers.uploadTicket = std::max(vertexTicket, indexTicket);
+
+  MeshHandle handle = m_meshes.Create(std::move(buffers));
+  m_meshHandles[meshId] = handle;
+  return handle;
+}
+
+void VulkanContext::UnregisterMesh(FMeshAssetId meshId)
+{
+  auto it = m_meshHandles.find(meshId);
+  if (it != m_meshHandles.end())
+  {
+    if (const MeshBuffers* buffers = m_meshes.Get(it->second))
+    {
+      m_bufferManager->DestroyBuffer(buffers->vertexBuffer);
+      m_bufferManager->DestroyBuffer(buffers->indexBuffer);
+    }
+    m_meshes.Destroy(it->second);
+    m_meshHandles.erase(it);
+  }
+
+  RENDER_DEBUG("Unregistered mesh: ", std::to_string(meshId));
+}
+
+void VulkanContext::PrepareInstances(const FrameRenderData& renderData)
+{
+  const auto& objects = renderData.renderObjects;
+  m_instanceBatches.clear();
+  m_drawOrder.clear();
+
+  for (uint32_t i = 0; i < objects.size(); ++i)
+  {
+    const RenderObject& renderObject = objects[i];
+    if (renderObject.mesh && renderObject.meshId != INVALID_MESH_ASSET_ID)
+    {
+      m_drawOrder.push_back(i);
+    }
+  }
+
+  // stable_sort сохраняет порядок объектов внутри меша, кадр от кадра не "мигает"
+  std::stable_sort(m_drawOrder.begin(), m_drawOrder.end(),
+                   [&objects](uint32_t a, uint32_t b)
+                   {
+                     return objects[a].meshId < objects[b].meshId;
+                   });
+
+  // Хэндл меша ищется один раз на группу; объекты неготовых мешей выбрасываются из m_drawOrder
+  uint32_t drawCount = 0;
+  for (size_t groupStart = 0; groupStart < m_drawOrder.size();)
+  {
+    const RenderObject& first = objects[m_drawOrder[groupStart]];
+    size_t groupEnd = groupStart + 1;
+    while (groupEnd < m_drawOrder.size() && objects[m_drawOrder[groupEnd]].meshId == first.meshId)
+    {
+      ++groupEnd;
+    }
+
+    MeshHandle mesh;
+    auto handleIt = m_meshHandles.find(first.meshId);
+    if (handleIt != m_meshHandles.end())
+    {
+      mesh = handleIt->second;
+    }
+    else
+    {
+      // Геометрия загружается один раз на ассет, а не на компонент; появится в одном из следующих кадров.
+      // Снимок кадра может пережить ассет, пока рендер поток отстает, поэтому данные читаются только у живого
+      if (FMeshAssetRef asset = CMeshAssetRegistry::Get().Find(first.meshId))
+      {
+        RegisterMesh(first.meshId, asset->Mesh);
+      }
+    }
+
+    const MeshBuffers* buffers = m_meshes.Get(mesh);
+    if (buffers && m_uploadManager->IsComplete(buffers->uploadTicket))
+    {
+      InstanceBatch batch;
+      batch.mesh = mesh;
+      batch.indexCount = buffers->indexCount;
+      batch.firstInstance = drawCount;
+      batch.instanceCount = static_cast<uint32_t>(groupEnd - groupStart);
+      m_instanceBatches.push_back(batch);
+
+      for (size_t i = groupStart; i < groupEnd; ++i)
+      {
+        m_drawOrder[drawCount++] = m_drawOrder[i];
+      }
+    }
+
+    groupStart = groupEnd;
+  }
+  m_drawOrder.resize(drawCount);
+
+  m_drawStats.objectCount = drawCount;
+  m_drawStats.drawCallCount = static_cast<uint32_t>(m_instanceBatches.size());
+  if (m_drawOrder.empty())
+    return;
+
+  FInstanceData* instances = GetInstanceData(m_currentFrame, m_drawOrder.size());
+  if (!instances)
+  {
+    m_instanceBatches.clear();
+    m_drawStats.drawCallCount = 0;
     return;
   }
 
-  std::string modelUBOName = name + "_model_ubo";
-  if (!m_bufferManager->CreateUniformBuffer(modelUBOName, sizeof(ModelUBO)))
+  for (uint32_t instanceIndex = 0; instanceIndex < m_drawOrder.size(); ++instanceIndex)
+  {
+    instances[instanceIndex] = FrameRenderData::GetInstanceData(objects[m_drawOrder[instanceIndex]]);
+  }
+}
+
+FInstanceData* VulkanContext::GetInstanceData(uint32_t frame, size_t instanceCount)
+{
+  if (m_instanceBuffers.size() < MAX_FRAMES_IN_FLIGHT)
+  {
+    m_instanceBuffers.resize(MAX_FRAMES_IN_FLIGHT);
+  }
+
+  // Буфер кадра frame свободен: его прошлое использование закрыто фенсом, который DrawFrame уже дождался
+  BufferHandle& instanceBuffer = m_instanceBuffers[frame];
+  const VkDeviceSize requiredSize = static_cast<VkDeviceSize>(instanceCount) * sizeof(FInstanceData);
+  const VkDeviceSize currentSize = m_bufferManager->GetBufferSize(instanceBuffer);
+
+  if (currentSize < requiredSize)
+  {
+    m_bufferManager->DestroyBuffer(instanceBuffer);
+
+    // Растем с запасом, чтобы не пересоздавать буфер каждый кадр при плавном росте сцены
+    const VkDeviceSize newSize = std::max<VkDeviceSize>({requiredSize, currentSize * 2, 256 * sizeof(FInstanceData)});
+    instanceBuffer = m_bufferManager->CreateDynamicVertexBuffer("instance_data_" + std::to_string(frame), newSize,
+                                                                m_useBindless ? VK_BUFFER_USAGE_STORAGE_BUFFER_BIT : 0);
+    if (!instanceBuffer)
+    {
+      RENDER_ERROR("Failed to create instance buffer for frame ", frame);
+      return nullptr;
+    }
+
+    // Слот кадра не читается ни одним незавершенным кадром, update-after-bind разрешает запись при привязанном set
+    if (m_useBindless)
+    {
+      m_descriptorManager->WriteBindlessBuffer(m_instanceBindlessSlots[frame],
+                                               m_bufferManager->GetBuffer(instanceBuffer), newSize);
+    }
+  }
+
+  return static_cast<FInstanceData*>(m_bufferManager->GetMappedData(instanceBuffer));
+}
+
+void VulkanContext::InitializeBindless()
+{
+  if (!m_info->Bindless)
   {
-    RENDER_ERROR("Failed to create model UBO for mesh: ", name);
-    m_bufferManager->DestroyBuffer(vertexBufferName);
-    m_bufferManager->DestroyBuffer(indexBufferName);
+    RENDER_DEBUG("Bindless rendering disabled by config");
     return;
   }
 
-  VkDescriptorSetLayout pipelineLayout = m_pipelineManager->GetDescriptorSetLayout();
-  if (!m_descriptorManager->CreateMeshDescriptorSet(name, pipelineLayout))
+  if (!m_descriptorManager->InitializeBindless(BINDLESS_BUFFER_CAPACITY))
   {
-    RENDER_ERROR("Failed to create descriptor set for mesh: ", name);
-    m_bufferManager->DestroyBuffer(vertexBufferName);
-    m_bufferManager->DestroyBuffer(indexBufferName);
-    m_bufferManager->DestroyBuffer(modelUBOName);
+    RENDER_DEBUG("Descriptor indexing unavailable, using instance vertex buffers");
     return;
   }
 
-  if (!m_descriptorManager->UpdateMeshDescriptorSet(name,
-                                                    m_sceneUBOBufferName,
-                                                    modelUBOName,
-                                                    m_lightingUBOBufferName))
+  if (!m_pipelineManager->CreateBindlessMeshPipeline("mesh_bindless", m_swapchainManager->GetRenderPass(),
+                                                     m_descriptorManager->GetBindlessLayout()))
   {
-    RENDER_ERROR("Failed to update descriptor set for mesh: ", name);
-    m_bufferManager->DestroyBuffer(vertexBufferName);
-    m_bufferManager->DestroyBuffer(indexBufferName);
-    m_bufferManager->DestroyBuffer(modelUBOName);
+    RENDER_WARN("Failed to create bindless mesh pipeline, using instance vertex buffers");
     return;
   }
 
-  MeshBuffers buffers;
-  buffers.vertexBufferName = vertexBufferName;
-  buffers.indexBufferName = indexBufferName;
-  buffers.modelUBOName = modelUBOName;
-  m_meshBufferMap[name] = buffers;
+  m_instanceBindlessSlots.resize(MAX_FRAMES_IN_FLIGHT);
+  for (auto& slot : m_instanceBindlessSlots)
+  {
+    slot = m_descriptorManager->AllocateBindlessSlot();
+  }
+
+  m_useBindless = true;
+  RENDER_DEBUG("Bindless mesh rendering enabled");
 }
 
-void VulkanContext::UnregisterMesh(const std::string& name)
+void VulkanContext::ReleaseUnusedMeshes()
 {
-  auto it = m_meshBufferMap.find(name);
-  if (it != m_meshBufferMap.end())
+  std::vector<FMeshAssetId> released;
+  CMeshAssetRegistry::Get().CollectReleased(released);
+  for (FMeshAssetId meshId : released)
   {
-    const auto& buffers = it->second;
-    m_bufferManager->DestroyBuffer(buffers.vertexBufferName);
-    m_bufferManager->DestroyBuffer(buffers.indexBufferName);
-    m_bufferManager->DestroyBuffer(buffers.modelUBOName);
-    m_meshBufferMap.erase(name);
+    if (m_meshHandles.count(meshId))
+    {
+      m_pendingMeshReleases.emplace_back(meshId, m_frameNumber);
+    }
+  }
+
+  // Забор фенса текущего кадра гарантирует, что кадры старше MAX_FRAMES_IN_FLIGHT завершены
+  // Буферы с незавершенной загрузкой еще пишутся transfer очередью
+  auto ready = [this](const std::pair<FMeshAssetId, uint64_t>& pending)
+  {
+    auto handleIt = m_meshHandles.find(pending.first);
+    const MeshBuffers* buffers = handleIt != m_meshHandles.end() ? m_meshes.Get(handleIt->second) : nullptr;
+    const bool uploaded = !buffers || m_uploadManager->IsComplete(buffers->uploadTicket);
+    return uploaded && m_frameNumber >= pending.second + MAX_FRAMES_IN_FLIGHT;
+  };
+  for (const auto& pending : m_pendingMeshReleases)
+  {
+    if (ready(pending))
+    {
+      UnregisterMesh(pending.first);
+    }
   }
+  m_pendingMeshReleases.erase(std::remove_if(m_pendingMeshReleases.begin(), m_pendingMeshReleases.end(), ready),
+                              m_pendingMeshReleases.end());
+}
+
+void VulkanContext::DropFailedUploads()
+{
+  m_uploadManager->TakeFailedTickets(m_failedUploadTickets);
+  if (m_failedUploadTickets.empty())
+    return;
 
-  RENDER_DEBUG("Unregistered mesh: ", name);
+  // Копии этих партий не выполнялись, GPU буферы мешей не читал: снимаем их сразу,
+  // меш загрузится заново, когда снова попадет в кадр
+  std::vector<FMeshAssetId> failedMeshes;
+  for (const auto& [meshId, handle] : m_meshHandles)
+  {
+    const MeshBuffers* buffers = m_meshes.Get(handle);
+    if (buffers && std::binary_search(m_failedUploadTickets.begin(), m_failedUploadTickets.end(), buffers->uploadTicket))
+    {
+      failedMeshes.push_back(meshId);
+    }
+  }
+  for (FMeshAssetId meshId : failedMeshes)
+  {
+    UnregisterMesh(meshId);
+  }
 }
 
 void VulkanContext::CreateSyncObjects()
@@ -441,11 +731,30 @@ void VulkanContext::CleanupSyncObjects()
   RENDER_DEBUG("Synchronization objects destroyed");
 }
 
-void VulkanContext::RecordCommandBuffer(uint32_t imageIndex, const FrameRenderData& renderData)
+void VulkanContext::RecordCommandBuffer(uint32_t imageIndex)
 {
+  CE_PROFILE_SCOPE("VulkanContext::RecordCommandBuffer");
   m_commandBufferManager->BeginRecording(imageIndex);
   m_currentCommandBuffer = m_commandBufferManager->GetCommandBuffer(imageIndex);
 
+  GpuProfiler* gpuProfiler = m_gpuProfiler.get();
+  if (gpuProfiler)
+  {
+    gpuProfiler->ResetQueries(m_currentCommandBuffer);
+  }
+
+  {
+    CE_GPU_PROFILE_SCOPE(gpuProfiler, m_currentCommandBuffer, "GPU Frame");
+    RecordRenderPass(imageIndex);
+  }
+
+  m_commandBufferManager->EndRecording(imageIndex);
+}
+
+void VulkanContext::RecordRenderPass(uint32_t imageIndex)
+{
+  CE_GPU_PROFILE_SCOPE(m_gpuProfiler.get(), m_currentCommandBuffer, "GPU Render Pass");
+
   std::vector<VkClearValue> clearValues(2);
   clearValues[0].color = {{1.0f, 1.0f, 1.0f, 1.0f}};
   clearValues[1].depthStencil = {1.0f, 0};
@@ -456,10 +765,13 @@ void VulkanContext::RecordCommandBuffer(uint32_t imageIndex, const FrameRenderDa
                                           m_swapchainManager->GetExtent(),
                                           clearValues);
 
-  VkPipeline meshPipeline = m_pipelineManager->GetPipeline("mesh");
+  VkPipeline meshPipeline = m_pipelineManager->GetPipeline(m_useBindless ? "mesh_bindless" : "mesh");
   if (meshPipeline != VK_NULL_HANDLE)
   {
-    m_commandBufferManager->BindPipeline(imageIndex, meshPipeline);
+    {
+      CE_GPU_PROFILE_SCOPE(m_gpuProfiler.get(), m_currentCommandBuffer, "GPU Bind Pipeline");
+      m_commandBufferManager->BindPipeline(imageIndex, meshPipeline);
+    }
 
     VkViewport viewport{};
     viewport.x = 0.0f;
@@ -475,67 +787,75 @@ void VulkanContext::RecordCommandBuffer(uint32_t imageIndex, const FrameRenderDa
     scissor.extent = m_swapchainManager->GetExtent();
     m_commandBufferManager->SetScissor(imageIndex, scissor);
 
-    for (const auto& renderObject : renderData.renderObjects)
-    {
-      if (!renderObject.mesh)
-        continue;
+    VkDescriptorSet sceneDescriptorSet = m_descriptorManager->GetMeshDescriptorSet(m_sceneDescriptorSet);
+    VkBuffer instanceBuffer = m_instanceBuffers.size() > m_currentFrame
+                                  ? m_bufferManager->GetBuffer(m_instanceBuffers[m_currentFrame])
+                                  : VK_NULL_HANDLE;
 
-      std::string meshName = "mesh_" + std::to_string(reinterpret_cast<uintptr_t>(renderObject.mesh));
+    if (!m_instanceBatches.empty() && sceneDescriptorSet != VK_NULL_HANDLE && instanceBuffer != VK_NULL_HANDLE)
+    {
+      // Dynamic offsets идут в порядке bindings: scene (0), lighting (2)
+      std::vector<uint32_t> dynamicOffsets = {m_sceneUBOOffset, m_lightingUBOOffset};
 
-      if (m_meshBufferMap.find(meshName) == m_meshBufferMap.end())
+      if (m_useBindless)
       {
-        RegisterMesh(meshName, *renderObject.mesh);
+        // Set 1 и push constant задаются один раз: firstInstance группы попадает в gl_InstanceIndex
+        VkPipelineLayout layout = m_pipelineManager->GetBindlessPipelineLayout();
+        std::vector<VkDescriptorSet> descriptorSets = {sceneDescriptorSet, m_descriptorManager->GetBindlessSet()};
+        m_commandBufferManager->BindDescriptorSets(imageIndex, layout, 0, descriptorSets, dynamicOffsets);
+
+        BindlessDrawConstants constants;
+        constants.instanceBufferIndex = m_instanceBindlessSlots[m_currentFrame];
+        m_commandBufferManager->PushConstants(imageIndex, layout, VK_SHADER_STAGE_VERTEX_BIT,
+                                              0, sizeof(constants), &constants);
       }
-
-      if (m_meshBufferMap.find(meshName) == m_meshBufferMap.end())
+      else
       {
-        continue;  // Skip this mesh if registration failed
+        std::vector<VkDescriptorSet> descriptorSets = {sceneDescriptorSet};
+        m_commandBufferManager->BindDescriptorSets(imageIndex,
+                                                   m_pipelineManager->GetPipelineLayout(),
+                                                   0, descriptorSets, dynamicOffsets);
+
+        // Instance буфер привязывается один раз, firstInstance выбирает диапазон группы
+        std::vector<VkBuffer> instanceBuffers = {instanceBuffer};
+        std::vector<VkDeviceSize> instanceOffsets = {0};
+        m_commandBufferManager->BindVertexBuffers(imageIndex, 1, instanceBuffers, instanceOffsets);
       }
 
-      const auto& meshBuffers = m_meshBufferMap[meshName];
-
-      ModelUBO modelUBO = renderData.GetModelUBO(renderObject.transform, renderObject.color);
-
-      m_bufferManager->UpdateUniformBuffer(meshBuffers.modelUBOName, &modelUBO, sizeof(ModelUBO));
-
-      VkBuffer vertexBuffer = m_bufferManager->GetBuffer(meshBuffers.vertexBufferName);
-      VkBuffer indexBuffer = m_bufferManager->GetBuffer(meshBuffers.indexBufferName);
-
-      if (vertexBuffer != VK_NULL_HANDLE && indexBuffer != VK_NULL_HANDLE)
+      CE_GPU_PROFILE_SCOPE(m_gpuProfiler.get(), m_currentCommandBuffer, "GPU Draw Batches");
+      for (const auto& batch : m_instanceBatches)
       {
-        VkDescriptorSet meshDescriptorSet = m_descriptorManager->GetMeshDescriptorSet(meshName);
-        if (meshDescriptorSet != VK_NULL_HANDLE)
-        {
-          std::vector<VkDescriptorSet> descriptorSets = {meshDescriptorSet};
-          m_commandBufferManager->BindDescriptorSets(imageIndex,
-                                                     m_pipelineManager->GetPipelineLayout(),
-                                                     0, descriptorSets);
-        }
+        const MeshBuffers* meshBuffers = m_meshes.Get(batch.mesh);
+        if (!meshBuffers)
+          continue;
+
+        VkBuffer vertexBuffer = m_bufferManager->GetBuffer(meshBuffers->vertexBuffer);
+        VkBuffer indexBuffer = m_bufferManager->GetBuffer(meshBuffers->indexBuffer);
+        if (vertexBuffer == VK_NULL_HANDLE || indexBuffer == VK_NULL_HANDLE)
+          continue;
 
+        // Интервалов на кадр не больше MAX_SCOPES_PER_FRAME, остальные группы рисуются без замера
+        CE_GPU_PROFILE_SCOPE(m_gpuProfiler.get(), m_currentCommandBuffer, "GPU Draw Batch");
         std::vector<VkBuffer> vertexBuffers = {vertexBuffer};
         std::vector<VkDeviceSize> offsets = {0};
         m_commandBufferManager->BindVertexBuffers(imageIndex, 0, vertexBuffers, offsets);
         m_commandBufferManager->BindIndexBuffer(imageIndex, indexBuffer, 0, VK_INDEX_TYPE_UINT32);
-        m_commandBufferManager->DrawIndexed(imageIndex,
-                                            static_cast<uint32_t>(renderObject.mesh->indices.size()),
-                                            1, 0, 0, 0);
+        m_commandBufferManager->DrawIndexed(imageIndex, batch.indexCount,
+                                            batch.instanceCount, 0, 0, batch.firstInstance);
       }
     }
   }
 
   m_commandBufferManager->EndRenderPass(imageIndex);
-
-  m_commandBufferManager->EndRecording(imageIndex);
 }
 
 void VulkanContext::UpdateUniformBuffers(const FrameRenderData& renderData)
 {
-  LightingUBO lightingUBO = renderData.lighting;
+  // Фенс m_currentFrame уже дождались, его регион кольца свободен
+  m_uniformRing->BeginFrame(m_currentFrame);
 
-  m_bufferManager->UpdateUniformBuffer(m_lightingUBOBufferName, &lightingUBO, sizeof(LightingUBO));
-
-  SceneUBO sceneUBO = renderData.GetSceneUBO();
-  m_bufferManager->UpdateUniformBuffer(m_sceneUBOBufferName, &sceneUBO, sizeof(SceneUBO));
+  m_uniformRing->Push(renderData.GetSceneUBO(), m_sceneUBOOffset);
+  m_uniformRing->Push(renderData.lighting, m_lightingUBOOffset);
 }
 
 bool VulkanContext::ShouldClose() const
@@ -587,6 +907,15 @@ bool VulkanContext::InitWindow()
 
 bool VulkanContext::CreateInstance()
 {
+  // Загрузчик 1.0 отвергает instance с apiVersion выше 1.0, а vkEnumerateInstanceVersion появился в 1.1
+  auto enumerateInstanceVersion = (PFN_vkEnumerateInstanceVersion)vkGetInstanceProcAddr(nullptr, "vkEnumerateInstanceVersion");
+  uint32_t loaderVersion = VK_API_VERSION_1_0;
+  if (enumerateInstanceVersion)
+  {
+    enumerateInstanceVersion(&loaderVersion);
+  }
+  m_apiVersion = loaderVersion >= VK_API_VERSION_1_2 ? VK_API_VERSION_1_2 : VK_API_VERSION_1_0;
+
   VkApplicationInfo AppInfo{};
   AppInfo.sType = VK_STRUCTURE_TYPE_APPLICATION_INFO;
   AppInfo.pNext = nullptr;
@@ -594,7 +923,7 @@ bool VulkanContext::CreateInstance()
   AppInfo.applicationVersion = VK_MAKE_VERSION(m_info->AppVerion[0], m_info->AppVerion[1], m_info->AppVerion[2]);
   AppInfo.pEngineName = m_info->EngineName.c_str();
   AppInfo.engineVersion = VK_MAKE_VERSION(m_info->EngineVersion[0], m_info->EngineVersion[1], m_info->EngineVersion[2]);
-  AppInfo.apiVersion = VK_API_VERSION_1_0;
+  AppInfo.apiVersion = m_apiVersion;
 
   auto Extensions = VulkanUtils::GetRequiredExtensions(bIsValidationEnabled);
 
@@ -0,0 +1,97 @@
+#include "Engine/Core/Rendering/Vulkan/Integration/RenderThread.h"
+
+RenderThread::RenderThread(RenderSystem* renderSystem, uint32_t frameBuffers)
+    : m_renderSystem{renderSystem}, m_frames{frameBuffers}
+{
+}
+
+RenderThread::~RenderThread()
+{
+  if (m_thread.joinable())
+  {
+    m_frames.Close();
+    m_thread.join();
+  }
+}
+
+void RenderThread::Start()
+{
+  if (m_thread.joinable())
+    return;
+
+  m_thread = std::thread(&RenderThread::ThreadLoop, this);
+  CORE_DEBUG("Render thread started, frame buffers: ", m_frames.GetSlotCount());
+}
+
+void RenderThread::Stop()
+{
+  if (!m_thread.joinable())
+    return;
+
+  m_frames.Close();
+  m_thread.join();
+  CORE_DEBUG("Render thread stopped");
+  RethrowRenderError();
+}
+
+FrameRenderData* RenderThread::BeginFrame()
+{
+  FrameRenderData* data = m_frames.BeginWrite();
+  if (!data)
+  {
+    // Очередь закрывает и упавший рендер поток: его ошибка важнее пустого кадра
+    RethrowRenderError();
+  }
+  return data;
+}
+
+void RenderThread::EndFrame()
+{
+  m_frames.EndWrite();
+  if (m_thread.joinable())
+    return;
+
+  // Без потока рисуем сразу: снимок только что опубликован, BeginRead не ждет
+  if (const FrameRenderData* data = m_frames.BeginRead())
+  {
+    m_renderSystem->DrawFrame(*data);
+    m_frames.EndRead();
+  }
+}
+
+void RenderThread::Flush()
+{
+  m_frames.WaitIdle();
+  RethrowRenderError();
+}
+
+void RenderThread::ThreadLoop()
+{
+  CProfiler::SetThreadName("Render Thread");
+
+  try
+  {
+    while (const FrameRenderData* data = m_frames.BeginRead())
+    {
+      CE_PROFILE_SCOPE("RenderThread::Frame");
+      m_renderSystem->DrawFrame(*data);
+      m_frames.EndRead();
+    }
+  }
+  catch (...)
+  {
+    m_error = std::current_exception();
+    m_frames.EndRead();
+    m_frames.Close();
+  }
+}
+
+void RenderThread::RethrowRenderError()
+{
+  if (m_error)
+  {
+    std::exception_ptr error = m_error;
+    m_error = nullptr;
+    std::rethrow_exception(error);
+  }
+}
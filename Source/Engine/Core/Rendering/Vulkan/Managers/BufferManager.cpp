@@ -27,13 +27,25 @@
     VkResult result = vkCreateCommandPool(m_deviceManager->GetDevice(), &poolInfo, nullptr, &m_commandPool);
     VK_CHECK(result, "Failed to create command pool for buffer manager");
 
+    m_allocator = std::make_shared<MemoryAllocator>(m_deviceManager);
+    if (!m_allocator->Initialize())
+    {
+      RENDER_ERROR("Failed to initialize memory allocator");
+      return false;
+    }
+
     RENDER_DEBUG("BufferManager initialized successfully");
     return true;
   }
 
   void BufferManager::Shutdown()
   {
-    DestroyAllBuffers();
+    if (m_allocator)
+    {
+      DestroyAllBuffers();
+      m_allocator->Shutdown();
+      m_allocator.reset();
+    }
 
     if (m_commandPool != VK_NULL_HANDLE)
     {
@@ -45,305 +57,242 @@
     RENDER_DEBUG("BufferManager shutdown complete");
   }
 
-  VkDescriptorBufferInfo BufferManager::GetBufferInfo(const std::string& name) const
+  VkDescriptorBufferInfo BufferManager::GetBufferInfo(BufferHandle handle) const
   {
-    auto it = m_buffers.find(name);
-    if (it != m_buffers.end())
+    const BufferInfo* info = m_buffers.Get(handle);
+    if (info)
     {
       VkDescriptorBufferInfo bufferInfo{};
-      bufferInfo.buffer = it->second.buffer;
+      bufferInfo.buffer = info->buffer;
       bufferInfo.offset = 0;
-      bufferInfo.range = it->second.size;
+      bufferInfo.range = info->size;
       return bufferInfo;
     }
 
-    RENDER_ERROR("Buffer '", name, "' not found for descriptor info");
+    RENDER_ERROR("Buffer handle ", handle.index, " is stale or invalid for descriptor info");
     return VkDescriptorBufferInfo{};
   }
 
-  bool BufferManager::CreateVertexBuffer(const std::string& name, const std::vector<Vertex>& vertices)
-  {
-    if (!vertices.empty())
-    {
-      if (m_buffers.find(name) != m_buffers.end())
-      {
-        RENDER_WARN("Vertex buffer '", name, "' already exists");
-        return true;
-      }
-
-      VkDeviceSize bufferSize = sizeof(vertices[0]) * vertices.size();
-
-      VkBuffer stagingBuffer;
-      VkDeviceMemory stagingBufferMemory;
-      if (!CreateBuffer(bufferSize, VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
-                        VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
-                        stagingBuffer, stagingBufferMemory))
-      {
-        RENDER_ERROR("Failed to create staging buffer for vertex buffer '", name, "'");
-        return false;
-      }
-
-      void* data;
-      vkMapMemory(m_deviceManager->GetDevice(), stagingBufferMemory, 0, bufferSize, 0, &data);
-      memcpy(data, vertices.data(), (size_t)bufferSize);
-      vkUnmapMemory(m_deviceManager->GetDevice(), stagingBufferMemory);
-
-      VkBuffer vertexBuffer;
-      VkDeviceMemory vertexBufferMemory;
-      if (!CreateBuffer(bufferSize,
-                        VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_VERTEX_BUFFER_BIT,
-                        VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT,
-                        vertexBuffer, vertexBufferMemory))
-      {
-        RENDER_ERROR("Failed to create vertex buffer '", name, "'");
-        vkDestroyBuffer(m_deviceManager->GetDevice(), stagingBuffer, nullptr);
-        vkFreeMemory(m_deviceManager->GetDevice(), stagingBufferMemory, nullptr);
-        return false;
-      }
-
-      CopyBuffer(stagingBuffer, vertexBuffer, bufferSize);
-
-      BufferInfo bufferInfo;
-      bufferInfo.buffer = vertexBuffer;
-      bufferInfo.memory = vertexBufferMemory;
-      bufferInfo.size = bufferSize;
-      bufferInfo.type = BufferType::VERTEX;
-      m_buffers[name] = bufferInfo;
-
-      vkDestroyBuffer(m_deviceManager->GetDevice(), stagingBuffer, nullptr);
-      vkFreeMemory(m_deviceManager->GetDevice(), stagingBufferMemory, nullptr);
+  BufferHandle BufferManager::CreateVertexBuffer(const std::string& name, const std::vector<Vertex>& vertices)
+  {
+    if (vertices.empty())
+    {
+      return {};
+    }
+    return CreateDeviceLocalBuffer(name, vertices.data(), sizeof(vertices[0]) * vertices.size(),
+                                   VK_BUFFER_USAGE_VERTEX_BUFFER_BIT, BufferType::VERTEX);
+  }
 
-      return true;
+  BufferHandle BufferManager::CreateIndexBuffer(const std::string& name, const std::vector<uint32_t>& indices)
+  {
+    if (indices.empty())
+    {
+      return {};
     }
-    return false;
+    return CreateDeviceLocalBuffer(name, indices.data(), sizeof(indices[0]) * indices.size(),
+                                   VK_BUFFER_USAGE_INDEX_BUFFER_BIT, BufferType::INDEX);
   }
 
-  bool BufferManager::CreateIndexBuffer(const std::string& name, const std::vector<uint32_t>& indices)
+  BufferHandle BufferManager::CreateDeviceLocalBuffer(const std::string& name, const void* data, VkDeviceSize size,
+                                                      VkBufferUsageFlags usage, BufferType type)
   {
-    if (!indices.empty())
+    BufferHandle existing = FindBuffer(name);
+    if (existing)
     {
-      if (m_buffers.find(name) != m_buffers.end())
-      {
-        RENDER_WARN("Index buffer '", name, "' already exists");
-        return true;
-      }
+      RENDER_WARN("Buffer '", name, "' already exists");
+      return existing;
+    }
 
-      VkDeviceSize bufferSize = sizeof(indices[0]) * indices.size();
+    // Staging живет только до конца копирования, поэтому берется из линейного блока
+    BufferInfo staging;
+    if (!CreateBuffer(size, VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
+                      VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+                      AllocationStrategy::LINEAR, staging))
+    {
+      RENDER_ERROR("Failed to create staging buffer for '", name, "'");
+      return {};
+    }
 
-      VkBuffer stagingBuffer;
-      VkDeviceMemory stagingBufferMemory;
-      if (!CreateBuffer(bufferSize, VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
-                        VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
-                        stagingBuffer, stagingBufferMemory))
-      {
-        RENDER_ERROR("Failed to create staging buffer for index buffer '", name, "'");
-        return false;
-      }
+    memcpy(staging.allocation.mappedData, data, (size_t)size);
 
-      void* data;
-      vkMapMemory(m_deviceManager->GetDevice(), stagingBufferMemory, 0, bufferSize, 0, &data);
-      memcpy(data, indices.data(), (size_t)bufferSize);
-      vkUnmapMemory(m_deviceManager->GetDevice(), stagingBufferMemory);
+    BufferInfo bufferInfo;
+    if (!CreateBuffer(size, VK_BUFFER_USAGE_TRANSFER_DST_BIT | usage,
+                      VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT,
+                      AllocationStrategy::FREE_LIST, bufferInfo))
+    {
+      RENDER_ERROR("Failed to create buffer '", name, "'");
+      ReleaseBuffer(staging);
+      return {};
+    }
 
-      VkBuffer indexBuffer;
-      VkDeviceMemory indexBufferMemory;
-      if (!CreateBuffer(bufferSize,
-                        VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_INDEX_BUFFER_BIT,
-                        VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT,
-                        indexBuffer, indexBufferMemory))
-      {
-        RENDER_ERROR("Failed to create index buffer '", name, "'");
-        vkDestroyBuffer(m_deviceManager->GetDevice(), stagingBuffer, nullptr);
-        vkFreeMemory(m_deviceManager->GetDevice(), stagingBufferMemory, nullptr);
-        return false;
-      }
+    CopyBuffer(staging.buffer, bufferInfo.buffer, size);
+    ReleaseBuffer(staging);
 
-      CopyBuffer(stagingBuffer, indexBuffer, bufferSize);
+    bufferInfo.type = type;
+    return Register(name, std::move(bufferInfo));
+  }
 
-      BufferInfo bufferInfo;
-      bufferInfo.buffer = indexBuffer;
-      bufferInfo.memory = indexBufferMemory;
-      bufferInfo.size = bufferSize;
-      bufferInfo.type = BufferType::INDEX;
-      m_buffers[name] = bufferInfo;
-
-      vkDestroyBuffer(m_deviceManager->GetDevice(), stagingBuffer, nullptr);
-      vkFreeMemory(m_deviceManager->GetDevice(), stagingBufferMemory, nullptr);
-
-      return true;
-    }
-    return false;
-  }
-
-  bool BufferManager::CreateUniformBuffer(const std::string& name, VkDeviceSize size)
-  {
-    if (m_buffers.find(name) != m_buffers.end())
-    {
-      RENDER_WARN("Uniform buffer '", name, "' already exists");
-      return true;
-    }
+  BufferHandle BufferManager::CreateDeviceBuffer(const std::string& name, VkDeviceSize size,
+                                                 VkBufferUsageFlags usage, BufferType type)
+  {
+    return CreateNamedBuffer(name, size, VK_BUFFER_USAGE_TRANSFER_DST_BIT | usage,
+                             VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT,
+                             AllocationStrategy::FREE_LIST, type);
+  }
 
-    VkBuffer uniformBuffer;
-    VkDeviceMemory uniformBufferMemory;
-    if (!CreateBuffer(size,
-                      VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT,
-                      VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
-                      uniformBuffer, uniformBufferMemory))
+  BufferHandle BufferManager::CreateUniformBuffer(const std::string& name, VkDeviceSize size)
+  {
+    return CreateNamedBuffer(name, size,
+                             VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT,
+                             VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+                             AllocationStrategy::FREE_LIST, BufferType::UNIFORM);
+  }
+
+  BufferHandle BufferManager::CreateStagingBuffer(const std::string& name, VkDeviceSize size)
+  {
+    BufferHandle handle = CreateNamedBuffer(name, size,
+                                            VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
+                                            VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+                                            AllocationStrategy::LINEAR, BufferType::STAGING);
+    if (handle)
     {
-      RENDER_ERROR("Failed to create uniform buffer '", name, "'");
-      return false;
+      RENDER_DEBUG("Created staging buffer '", name, "' with size ", size);
     }
-
-    BufferInfo bufferInfo;
-    bufferInfo.buffer = uniformBuffer;
-    bufferInfo.memory = uniformBufferMemory;
-    bufferInfo.size = size;
-    bufferInfo.type = BufferType::UNIFORM;
-    m_buffers[name] = bufferInfo;
-
-    return true;
+    return handle;
   }
 
-  bool BufferManager::CreateStagingBuffer(const std::string& name, VkDeviceSize size)
+  BufferHandle BufferManager::CreateDynamicVertexBuffer(const std::string& name, VkDeviceSize size, VkBufferUsageFlags extraUsage)
   {
-    if (m_buffers.find(name) != m_buffers.end())
+    BufferHandle handle = CreateNamedBuffer(name, size,
+                                            VK_BUFFER_USAGE_VERTEX_BUFFER_BIT | extraUsage,
+                                            VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+                                            AllocationStrategy::FREE_LIST, BufferType::VERTEX);
+    if (handle && !MapBuffer(handle))
     {
-      RENDER_WARN("Staging buffer '", name, "' already exists");
-      return true;
+      DestroyBuffer(handle);
+      return {};
     }
+    return handle;
+  }
 
-    VkBuffer stagingBuffer;
-    VkDeviceMemory stagingBufferMemory;
-    if (!CreateBuffer(size,
-                      VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
-                      VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
-                      stagingBuffer, stagingBufferMemory))
+  BufferHandle BufferManager::CreateNamedBuffer(const std::string& name, VkDeviceSize size, VkBufferUsageFlags usage,
+                                                VkMemoryPropertyFlags properties, AllocationStrategy strategy, BufferType type)
+  {
+    BufferHandle existing = FindBuffer(name);
+    if (existing)
     {
-      RENDER_ERROR("Failed to create staging buffer '", name, "'");
-      return false;
+      RENDER_WARN("Buffer '", name, "' already exists");
+      return existing;
     }
 
     BufferInfo bufferInfo;
-    bufferInfo.buffer = stagingBuffer;
-    bufferInfo.memory = stagingBufferMemory;
-    bufferInfo.size = size;
-    bufferInfo.type = BufferType::STAGING;
-    m_buffers[name] = bufferInfo;
+    if (!CreateBuffer(size, usage, properties, strategy, bufferInfo))
+    {
+      RENDER_ERROR("Failed to create buffer '", name, "'");
+      return {};
+    }
 
-    RENDER_DEBUG("Created staging buffer '", name, "' with size ", size);
-    return true;
+    bufferInfo.type = type;
+    return Register(name, std::move(bufferInfo));
   }
 
-  bool BufferManager::UpdateVertexBuffer(const std::string& name, const std::vector<Vertex>& vertices)
+  BufferHandle BufferManager::Register(const std::string& name, BufferInfo&& bufferInfo)
   {
-    auto it = m_buffers.find(name);
-    if (it == m_buffers.end() || it->second.type != BufferType::VERTEX)
+    bufferInfo.name = name;
+    BufferHandle handle = m_buffers.Create(std::move(bufferInfo));
+    if (!name.empty())
     {
-      RENDER_ERROR("Vertex buffer '", name, "' not found or wrong type");
-      return false;
+      m_namedBuffers[name] = handle;
     }
+    return handle;
+  }
 
-    VkDeviceSize newSize = sizeof(vertices[0]) * vertices.size();
-    if (newSize > it->second.size)
+  bool BufferManager::UpdateVertexBuffer(BufferHandle handle, const std::vector<Vertex>& vertices)
+  {
+    if (!UpdateDeviceLocalBuffer(handle, BufferType::VERTEX, vertices.data(), sizeof(Vertex) * vertices.size()))
     {
-      RENDER_ERROR("New vertex data too large for buffer '", name, "'");
       return false;
     }
 
-    // Создаем временный staging buffer
-    std::string stagingName = name + "_staging_temp";
-    if (!CreateStagingBuffer(stagingName, newSize))
+    RENDER_DEBUG("Updated vertex buffer '", GetBufferName(handle), "' with ", vertices.size(), " vertices");
+    return true;
+  }
+
+  bool BufferManager::UpdateIndexBuffer(BufferHandle handle, const std::vector<uint32_t>& indices)
+  {
+    if (!UpdateDeviceLocalBuffer(handle, BufferType::INDEX, indices.data(), sizeof(uint32_t) * indices.size()))
     {
       return false;
     }
 
-    // Копируем данные в staging buffer
-    void* data = MapBuffer(stagingName);
-    memcpy(data, vertices.data(), (size_t)newSize);
-    UnmapBuffer(stagingName);
-
-    // Копируем в vertex buffer
-    CopyBuffer(stagingName, name, newSize);
-
-    // Удаляем временный staging buffer
-    DestroyBuffer(stagingName);
-
-    RENDER_DEBUG("Updated vertex buffer '", name, "' with ", vertices.size(), " vertices");
+    RENDER_DEBUG("Updated index buffer '", GetBufferName(handle), "' with ", indices.size(), " indices");
     return true;
   }
 
-  bool BufferManager::UpdateIndexBuffer(const std::string& name, const std::vector<uint32_t>& indices)
+  bool BufferManager::UpdateDeviceLocalBuffer(BufferHandle handle, BufferType type, const void* data, VkDeviceSize size)
   {
-    auto it = m_buffers.find(name);
-    if (it == m_buffers.end() || it->second.type != BufferType::INDEX)
+    const BufferInfo* info = m_buffers.Get(handle);
+    if (!info || info->type != type)
     {
-      RENDER_ERROR("Index buffer '", name, "' not found or wrong type");
+      RENDER_ERROR("Buffer handle ", handle.index, " not found or wrong type");
       return false;
     }
 
-    VkDeviceSize newSize = sizeof(indices[0]) * indices.size();
-    if (newSize > it->second.size)
+    if (size == 0 || size > info->size)
     {
-      RENDER_ERROR("New index data too large for buffer '", name, "'");
+      RENDER_ERROR("New data does not fit buffer '", info->name, "'");
       return false;
     }
 
     // Создаем временный staging buffer
-    std::string stagingName = name + "_staging_temp";
-    if (!CreateStagingBuffer(stagingName, newSize))
+    BufferInfo staging;
+    if (!CreateBuffer(size, VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
+                      VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+                      AllocationStrategy::LINEAR, staging))
     {
       return false;
     }
 
-    // Копируем данные в staging buffer
-    void* data = MapBuffer(stagingName);
-    memcpy(data, indices.data(), (size_t)newSize);
-    UnmapBuffer(stagingName);
-
-    // Копируем в index buffer
-    CopyBuffer(stagingName, name, newSize);
+    // Копируем данные в staging buffer и затем в целевой буфер
+    memcpy(staging.allocation.mappedData, data, (size_t)size);
+    CopyBuffer(staging.buffer, info->buffer, size);
 
     // Удаляем временный staging buffer
-    DestroyBuffer(stagingName);
-
-    RENDER_DEBUG("Updated index buffer '", name, "' with ", indices.size(), " indices");
+    ReleaseBuffer(staging);
     return true;
   }
 
-  bool BufferManager::UpdateUniformBuffer(const std::string& name, const void* data, VkDeviceSize size)
+  bool BufferManager::UpdateUniformBuffer(BufferHandle handle, const void* data, VkDeviceSize size)
   {
-    auto it = m_buffers.find(name);
-    if (it == m_buffers.end() || it->second.type != BufferType::UNIFORM)
+    BufferInfo* info = m_buffers.Get(handle);
+    if (!info || info->type != BufferType::UNIFORM)
     {
-      RENDER_ERROR("Uniform buffer '", name, "' not found or wrong type");
+      RENDER_ERROR("Uniform buffer handle ", handle.index, " not found or wrong type");
       return false;
     }
 
-    if (size > it->second.size)
+    if (size > info->size)
     {
-      RENDER_ERROR("Data too large for uniform buffer '", name, "'");
+      RENDER_ERROR("Data too large for uniform buffer '", info->name, "'");
       return false;
     }
 
-    void* mappedData;
-    vkMapMemory(m_deviceManager->GetDevice(), it->second.memory, 0, size, 0, &mappedData);
-    memcpy(mappedData, data, (size_t)size);
-    vkUnmapMemory(m_deviceManager->GetDevice(), it->second.memory);
+    memcpy(info->allocation.mappedData, data, (size_t)size);
     return true;
   }
 
-  void BufferManager::CopyBuffer(const std::string& srcName, const std::string& dstName, VkDeviceSize size)
+  void BufferManager::CopyBuffer(BufferHandle src, BufferHandle dst, VkDeviceSize size)
   {
-    auto srcIt = m_buffers.find(srcName);
-    auto dstIt = m_buffers.find(dstName);
+    VkBuffer srcBuffer = GetBuffer(src);
+    VkBuffer dstBuffer = GetBuffer(dst);
 
-    if (srcIt == m_buffers.end() || dstIt == m_buffers.end())
+    if (srcBuffer == VK_NULL_HANDLE || dstBuffer == VK_NULL_HANDLE)
     {
       RENDER_ERROR("Source or destination buffer not found for copy operation");
       return;
     }
 
-    CopyBuffer(srcIt->second.buffer, dstIt->second.buffer, size);
+    CopyBuffer(srcBuffer, dstBuffer, size);
   }
 
   void BufferManager::CopyBuffer(VkBuffer srcBuffer, VkBuffer dstBuffer, VkDeviceSize size)
@@ -353,90 +302,118 @@
                             srcBuffer, dstBuffer, size);
   }
 
-  VkBuffer BufferManager::GetBuffer(const std::string& name) const
+  MemoryAllocatorStats BufferManager::GetMemoryStats() const
+  {
+    return m_allocator ? m_allocator->GetStats() : MemoryAllocatorStats{};
+  }
+
+  VkBuffer BufferManager::GetBuffer(BufferHandle handle) const
+  {
+    const BufferInfo* info = m_buffers.Get(handle);
+    return info ? info->buffer : VK_NULL_HANDLE;
+  }
+
+  VkDeviceSize BufferManager::GetBufferSize(BufferHandle handle) const
+  {
+    const BufferInfo* info = m_buffers.Get(handle);
+    return info ? info->size : 0;
+  }
+
+  BufferType BufferManager::GetBufferType(BufferHandle handle) const
   {
-    auto it = m_buffers.find(name);
-    return it != m_buffers.end() ? it->second.buffer : VK_NULL_HANDLE;
+    const BufferInfo* info = m_buffers.Get(handle);
+    return info ? info->type : BufferType::VERTEX;
   }
 
-  VkDeviceSize BufferManager::GetBufferSize(const std::string& name) const
+  const std::string& BufferManager::GetBufferName(BufferHandle handle) const
   {
-    auto it = m_buffers.find(name);
-    return it != m_buffers.end() ? it->second.size : 0;
+    static const std::string empty;
+    const BufferInfo* info = m_buffers.Get(handle);
+    return info ? info->name : empty;
   }
 
-  BufferType BufferManager::GetBufferType(const std::string& name) const
+  BufferHandle BufferManager::FindBuffer(const std::string& name) const
   {
-    auto it = m_buffers.find(name);
-    return it != m_buffers.end() ? it->second.type : BufferType::VERTEX;
+    if (name.empty())
+    {
+      return {};
+    }
+    auto it = m_namedBuffers.find(name);
+    return it != m_namedBuffers.end() ? it->second : BufferHandle{};
   }
 
-  void* BufferManager::MapBuffer(const std::string& name)
+  void* BufferManager::MapBuffer(BufferHandle handle)
   {
-    auto it = m_buffers.find(name);
-    if (it == m_buffers.end())
+    BufferInfo* info = m_buffers.Get(handle);
+    if (!info)
     {
-      RENDER_ERROR("Buffer '", name, "' not found for mapping");
+      RENDER_ERROR("Buffer handle ", handle.index, " not found for mapping");
       return nullptr;
     }
 
-    if (it->second.mappedData)
+    if (info->mappedData)
+    {
+      RENDER_WARN("Buffer '", info->name, "' is already mapped");
+      return info->mappedData;
+    }
+
+    // Host-visible блоки аллокатора отображены постоянно, отдаем указатель на свой участок
+    if (!info->allocation.mappedData)
     {
-      RENDER_WARN("Buffer '", name, "' is already mapped");
-      return it->second.mappedData;
+      RENDER_ERROR("Buffer '", info->name, "' is not host-visible");
+      return nullptr;
     }
+    info->mappedData = info->allocation.mappedData;
+    return info->mappedData;
+  }
 
-    vkMapMemory(m_deviceManager->GetDevice(), it->second.memory, 0, it->second.size, 0, &it->second.mappedData);
-    return it->second.mappedData;
+  void* BufferManager::GetMappedData(BufferHandle handle) const
+  {
+    const BufferInfo* info = m_buffers.Get(handle);
+    return info ? info->mappedData : nullptr;
   }
 
-  void BufferManager::UnmapBuffer(const std::string& name)
+  void BufferManager::UnmapBuffer(BufferHandle handle)
   {
-    auto it = m_buffers.find(name);
-    if (it == m_buffers.end() || !it->second.mappedData)
+    BufferInfo* info = m_buffers.Get(handle);
+    if (info)
     {
-      return;
+      info->mappedData = nullptr;
     }
-
-    vkUnmapMemory(m_deviceManager->GetDevice(), it->second.memory);
-    it->second.mappedData = nullptr;
   }
 
-  void BufferManager::DestroyBuffer(const std::string& name)
+  void BufferManager::DestroyBuffer(BufferHandle handle)
   {
-    auto it = m_buffers.find(name);
-    if (it == m_buffers.end())
+    BufferInfo* info = m_buffers.Get(handle);
+    if (!info)
     {
       return;
     }
 
-    if (it->second.mappedData)
+    if (!info->name.empty())
     {
-      UnmapBuffer(name);
+      m_namedBuffers.erase(info->name);
+      RENDER_DEBUG("Destroyed buffer '", info->name, "'");
     }
 
-    DestroyBuffer(it->second);
-    m_buffers.erase(it);
-    RENDER_DEBUG("Destroyed buffer '", name, "'");
+    ReleaseBuffer(*info);
+    m_buffers.Destroy(handle);
   }
 
   void BufferManager::DestroyAllBuffers()
   {
-    for (auto& [name, bufferInfo] : m_buffers)
-    {
-      if (bufferInfo.mappedData)
-      {
-        vkUnmapMemory(m_deviceManager->GetDevice(), bufferInfo.memory);
-      }
-      DestroyBuffer(bufferInfo);
-      RENDER_DEBUG("Destroyed buffer '", name, "'");
-    }
-    m_buffers.clear();
+    m_buffers.ForEach([this](BufferHandle, BufferInfo& bufferInfo)
+                      {
+                        ReleaseBuffer(bufferInfo);
+                      });
+    RENDER_DEBUG("Destroyed ", m_buffers.Size(), " buffers");
+    m_buffers.Clear();
+    m_namedBuffers.clear();
   }
 
   bool BufferManager::CreateBuffer(VkDeviceSize size, VkBufferUsageFlags usage,
-                                   VkMemoryPropertyFlags properties, VkBuffer& buffer,
-                                   VkDeviceMemory& bufferMemory)
+                                   VkMemoryPropertyFlags properties, AllocationStrategy strategy,
+                                   BufferInfo& outBuffer)
   {
     VkBufferCreateInfo bufferInfo{};
     bufferInfo.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
@@ -444,6 +421,17 @@
     bufferInfo.usage = usage;
     bufferInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
 
+    // С отдельной transfer очередью буфер доступен обоим семействам без передачи владения
+    const QueueFamilyIndices& indices = m_deviceManager->getIndices();
+    const uint32_t queueFamilies[] = {indices.graphicsFamily, indices.transferFamily};
+    if (m_deviceManager->HasDedicatedTransferQueue())
+    {
+      bufferInfo.sharingMode = VK_SHARING_MODE_CONCURRENT;
+      bufferInfo.queueFamilyIndexCount = 2;
+      bufferInfo.pQueueFamilyIndices = queueFamilies;
+    }
+
+    VkBuffer buffer = VK_NULL_HANDLE;
     VkResult result = vkCreateBuffer(m_deviceManager->GetDevice(), &bufferInfo, nullptr, &buffer);
     if (result != VK_SUCCESS)
     {
@@ -454,24 +442,23 @@
     VkMemoryRequirements memRequirements;
     vkGetBufferMemoryRequirements(m_deviceManager->GetDevice(), buffer, &memRequirements);
 
-    VkMemoryAllocateInfo allocInfo{};
-    allocInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
-    allocInfo.allocationSize = memRequirements.size;
-    allocInfo.memoryTypeIndex = FindMemoryType(memRequirements.memoryTypeBits, properties);
-
-    result = vkAllocateMemory(m_deviceManager->GetDevice(), &allocInfo, nullptr, &bufferMemory);
-    if (result != VK_SUCCESS)
+    MemoryAllocation allocation;
+    if (!m_allocator->Allocate(memRequirements, properties, strategy, allocation))
     {
       RENDER_ERROR("Failed to allocate buffer memory");
       vkDestroyBuffer(m_deviceManager->GetDevice(), buffer, nullptr);
       return false;
     }
 
-    vkBindBufferMemory(m_deviceManager->GetDevice(), buffer, bufferMemory, 0);
+    vkBindBufferMemory(m_deviceManager->GetDevice(), buffer, allocation.memory, allocation.offset);
+
+    outBuffer.buffer = buffer;
+    outBuffer.allocation = allocation;
+    outBuffer.size = size;
     return true;
   }
 
-  void BufferManager::DestroyBuffer(BufferInfo& bufferInfo)
+  void BufferManager::ReleaseBuffer(BufferInfo& bufferInfo)
   {
     if (bufferInfo.buffer != VK_NULL_HANDLE)
     {
@@ -479,14 +466,6 @@
       bufferInfo.buffer = VK_NULL_HANDLE;
     }
 
-    if (bufferInfo.memory != VK_NULL_HANDLE)
-    {
-      vkFreeMemory(m_deviceManager->GetDevice(), bufferInfo.memory, nullptr);
-      bufferInfo.memory = VK_NULL_HANDLE;
-    }
+    m_allocator->Free(bufferInfo.allocation);
+    bufferInfo.mappedData = nullptr;
   }
-
-  uint32_t BufferManager::FindMemoryType(uint32_t typeFilter, VkMemoryPropertyFlags properties)
-  {
-    return VulkanUtils::FindMemoryType(m_deviceManager->GetPhysicalDevice(), typeFilter, properties);
-  }
\ No newline at end of file
@@ -151,7 +151,8 @@
   }
 
   void CommandBufferManager::BindDescriptorSets(uint32_t commandBufferIndex, VkPipelineLayout layout,
-                                                uint32_t firstSet, const std::vector<VkDescriptorSet>& descriptorSets)
+                                                uint32_t firstSet, const std::vector<VkDescriptorSet>& descriptorSets,
+                                                const std::vector<uint32_t>& dynamicOffsets)
   {
     if (commandBufferIndex >= m_commandBuffers.size())
     {
@@ -165,7 +166,20 @@
                             firstSet,
                             static_cast<uint32_t>(descriptorSets.size()),
                             descriptorSets.data(),
-                            0, nullptr);
+                            static_cast<uint32_t>(dynamicOffsets.size()),
+                            dynamicOffsets.empty() ? nullptr : dynamicOffsets.data());
+  }
+
+  void CommandBufferManager::PushConstants(uint32_t commandBufferIndex, VkPipelineLayout layout, VkShaderStageFlags stageFlags,
+                                           uint32_t offset, uint32_t size, const void* data)
+  {
+    if (commandBufferIndex >= m_commandBuffers.size())
+    {
+      RENDER_ERROR("Invalid command buffer index: ", commandBufferIndex);
+      return;
+    }
+
+    vkCmdPushConstants(m_commandBuffers[commandBufferIndex], layout, stageFlags, offset, size, data);
   }
 
   void CommandBufferManager::BindVertexBuffers(uint32_t commandBufferIndex, uint32_t firstBinding,
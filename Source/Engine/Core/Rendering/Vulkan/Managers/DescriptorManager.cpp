@@ -1,41 +1,146 @@
 #include "Engine/Core/Rendering/Vulkan/Managers/DescriptorManager.h"
 
+#include <algorithm>
 #include <stdexcept>
 
 #include "Engine/Core/Rendering/Data/RenderData.h"
 
-DescriptorManager::DescriptorManager(std::shared_ptr<DeviceManager> deviceManager, std::shared_ptr<BufferManager> bufferManager)
-    : m_deviceManager(deviceManager), m_bufferManager(bufferManager)
+namespace
+{
+  // Пропорции под текущие layout: scene/lighting - dynamic UBO, bindless данные - storage буферы
+  const std::vector<DescriptorPoolSizeRatio> POOL_RATIOS = {
+      {VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 1.0f},
+      {VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC, 2.0f},
+      {VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1.0f},
+  };
+
+  constexpr uint32_t PERSISTENT_POOL_SETS = 64;
+}  // namespace
+
+void DescriptorAllocator::Initialize(VkDevice device, uint32_t initialSets, const std::vector<DescriptorPoolSizeRatio>& ratios)
 {
+  m_device = device;
+  m_ratios = ratios;
+  m_setsPerPool = initialSets;
 }
 
-DescriptorManager::~DescriptorManager()
+void DescriptorAllocator::Destroy()
 {
-  Shutdown();
+  for (VkDescriptorPool pool : m_readyPools)
+  {
+    vkDestroyDescriptorPool(m_device, pool, nullptr);
+  }
+  for (VkDescriptorPool pool : m_fullPools)
+  {
+    vkDestroyDescriptorPool(m_device, pool, nullptr);
+  }
+  m_readyPools.clear();
+  m_fullPools.clear();
+  m_firstPool = VK_NULL_HANDLE;
 }
 
-bool DescriptorManager::Initialize()
+VkDescriptorSet DescriptorAllocator::Allocate(VkDescriptorSetLayout layout)
 {
-  RENDER_DEBUG("Initializing DescriptorManager...");
+  VkDescriptorPool pool = AcquirePool();
+  if (pool == VK_NULL_HANDLE)
+  {
+    return VK_NULL_HANDLE;
+  }
+
+  VkDescriptorSetAllocateInfo allocInfo{};
+  allocInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+  allocInfo.descriptorPool = pool;
+  allocInfo.descriptorSetCount = 1;
+  allocInfo.pSetLayouts = &layout;
 
-  // Создаем пул дескрипторов
-  std::array<VkDescriptorPoolSize, 3> poolSizes{};
-  poolSizes[0].type = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
-  poolSizes[0].descriptorCount = 100;
+  VkDescriptorSet descriptorSet = VK_NULL_HANDLE;
+  VkResult result = vkAllocateDescriptorSets(m_device, &allocInfo, &descriptorSet);
 
-  poolSizes[1].type = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
-  poolSizes[1].descriptorCount = 100;
+  // Пул кончился: откладываем его и повторяем из свежего
+  if (result == VK_ERROR_OUT_OF_POOL_MEMORY || result == VK_ERROR_FRAGMENTED_POOL)
+  {
+    m_fullPools.push_back(pool);
+    pool = AcquirePool();
+    if (pool == VK_NULL_HANDLE)
+    {
+      return VK_NULL_HANDLE;
+    }
+    allocInfo.descriptorPool = pool;
+    result = vkAllocateDescriptorSets(m_device, &allocInfo, &descriptorSet);
+  }
 
-  poolSizes[2].type = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
-  poolSizes[2].descriptorCount = 100;
+  if (result != VK_SUCCESS)
+  {
+    m_readyPools.push_back(pool);
+    RENDER_ERROR("Failed to allocate descriptor set: ", static_cast<int>(result));
+    return VK_NULL_HANDLE;
+  }
+
+  m_readyPools.push_back(pool);
+  return descriptorSet;
+}
+
+VkDescriptorPool DescriptorAllocator::AcquirePool()
+{
+  if (!m_readyPools.empty())
+  {
+    VkDescriptorPool pool = m_readyPools.back();
+    m_readyPools.pop_back();
+    return pool;
+  }
+
+  VkDescriptorPool pool = CreatePool(m_setsPerPool);
+  // Каждый следующий пул в полтора раза больше, чтобы длинная цепочка не росла на больших сценах
+  m_setsPerPool = std::min(m_setsPerPool + m_setsPerPool / 2, MAX_SETS_PER_POOL);
+  return pool;
+}
+
+VkDescriptorPool DescriptorAllocator::CreatePool(uint32_t setCount)
+{
+  std::vector<VkDescriptorPoolSize> poolSizes;
+  poolSizes.reserve(m_ratios.size());
+  for (const auto& ratio : m_ratios)
+  {
+    poolSizes.push_back({ratio.type, std::max(1u, static_cast<uint32_t>(ratio.ratio * setCount))});
+  }
 
   VkDescriptorPoolCreateInfo poolInfo{};
   poolInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
   poolInfo.poolSizeCount = static_cast<uint32_t>(poolSizes.size());
   poolInfo.pPoolSizes = poolSizes.data();
-  poolInfo.maxSets = 100;
-  VkResult result = vkCreateDescriptorPool(m_deviceManager->GetDevice(), &poolInfo, nullptr, &m_descriptorPool);
-  VK_CHECK(result, "Failed to create descriptor pool");
+  poolInfo.maxSets = setCount;
+
+  VkDescriptorPool pool = VK_NULL_HANDLE;
+  if (vkCreateDescriptorPool(m_device, &poolInfo, nullptr, &pool) != VK_SUCCESS)
+  {
+    RENDER_ERROR("Failed to create descriptor pool for ", setCount, " sets");
+    return VK_NULL_HANDLE;
+  }
+
+  if (m_firstPool == VK_NULL_HANDLE)
+  {
+    m_firstPool = pool;
+  }
+  RENDER_DEBUG("Created descriptor pool: ", setCount, " sets, ", GetPoolCount() + 1, " pools in chain");
+  return pool;
+}
+
+DescriptorManager::DescriptorManager(std::shared_ptr<DeviceManager> deviceManager, std::shared_ptr<BufferManager> bufferManager)
+    : m_deviceManager(deviceManager), m_bufferManager(bufferManager)
+{
+}
+
+DescriptorManager::~DescriptorManager()
+{
+  Shutdown();
+}
+
+bool DescriptorManager::Initialize()
+{
+  RENDER_DEBUG("Initializing DescriptorManager...");
+
+  VkDevice device = m_deviceManager->GetDevice();
+  m_persistentAllocator.Initialize(device, PERSISTENT_POOL_SETS, POOL_RATIOS);
 
   RENDER_DEBUG("DescriptorManager initialized successfully");
   return true;
@@ -43,32 +148,32 @@ bool DescriptorManager::Initialize()
 
 void DescriptorManager::Shutdown()
 {
-  if (m_descriptorPool != VK_NULL_HANDLE)
+  if (!m_deviceManager || m_deviceManager->GetDevice() == VK_NULL_HANDLE)
   {
-    vkDestroyDescriptorPool(m_deviceManager->GetDevice(), m_descriptorPool, nullptr);
-    m_descriptorPool = VK_NULL_HANDLE;
-    RENDER_DEBUG("Descriptor pool destroyed");
+    return;
   }
 
+  ShutdownBindless();
+
+  // Наборы освобождаются вместе с пулами
+  m_persistentAllocator.Destroy();
+  m_meshDescriptorSets.Clear();
+  m_descriptorSets.clear();
+
   RENDER_DEBUG("DescriptorManager shutdown complete");
 }
 
 bool DescriptorManager::CreateDescriptorSets(VkDescriptorSetLayout layout, uint32_t count)
 {
   m_descriptorSets.resize(count);
-  std::vector<VkDescriptorSetLayout> layouts(count, layout);
-
-  VkDescriptorSetAllocateInfo allocInfo{};
-  allocInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
-  allocInfo.descriptorPool = m_descriptorPool;
-  allocInfo.descriptorSetCount = count;
-  allocInfo.pSetLayouts = layouts.data();
-
-  VkResult result = vkAllocateDescriptorSets(m_deviceManager->GetDevice(), &allocInfo, m_descriptorSets.data());
-  if (result != VK_SUCCESS)
+  for (uint32_t i = 0; i < count; ++i)
   {
-    RENDER_ERROR("Failed to allocate descriptor sets");
-    return false;
+    m_descriptorSets[i] = m_persistentAllocator.Allocate(layout);
+    if (m_descriptorSets[i] == VK_NULL_HANDLE)
+    {
+      RENDER_ERROR("Failed to allocate descriptor sets");
+      return false;
+    }
   }
 
   RENDER_DEBUG("Created ", count, " descriptor sets");
@@ -84,118 +189,210 @@ VkDescriptorSet DescriptorManager::GetDescriptorSet(uint32_t imageIndex) const
   return VK_NULL_HANDLE;
 }
 
-bool DescriptorManager::CreateMeshDescriptorSet(const std::string& meshName, VkDescriptorSetLayout layout)
+DescriptorSetHandle DescriptorManager::CreateMeshDescriptorSet(VkDescriptorSetLayout layout, const std::string& debugName)
 {
-  if (m_meshDescriptorSets.find(meshName) != m_meshDescriptorSets.end())
+  VkDescriptorSet descriptorSet = m_persistentAllocator.Allocate(layout);
+  if (descriptorSet == VK_NULL_HANDLE)
   {
-    RENDER_WARN("Descriptor set for mesh '", meshName, "' already exists");
-    return true;
+    RENDER_ERROR("Failed to allocate descriptor set '", debugName, "'");
+    return {};
   }
 
-  VkDescriptorSet descriptorSet;
-  VkDescriptorSetLayout layouts[] = {layout};
+  return m_meshDescriptorSets.Create(std::move(descriptorSet));
+}
 
-  VkDescriptorSetAllocateInfo allocInfo{};
-  allocInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
-  allocInfo.descriptorPool = m_descriptorPool;
-  allocInfo.descriptorSetCount = 1;
-  allocInfo.pSetLayouts = layouts;
+VkDescriptorSet DescriptorManager::GetMeshDescriptorSet(DescriptorSetHandle handle) const
+{
+  const VkDescriptorSet* descriptorSet = m_meshDescriptorSets.Get(handle);
+  return descriptorSet ? *descriptorSet : VK_NULL_HANDLE;
+}
 
-  VkResult result = vkAllocateDescriptorSets(m_deviceManager->GetDevice(), &allocInfo, &descriptorSet);
-  if (result != VK_SUCCESS)
+bool DescriptorManager::UpdateMeshDescriptorSet(DescriptorSetHandle handle,
+                                                BufferHandle uniformRing,
+                                                VkDeviceSize sceneRange,
+                                                VkDeviceSize lightingRange)
+{
+  VkDescriptorSet descriptorSet = GetMeshDescriptorSet(handle);
+  if (descriptorSet == VK_NULL_HANDLE)
   {
-    RENDER_ERROR("Failed to allocate descriptor set for mesh '", meshName, "'");
+    RENDER_ERROR("Descriptor set handle ", handle.index, " not found");
     return false;
   }
 
-  m_meshDescriptorSets[meshName] = descriptorSet;
+  VkBuffer uniformBuffer = m_bufferManager->GetBuffer(uniformRing);
+  if (uniformBuffer == VK_NULL_HANDLE)
+    return false;
+
+  // Смещение 0: реальное положение данных кадра задают dynamic offsets при привязке
+  VkDescriptorBufferInfo sceneBufferInfo{};
+  sceneBufferInfo.buffer = uniformBuffer;
+  sceneBufferInfo.offset = 0;
+  sceneBufferInfo.range = sceneRange;
+
+  VkDescriptorBufferInfo lightingBufferInfo{};
+  lightingBufferInfo.buffer = uniformBuffer;
+  lightingBufferInfo.offset = 0;
+  lightingBufferInfo.range = lightingRange;
+
+  std::array<VkWriteDescriptorSet, 2> descriptorWrites{};
+
+  descriptorWrites[0].sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+  descriptorWrites[0].dstSet = descriptorSet;
+  descriptorWrites[0].dstBinding = 0;
+  descriptorWrites[0].dstArrayElement = 0;
+  descriptorWrites[0].descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC;
+  descriptorWrites[0].descriptorCount = 1;
+  descriptorWrites[0].pBufferInfo = &sceneBufferInfo;
+
+  descriptorWrites[1].sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+  descriptorWrites[1].dstSet = descriptorSet;
+  descriptorWrites[1].dstBinding = 2;
+  descriptorWrites[1].dstArrayElement = 0;
+  descriptorWrites[1].descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC;
+  descriptorWrites[1].descriptorCount = 1;
+  descriptorWrites[1].pBufferInfo = &lightingBufferInfo;
+
+  vkUpdateDescriptorSets(m_deviceManager->GetDevice(),
+                         static_cast<uint32_t>(descriptorWrites.size()),
+                         descriptorWrites.data(), 0, nullptr);
 
   return true;
 }
 
-VkDescriptorSet DescriptorManager::GetMeshDescriptorSet(const std::string& meshName) const
+bool DescriptorManager::InitializeBindless(uint32_t capacity)
 {
-  auto it = m_meshDescriptorSets.find(meshName);
-  return it != m_meshDescriptorSets.end() ? it->second : VK_NULL_HANDLE;
-}
+  if (!m_deviceManager->SupportsBindless())
+  {
+    return false;
+  }
 
-bool DescriptorManager::UpdateMeshDescriptorSet(const std::string& meshName,
-                                                const std::string& sceneUBOName,
-                                                const std::string& modelUBOName,
-                                                const std::string& lightingUBOName)
-{
-  auto it = m_meshDescriptorSets.find(meshName);
-  if (it == m_meshDescriptorSets.end())
+  VkDevice device = m_deviceManager->GetDevice();
+
+  VkDescriptorSetLayoutBinding binding{};
+  binding.binding = 0;
+  binding.descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+  binding.descriptorCount = capacity;
+  binding.stageFlags = VK_SHADER_STAGE_VERTEX_BIT;
+
+  // Незаполненные слоты допустимы, а слот свободного кадра можно переписать, пока set привязан
+  VkDescriptorBindingFlags bindingFlags = VK_DESCRIPTOR_BINDING_PARTIALLY_BOUND_BIT | VK_DESCRIPTOR_BINDING_UPDATE_AFTER_BIND_BIT;
+  VkDescriptorSetLayoutBindingFlagsCreateInfo bindingFlagsInfo{};
+  bindingFlagsInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_BINDING_FLAGS_CREATE_INFO;
+  bindingFlagsInfo.bindingCount = 1;
+  bindingFlagsInfo.pBindingFlags = &bindingFlags;
+
+  VkDescriptorSetLayoutCreateInfo layoutInfo{};
+  layoutInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
+  layoutInfo.pNext = &bindingFlagsInfo;
+  layoutInfo.flags = VK_DESCRIPTOR_SET_LAYOUT_CREATE_UPDATE_AFTER_BIND_POOL_BIT;
+  layoutInfo.bindingCount = 1;
+  layoutInfo.pBindings = &binding;
+
+  if (vkCreateDescriptorSetLayout(device, &layoutInfo, nullptr, &m_bindlessLayout) != VK_SUCCESS)
   {
-    RENDER_ERROR("Descriptor set for mesh '", meshName, "' not found");
+    RENDER_ERROR("Failed to create bindless descriptor set layout");
     return false;
   }
 
-  std::vector<VkWriteDescriptorSet> descriptorWrites;
+  VkDescriptorPoolSize poolSize{VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, capacity};
+  VkDescriptorPoolCreateInfo poolInfo{};
+  poolInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
+  poolInfo.flags = VK_DESCRIPTOR_POOL_CREATE_UPDATE_AFTER_BIND_BIT;
+  poolInfo.poolSizeCount = 1;
+  poolInfo.pPoolSizes = &poolSize;
+  poolInfo.maxSets = 1;
 
-  VkBuffer sceneBuffer = m_bufferManager->GetBuffer(sceneUBOName);
-  VkDeviceSize sceneBufferSize = m_bufferManager->GetBufferSize(sceneUBOName);
-  if (sceneBuffer == VK_NULL_HANDLE)
+  if (vkCreateDescriptorPool(device, &poolInfo, nullptr, &m_bindlessPool) != VK_SUCCESS)
+  {
+    RENDER_ERROR("Failed to create bindless descriptor pool");
+    ShutdownBindless();
     return false;
+  }
 
-  VkDescriptorBufferInfo sceneBufferInfo{};
-  sceneBufferInfo.buffer = sceneBuffer;
-  sceneBufferInfo.offset = 0;
-  sceneBufferInfo.range = sceneBufferSize;
-
-  VkWriteDescriptorSet sceneWrite{};
-  sceneWrite.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
-  sceneWrite.dstSet = it->second;
-  sceneWrite.dstBinding = 0;
-  sceneWrite.dstArrayElement = 0;
-  sceneWrite.descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
-  sceneWrite.descriptorCount = 1;
-  sceneWrite.pBufferInfo = &sceneBufferInfo;
-  descriptorWrites.push_back(sceneWrite);
-
-  VkBuffer modelBuffer = m_bufferManager->GetBuffer(modelUBOName);
-  VkDeviceSize modelBufferSize = m_bufferManager->GetBufferSize(modelUBOName);
-  if (modelBuffer == VK_NULL_HANDLE)
-    return false;
+  VkDescriptorSetAllocateInfo allocInfo{};
+  allocInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+  allocInfo.descriptorPool = m_bindlessPool;
+  allocInfo.descriptorSetCount = 1;
+  allocInfo.pSetLayouts = &m_bindlessLayout;
 
-  VkDescriptorBufferInfo modelBufferInfo{};
-  modelBufferInfo.buffer = modelBuffer;
-  modelBufferInfo.offset = 0;
-  modelBufferInfo.range = modelBufferSize;
-
-  VkWriteDescriptorSet modelWrite{};
-  modelWrite.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
-  modelWrite.dstSet = it->second;
-  modelWrite.dstBinding = 1;
-  modelWrite.dstArrayElement = 0;
-  modelWrite.descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
-  modelWrite.descriptorCount = 1;
-  modelWrite.pBufferInfo = &modelBufferInfo;
-  descriptorWrites.push_back(modelWrite);
-
-  VkBuffer lightingBuffer = m_bufferManager->GetBuffer(lightingUBOName);
-  VkDeviceSize lightingBufferSize = m_bufferManager->GetBufferSize(lightingUBOName);
-  if (lightingBuffer == VK_NULL_HANDLE)
+  if (vkAllocateDescriptorSets(device, &allocInfo, &m_bindlessSet) != VK_SUCCESS)
+  {
+    RENDER_ERROR("Failed to allocate bindless descriptor set");
+    m_bindlessSet = VK_NULL_HANDLE;
+    ShutdownBindless();
     return false;
+  }
 
-  VkDescriptorBufferInfo lightingBufferInfo{};
-  lightingBufferInfo.buffer = lightingBuffer;
-  lightingBufferInfo.offset = 0;
-  lightingBufferInfo.range = lightingBufferSize;
-
-  VkWriteDescriptorSet lightingWrite{};
-  lightingWrite.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
-  lightingWrite.dstSet = it->second;
-  lightingWrite.dstBinding = 2;
-  lightingWrite.dstArrayElement = 0;
-  lightingWrite.descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
-  lightingWrite.descriptorCount = 1;
-  lightingWrite.pBufferInfo = &lightingBufferInfo;
-  descriptorWrites.push_back(lightingWrite);
-
-  vkUpdateDescriptorSets(m_deviceManager->GetDevice(),
-                         static_cast<uint32_t>(descriptorWrites.size()),
-                         descriptorWrites.data(), 0, nullptr);
+  m_bindlessCapacity = capacity;
+  m_freeBindlessSlots.clear();
+  for (uint32_t slot = capacity; slot > 0; --slot)
+  {
+    m_freeBindlessSlots.push_back(slot - 1);
+  }
 
+  RENDER_DEBUG("Bindless descriptor set created: ", capacity, " storage buffer slots");
   return true;
 }
+
+void DescriptorManager::ShutdownBindless()
+{
+  VkDevice device = m_deviceManager->GetDevice();
+  if (m_bindlessPool != VK_NULL_HANDLE)
+  {
+    vkDestroyDescriptorPool(device, m_bindlessPool, nullptr);
+    m_bindlessPool = VK_NULL_HANDLE;
+  }
+  if (m_bindlessLayout != VK_NULL_HANDLE)
+  {
+    vkDestroyDescriptorSetLayout(device, m_bindlessLayout, nullptr);
+    m_bindlessLayout = VK_NULL_HANDLE;
+  }
+  m_bindlessSet = VK_NULL_HANDLE;
+  m_bindlessCapacity = 0;
+  m_freeBindlessSlots.clear();
+}
+
+uint32_t DescriptorManager::AllocateBindlessSlot()
+{
+  if (m_freeBindlessSlots.empty())
+  {
+    RENDER_ERROR("Bindless descriptor array is full (", m_bindlessCapacity, " slots)");
+    return INVALID_BINDLESS_SLOT;
+  }
+
+  const uint32_t slot = m_freeBindlessSlots.back();
+  m_freeBindlessSlots.pop_back();
+  return slot;
+}
+
+void DescriptorManager::ReleaseBindlessSlot(uint32_t slot)
+{
+  if (slot < m_bindlessCapacity)
+  {
+    m_freeBindlessSlots.push_back(slot);
+  }
+}
+
+void DescriptorManager::WriteBindlessBuffer(uint32_t slot, VkBuffer buffer, VkDeviceSize range)
+{
+  if (slot >= m_bindlessCapacity || buffer == VK_NULL_HANDLE)
+  {
+    return;
+  }
+
+  VkDescriptorBufferInfo bufferInfo{};
+  bufferInfo.buffer = buffer;
+  bufferInfo.offset = 0;
+  bufferInfo.range = range;
+
+  VkWriteDescriptorSet write{};
+  write.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+  write.dstSet = m_bindlessSet;
+  write.dstBinding = 0;
+  write.dstArrayElement = slot;
+  write.descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+  write.descriptorCount = 1;
+  write.pBufferInfo = &bufferInfo;
+
+  vkUpdateDescriptorSets(m_deviceManager->GetDevice(), 1, &write, 0, nullptr);
+}
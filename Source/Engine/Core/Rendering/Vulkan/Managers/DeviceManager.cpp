@@ -22,8 +22,10 @@ const char* VkPhysicalDeviceTypeString(VkPhysicalDeviceType type)
   }
 }
 
-bool DeviceManager::Initialize(VkInstance instance, VkSurfaceKHR surface)
+bool DeviceManager::Initialize(VkInstance instance, VkSurfaceKHR surface, uint32_t apiVersion)
 {
+  m_apiVersion = apiVersion;
+
   if (!PickPhysicalDevice(instance, surface))
   {
     RENDER_ERROR("Failed to pick physical device");
@@ -92,6 +94,19 @@ QueueFamilyIndices DeviceManager::FindQueueFamilies(VkPhysicalDevice device, VkS
     }
   }
 
+  // Семейство только с копированием - отдельный DMA движок, загрузки не конкурируют с рендером
+  indices.transferFamily = indices.graphicsFamily;
+  for (uint32_t i = 0; i < queueFamilyCount; i++)
+  {
+    const VkQueueFlags flags = queueFamilies[i].queueFlags;
+    if ((flags & VK_QUEUE_TRANSFER_BIT) && !(flags & (VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT)))
+    {
+      indices.transferFamily = i;
+      break;
+    }
+  }
+  m_queueIndices.transferFamily = indices.transferFamily;
+
   return indices;
 }
 
@@ -123,9 +138,8 @@ bool DeviceManager::PickPhysicalDevice(VkInstance instance, VkSurfaceKHR surface
   {
     m_physicalDevice = candidates.rbegin()->second;
 
-    VkPhysicalDeviceProperties deviceProperties;
-    vkGetPhysicalDeviceProperties(m_physicalDevice, &deviceProperties);
-    RENDER_DEBUG("Selected physical device: ", deviceProperties.deviceName,
+    vkGetPhysicalDeviceProperties(m_physicalDevice, &m_properties);
+    RENDER_DEBUG("Selected physical device: ", m_properties.deviceName,
                  " (Score: ", candidates.rbegin()->first, ")");
     return true;
   }
@@ -146,7 +160,7 @@ bool DeviceManager::CreateLogicalDevice(VkSurfaceKHR surface)
 
   // Create one queue for each family
   std::vector<VkDeviceQueueCreateInfo> queueCreateInfos;
-  std::set<uint32_t> uniqueQueueFamilies = {indices.graphicsFamily, indices.presentFamily};
+  std::set<uint32_t> uniqueQueueFamilies = {indices.graphicsFamily, indices.presentFamily, indices.transferFamily};
 
   float queuePriority = 1.0f;
   for (uint32_t queueFamily : uniqueQueueFamilies)
@@ -162,8 +176,21 @@ bool DeviceManager::CreateLogicalDevice(VkSurfaceKHR surface)
   VkPhysicalDeviceFeatures deviceFeatures{};
   deviceFeatures.samplerAnisotropy = VK_TRUE;
 
+  // Только то, что нужно bindless пути: массив instance буферов, индексируемый push constant
+  VkPhysicalDeviceDescriptorIndexingFeatures indexingFeatures{};
+  indexingFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_FEATURES;
+  m_bindlessSupported = QueryBindlessSupport(m_physicalDevice);
+  if (m_bindlessSupported)
+  {
+    deviceFeatures.shaderStorageBufferArrayDynamicIndexing = VK_TRUE;
+    indexingFeatures.runtimeDescriptorArray = VK_TRUE;
+    indexingFeatures.descriptorBindingPartiallyBound = VK_TRUE;
+    indexingFeatures.descriptorBindingStorageBufferUpdateAfterBind = VK_TRUE;
+  }
+
   VkDeviceCreateInfo createInfo{};
   createInfo.sType = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO;
+  createInfo.pNext = m_bindlessSupported ? &indexingFeatures : nullptr;
   createInfo.queueCreateInfoCount = static_cast<uint32_t>(queueCreateInfos.size());
   createInfo.pQueueCreateInfos = queueCreateInfos.data();
   createInfo.pEnabledFeatures = &deviceFeatures;
@@ -186,10 +213,13 @@ bool DeviceManager::CreateLogicalDevice(VkSurfaceKHR surface)
   // Retrieve queue handles
   vkGetDeviceQueue(m_device, indices.graphicsFamily, 0, &m_graphicsQueue);
   vkGetDeviceQueue(m_device, indices.presentFamily, 0, &m_presentQueue);
+  vkGetDeviceQueue(m_device, indices.transferFamily, 0, &m_transferQueue);
 
   RENDER_DEBUG("Logical device created successfully");
   RENDER_DEBUG("Graphics queue family: ", indices.graphicsFamily);
   RENDER_DEBUG("Present queue family: ", indices.presentFamily);
+  RENDER_DEBUG("Transfer queue family: ", indices.transferFamily);
+  RENDER_DEBUG("Descriptor indexing: ", m_bindlessSupported ? "supported" : "not supported");
 
   return true;
 }
@@ -274,3 +304,27 @@ bool DeviceManager::CheckDeviceExtensionSupport(VkPhysicalDevice device)
 
   return requiredExtensions.empty();
 }
+
+bool DeviceManager::QueryBindlessSupport(VkPhysicalDevice device) const
+{
+  // Структура фич descriptor indexing входит в ядро 1.2; ниже пришлось бы тянуть расширения instance
+  VkPhysicalDeviceProperties properties;
+  vkGetPhysicalDeviceProperties(device, &properties);
+  if (m_apiVersion < VK_API_VERSION_1_2 || properties.apiVersion < VK_API_VERSION_1_2)
+  {
+    return false;
+  }
+
+  VkPhysicalDeviceDescriptorIndexingFeatures indexingFeatures{};
+  indexingFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_FEATURES;
+
+  VkPhysicalDeviceFeatures2 features{};
+  features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2;
+  features.pNext = &indexingFeatures;
+  vkGetPhysicalDeviceFeatures2(device, &features);
+
+  return features.features.shaderStorageBufferArrayDynamicIndexing &&
+         indexingFeatures.runtimeDescriptorArray &&
+         indexingFeatures.descriptorBindingPartiallyBound &&
+         indexingFeatures.descriptorBindingStorageBufferUpdateAfterBind;
+}
@@ -0,0 +1,211 @@
+#include "Engine/Core/Rendering/Vulkan/Managers/GpuProfiler.h"
+
+#include <cmath>
+
+  GpuProfiler::GpuProfiler(std::shared_ptr<DeviceManager> deviceManager, std::shared_ptr<CommandBufferManager> commandBufferManager)
+      : m_deviceManager(deviceManager), m_commandBufferManager(commandBufferManager)
+  {
+  }
+
+  GpuProfiler::~GpuProfiler()
+  {
+    Shutdown();
+  }
+
+  bool GpuProfiler::Initialize(uint32_t frameCount)
+  {
+    RENDER_DEBUG("Initializing GpuProfiler...");
+
+    uint32_t familyCount = 0;
+    vkGetPhysicalDeviceQueueFamilyProperties(m_deviceManager->GetPhysicalDevice(), &familyCount, nullptr);
+    std::vector<VkQueueFamilyProperties> families(familyCount);
+    vkGetPhysicalDeviceQueueFamilyProperties(m_deviceManager->GetPhysicalDevice(), &familyCount, families.data());
+
+    const uint32_t graphicsFamily = m_deviceManager->getIndices().graphicsFamily;
+    const uint32_t validBits = graphicsFamily < familyCount ? families[graphicsFamily].timestampValidBits : 0;
+    if (validBits == 0)
+    {
+      RENDER_WARN("Graphics queue does not support timestamps, GPU profiling is disabled");
+      return false;
+    }
+    m_timestampMask = validBits >= 64 ? ~0ull : (1ull << validBits) - 1;
+    m_timestampPeriod = m_deviceManager->GetProperties().limits.timestampPeriod;
+
+    VkQueryPoolCreateInfo poolInfo{};
+    poolInfo.sType = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO;
+    poolInfo.queryType = VK_QUERY_TYPE_TIMESTAMP;
+    poolInfo.queryCount = frameCount * MAX_SCOPES_PER_FRAME * 2;
+
+    VkResult result = vkCreateQueryPool(m_deviceManager->GetDevice(), &poolInfo, nullptr, &m_queryPool);
+    VK_CHECK(result, "Failed to create timestamp query pool");
+
+    m_frames.resize(frameCount);
+    for (auto& frame : m_frames)
+    {
+      frame.scopes.reserve(MAX_SCOPES_PER_FRAME);
+    }
+    m_results.resize(MAX_SCOPES_PER_FRAME * 2);
+
+    Calibrate();
+    m_track = CProfiler::Get().CreateTrack("GPU");
+
+    RENDER_DEBUG("GpuProfiler initialized: ", validBits, " valid timestamp bits, ", m_timestampPeriod, " ns per tick");
+    return true;
+  }
+
+  void GpuProfiler::Shutdown()
+  {
+    if (m_queryPool == VK_NULL_HANDLE)
+    {
+      return;
+    }
+
+    vkDestroyQueryPool(m_deviceManager->GetDevice(), m_queryPool, nullptr);
+    m_queryPool = VK_NULL_HANDLE;
+    m_frames.clear();
+    m_recording = false;
+
+    RENDER_DEBUG("GpuProfiler shutdown complete");
+  }
+
+  void GpuProfiler::BeginFrame(uint32_t frameIndex)
+  {
+    m_currentFrame = frameIndex;
+    FrameQueries& frame = m_frames[frameIndex];
+    if (frame.pending)
+    {
+      ReadResults(frameIndex);
+    }
+
+    frame.scopes.clear();
+    m_depth = 0;
+    m_recording = CProfiler::IsEnabled();
+  }
+
+  void GpuProfiler::ResetQueries(VkCommandBuffer commandBuffer)
+  {
+    if (!m_recording)
+    {
+      return;
+    }
+
+    vkCmdResetQueryPool(commandBuffer, m_queryPool, m_currentFrame * MAX_SCOPES_PER_FRAME * 2, MAX_SCOPES_PER_FRAME * 2);
+    m_frames[m_currentFrame].pending = true;
+  }
+
+  uint32_t GpuProfiler::BeginScope(VkCommandBuffer commandBuffer, const char* name)
+  {
+    FrameQueries& frame = m_frames[m_currentFrame];
+    if (!m_recording || frame.scopes.size() >= MAX_SCOPES_PER_FRAME)
+    {
+      return UINT32_MAX;
+    }
+
+    const uint32_t scope = static_cast<uint32_t>(frame.scopes.size());
+    frame.scopes.push_back(ScopeInfo{name, m_depth++});
+    vkCmdWriteTimestamp(commandBuffer, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, m_queryPool,
+                        (m_currentFrame * MAX_SCOPES_PER_FRAME + scope) * 2);
+    return scope;
+  }
+
+  void GpuProfiler::EndScope(VkCommandBuffer commandBuffer, uint32_t scope)
+  {
+    if (scope == UINT32_MAX)
+    {
+      return;
+    }
+
+    --m_depth;
+    // Конец интервала - когда все предыдущие команды прошли весь конвейер
+    vkCmdWriteTimestamp(commandBuffer, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, m_queryPool,
+                        (m_currentFrame * MAX_SCOPES_PER_FRAME + scope) * 2 + 1);
+  }
+
+  void GpuProfiler::MarkSubmit()
+  {
+    if (m_recording)
+    {
+      m_frames[m_currentFrame].submitNs = CProfiler::Now();
+    }
+  }
+
+  void GpuProfiler::Calibrate()
+  {
+    // Один timestamp с ожиданием: время GPU сопоставляется середине интервала submit - завершение.
+    // Погрешность - задержка отправки; остаток поправляет MarkSubmit
+    VkCommandBuffer commandBuffer = m_commandBufferManager->BeginSingleTimeCommands();
+    vkCmdResetQueryPool(commandBuffer, m_queryPool, 0, 1);
+    vkCmdWriteTimestamp(commandBuffer, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, m_queryPool, 0);
+
+    const uint64_t submitNs = CProfiler::Now();
+    m_commandBufferManager->EndSingleTimeCommands(commandBuffer);
+    const uint64_t completeNs = CProfiler::Now();
+
+    uint64_t ticks = 0;
+    VkResult result = vkGetQueryPoolResults(m_deviceManager->GetDevice(), m_queryPool, 0, 1, sizeof(ticks), &ticks,
+                                            sizeof(ticks), VK_QUERY_RESULT_64_BIT | VK_QUERY_RESULT_WAIT_BIT);
+    VK_CHECK(result, "Failed to read calibration timestamp");
+
+    m_baseTicks = ticks & m_timestampMask;
+    m_offsetNs = static_cast<int64_t>(submitNs + (completeNs - submitNs) / 2);
+  }
+
+  void GpuProfiler::ReadResults(uint32_t frameIndex)
+  {
+    FrameQueries& frame = m_frames[frameIndex];
+    frame.pending = false;
+
+    const uint32_t queryCount = static_cast<uint32_t>(frame.scopes.size()) * 2;
+    if (queryCount == 0)
+    {
+      return;
+    }
+
+    // Фенс кадра уже пройден, поэтому без VK_QUERY_RESULT_WAIT_BIT; VK_NOT_READY - кадр не дошел до GPU
+    VkResult result = vkGetQueryPoolResults(m_deviceManager->GetDevice(), m_queryPool,
+                                            frameIndex * MAX_SCOPES_PER_FRAME * 2, queryCount,
+                                            sizeof(uint64_t) * queryCount, m_results.data(), sizeof(uint64_t),
+                                            VK_QUERY_RESULT_64_BIT);
+    if (result != VK_SUCCESS)
+    {
+      return;
+    }
+
+    // GPU не мог начать кадр раньше его отправки: если шкалы разошлись, сдвигаем GPU вперед
+    const uint64_t frameBeginNs = ToProfilerNs(m_results[0]);
+    if (frame.submitNs > frameBeginNs)
+    {
+      m_offsetNs += static_cast<int64_t>(frame.submitNs - frameBeginNs);
+    }
+
+    const bool bRecord = CProfiler::IsEnabled();
+    double frameMs = 0.0;
+    for (uint32_t i = 0; i < frame.scopes.size(); ++i)
+    {
+      const uint64_t begin = m_results[i * 2] & m_timestampMask;
+      const uint64_t end = m_results[i * 2 + 1] & m_timestampMask;
+      // Счетчик с неполной разрядностью переполнился внутри интервала
+      if (end < begin)
+        continue;
+
+      const uint64_t beginNs = ToProfilerNs(begin);
+      const uint64_t endNs = ToProfilerNs(end);
+      if (frame.scopes[i].depth == 0)
+      {
+        frameMs += static_cast<double>(endNs - beginNs) / 1000000.0;
+      }
+      if (bRecord)
+      {
+        CProfiler::Get().RecordOnTrack(m_track, frame.scopes[i].name, beginNs, endNs, frame.scopes[i].depth);
+      }
+    }
+    m_lastFrameMs = frameMs;
+  }
+
+  uint64_t GpuProfiler::ToProfilerNs(uint64_t ticks) const
+  {
+    // Считаем от тика калибровки: абсолютные значения счетчика теряют точность в double
+    const int64_t deltaTicks = static_cast<int64_t>((ticks & m_timestampMask) - m_baseTicks);
+    const int64_t ns = std::llround(static_cast<double>(deltaTicks) * m_timestampPeriod) + m_offsetNs;
+    return ns > 0 ? static_cast<uint64_t>(ns) : 0;
+  }
@@ -0,0 +1,354 @@
+#include "Engine/Core/Rendering/Vulkan/Managers/MemoryAllocator.h"
+
+#include <algorithm>
+
+namespace
+{
+  VkDeviceSize AlignUp(VkDeviceSize value, VkDeviceSize alignment)
+  {
+    return alignment > 1 ? (value + alignment - 1) / alignment * alignment : value;
+  }
+}  // namespace
+
+  MemoryAllocator::MemoryAllocator(std::shared_ptr<DeviceManager> deviceManager)
+      : m_deviceManager(deviceManager)
+  {
+  }
+
+  MemoryAllocator::~MemoryAllocator()
+  {
+    Shutdown();
+  }
+
+  bool MemoryAllocator::Initialize()
+  {
+    vkGetPhysicalDeviceMemoryProperties(m_deviceManager->GetPhysicalDevice(), &m_memoryProperties);
+    m_pools.resize(m_memoryProperties.memoryTypeCount);
+
+    RENDER_DEBUG("MemoryAllocator initialized: ", m_memoryProperties.memoryTypeCount, " memory types");
+    return true;
+  }
+
+  void MemoryAllocator::Shutdown()
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    for (auto& pool : m_pools)
+    {
+      for (auto& block : pool)
+      {
+        if (block->allocationCount > 0)
+        {
+          RENDER_WARN("Memory block destroyed with ", block->allocationCount, " live allocations");
+        }
+        DestroyBlock(block.get());
+      }
+      pool.clear();
+    }
+
+    if (m_totalBlockAllocations > 0)
+    {
+      RENDER_DEBUG("MemoryAllocator shutdown: ", m_totalAllocations, " allocations served by ",
+                   m_totalBlockAllocations, " device allocations");
+    }
+    m_totalBlockAllocations = 0;
+    m_totalAllocations = 0;
+  }
+
+  bool MemoryAllocator::Allocate(const VkMemoryRequirements& requirements, VkMemoryPropertyFlags properties,
+                                 AllocationStrategy strategy, MemoryAllocation& outAllocation)
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    const uint32_t memoryTypeIndex = FindMemoryType(requirements.memoryTypeBits, properties);
+    if (memoryTypeIndex == UINT32_MAX)
+    {
+      RENDER_ERROR("Failed to find suitable memory type");
+      return false;
+    }
+
+    auto& pool = m_pools[memoryTypeIndex];
+    const VkDeviceSize blockSize = GetBlockSize(memoryTypeIndex);
+
+    MemoryBlock* target = nullptr;
+    VkDeviceSize offset = 0;
+    bool allocated = false;
+
+    // Крупные ресурсы получают собственный блок, чтобы не дробить общие
+    const bool dedicated = requirements.size > blockSize / 2;
+    if (!dedicated)
+    {
+      for (auto& block : pool)
+      {
+        if (!block->dedicated && block->strategy == strategy &&
+            AllocateFromBlock(*block, requirements.size, requirements.alignment, offset))
+        {
+          target = block.get();
+          allocated = true;
+          break;
+        }
+      }
+    }
+
+    if (!allocated)
+    {
+      target = CreateBlock(memoryTypeIndex, dedicated ? requirements.size : blockSize,
+                           dedicated ? AllocationStrategy::FREE_LIST : strategy, dedicated);
+      allocated = target && AllocateFromBlock(*target, requirements.size, requirements.alignment, offset);
+    }
+
+    if (!allocated)
+    {
+      if (target)
+      {
+        DestroyBlock(target);
+        pool.pop_back();
+      }
+      RENDER_ERROR("Failed to allocate ", requirements.size, " bytes of device memory");
+      return false;
+    }
+
+    ++target->allocationCount;
+    ++m_totalAllocations;
+
+    outAllocation.memory = target->memory;
+    outAllocation.offset = offset;
+    outAllocation.size = requirements.size;
+    outAllocation.mappedData = target->mappedData ? static_cast<uint8_t*>(target->mappedData) + offset : nullptr;
+    outAllocation.block = target;
+    return true;
+  }
+
+  void MemoryAllocator::Free(MemoryAllocation& allocation)
+  {
+    if (!allocation.IsValid())
+    {
+      return;
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    MemoryBlock* block = allocation.block;
+    FreeFromBlock(*block, allocation.offset, allocation.size);
+    --block->allocationCount;
+
+    if (block->dedicated && block->allocationCount == 0)
+    {
+      auto& pool = m_pools[block->memoryTypeIndex];
+      DestroyBlock(block);
+      pool.erase(std::find_if(pool.begin(), pool.end(),
+                              [block](const std::unique_ptr<MemoryBlock>& entry) { return entry.get() == block; }));
+    }
+
+    allocation = MemoryAllocation{};
+  }
+
+  MemoryAllocatorStats MemoryAllocator::GetStats() const
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    MemoryAllocatorStats stats;
+    for (const auto& pool : m_pools)
+    {
+      for (const auto& block : pool)
+      {
+        ++stats.blockCount;
+        stats.dedicatedBlockCount += block->dedicated ? 1 : 0;
+        stats.allocationCount += block->allocationCount;
+        stats.reservedBytes += block->size;
+        stats.usedBytes += block->usedBytes;
+      }
+    }
+    stats.totalBlockAllocations = m_totalBlockAllocations;
+    stats.totalAllocations = m_totalAllocations;
+    return stats;
+  }
+
+  uint32_t MemoryAllocator::FindMemoryType(uint32_t typeFilter, VkMemoryPropertyFlags properties) const
+  {
+    for (uint32_t i = 0; i < m_memoryProperties.memoryTypeCount; i++)
+    {
+      if ((typeFilter & (1u << i)) &&
+          (m_memoryProperties.memoryTypes[i].propertyFlags & properties) == properties)
+      {
+        return i;
+      }
+    }
+    return UINT32_MAX;
+  }
+
+  VkDeviceSize MemoryAllocator::GetBlockSize(uint32_t memoryTypeIndex) const
+  {
+    const VkMemoryType& memoryType = m_memoryProperties.memoryTypes[memoryTypeIndex];
+    const VkDeviceSize heapSize = m_memoryProperties.memoryHeaps[memoryType.heapIndex].size;
+
+    VkDeviceSize blockSize = (memoryType.propertyFlags & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT)
+                                 ? HOST_VISIBLE_BLOCK_SIZE
+                                 : DEVICE_LOCAL_BLOCK_SIZE;
+
+    // На маленьких кучах (интегрированные GPU, BAR 256 МБ) один блок не должен съедать заметную долю
+    if (heapSize > 0)
+    {
+      blockSize = std::min(blockSize, heapSize / 8);
+    }
+    return blockSize;
+  }
+
+  MemoryBlock* MemoryAllocator::CreateBlock(uint32_t memoryTypeIndex, VkDeviceSize size, AllocationStrategy strategy, bool dedicated)
+  {
+    VkMemoryAllocateInfo allocInfo{};
+    allocInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+    allocInfo.allocationSize = size;
+    allocInfo.memoryTypeIndex = memoryTypeIndex;
+
+    VkDeviceMemory memory = VK_NULL_HANDLE;
+    VkResult result = vkAllocateMemory(m_deviceManager->GetDevice(), &allocInfo, nullptr, &memory);
+    if (result != VK_SUCCESS)
+    {
+      RENDER_ERROR("vkAllocateMemory failed for block of ", size, " bytes");
+      return nullptr;
+    }
+
+    auto block = std::make_unique<MemoryBlock>();
+    block->memory = memory;
+    block->size = size;
+    block->memoryTypeIndex = memoryTypeIndex;
+    block->strategy = strategy;
+    block->dedicated = dedicated;
+    block->freeRanges[0] = size;
+
+    if (m_memoryProperties.memoryTypes[memoryTypeIndex].propertyFlags & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT)
+    {
+      result = vkMapMemory(m_deviceManager->GetDevice(), memory, 0, VK_WHOLE_SIZE, 0, &block->mappedData);
+      if (result != VK_SUCCESS)
+      {
+        RENDER_ERROR("Failed to map memory block");
+        vkFreeMemory(m_deviceManager->GetDevice(), memory, nullptr);
+        return nullptr;
+      }
+    }
+
+    ++m_totalBlockAllocations;
+    RENDER_DEBUG("Allocated memory block: ", size, " bytes, type ", memoryTypeIndex, dedicated ? " (dedicated)" : "");
+
+    MemoryBlock* raw = block.get();
+    m_pools[memoryTypeIndex].push_back(std::move(block));
+    return raw;
+  }
+
+  void MemoryAllocator::DestroyBlock(MemoryBlock* block)
+  {
+    if (block->mappedData)
+    {
+      vkUnmapMemory(m_deviceManager->GetDevice(), block->memory);
+      block->mappedData = nullptr;
+    }
+    if (block->memory != VK_NULL_HANDLE)
+    {
+      vkFreeMemory(m_deviceManager->GetDevice(), block->memory, nullptr);
+      block->memory = VK_NULL_HANDLE;
+    }
+  }
+
+  bool MemoryAllocator::AllocateFromBlock(MemoryBlock& block, VkDeviceSize size, VkDeviceSize alignment, VkDeviceSize& outOffset)
+  {
+    if (block.strategy == AllocationStrategy::LINEAR)
+    {
+      const VkDeviceSize offset = AlignUp(block.linearOffset, alignment);
+      if (offset + size > block.size)
+      {
+        return false;
+      }
+      block.linearOffset = offset + size;
+      block.usedBytes += size;
+      outOffset = offset;
+      return true;
+    }
+
+    // Best-fit: диапазон с наименьшим остатком после выравнивания
+    auto best = block.freeRanges.end();
+    VkDeviceSize bestOffset = 0;
+    VkDeviceSize bestWaste = ~VkDeviceSize(0);
+    for (auto it = block.freeRanges.begin(); it != block.freeRanges.end(); ++it)
+    {
+      const VkDeviceSize offset = AlignUp(it->first, alignment);
+      const VkDeviceSize rangeEnd = it->first + it->second;
+      if (offset + size > rangeEnd)
+      {
+        continue;
+      }
+
+      const VkDeviceSize waste = it->second - size;
+      if (waste < bestWaste)
+      {
+        best = it;
+        bestOffset = offset;
+        bestWaste = waste;
+        if (waste == 0)
+        {
+          break;
+        }
+      }
+    }
+
+    if (best == block.freeRanges.end())
+    {
+      return false;
+    }
+
+    const VkDeviceSize rangeOffset = best->first;
+    const VkDeviceSize rangeEnd = best->first + best->second;
+    block.freeRanges.erase(best);
+
+    // Отступ на выравнивание и хвост остаются свободными
+    if (bestOffset > rangeOffset)
+    {
+      block.freeRanges[rangeOffset] = bestOffset - rangeOffset;
+    }
+    if (bestOffset + size < rangeEnd)
+    {
+      block.freeRanges[bestOffset + size] = rangeEnd - (bestOffset + size);
+    }
+
+    block.usedBytes += size;
+    outOffset = bestOffset;
+    return true;
+  }
+
+  void MemoryAllocator::FreeFromBlock(MemoryBlock& block, VkDeviceSize offset, VkDeviceSize size)
+  {
+    block.usedBytes -= size;
+
+    if (block.strategy == AllocationStrategy::LINEAR)
+    {
+      // Линейный блок переиспользуется целиком, когда из него освобождено все
+      if (block.allocationCount == 1)
+      {
+        block.linearOffset = 0;
+      }
+      return;
+    }
+
+    VkDeviceSize rangeOffset = offset;
+    VkDeviceSize rangeSize = size;
+
+    auto next = block.freeRanges.lower_bound(offset);
+    if (next != block.freeRanges.end() && offset + size == next->first)
+    {
+      rangeSize += next->second;
+      next = block.freeRanges.erase(next);
+    }
+
+    if (next != block.freeRanges.begin())
+    {
+      auto prev = std::prev(next);
+      if (prev->first + prev->second == offset)
+      {
+        rangeOffset = prev->first;
+        rangeSize += prev->second;
+        block.freeRanges.erase(prev);
+      }
+    }
+
+    block.freeRanges[rangeOffset] = rangeSize;
+  }
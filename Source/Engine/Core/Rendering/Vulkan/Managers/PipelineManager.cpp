@@ -48,6 +48,44 @@
   }
 
   VkPipeline PipelineManager::CreateMeshPipeline(const std::string& name, VkRenderPass renderPass)
+  {
+    return CreateMeshPipeline(name, renderPass, VERTEX_SHADER_PATH, m_pipelineLayout, true);
+  }
+
+  VkPipeline PipelineManager::CreateBindlessMeshPipeline(const std::string& name, VkRenderPass renderPass,
+                                                         VkDescriptorSetLayout bindlessLayout)
+  {
+    if (m_bindlessPipelineLayout == VK_NULL_HANDLE)
+    {
+      // Set 0 - общие scene/lighting, set 1 - глобальный массив instance буферов
+      std::array<VkDescriptorSetLayout, 2> setLayouts = {m_descriptorSetLayout, bindlessLayout};
+
+      VkPushConstantRange pushConstantRange{};
+      pushConstantRange.stageFlags = VK_SHADER_STAGE_VERTEX_BIT;
+      pushConstantRange.offset = 0;
+      pushConstantRange.size = sizeof(BindlessDrawConstants);
+
+      VkPipelineLayoutCreateInfo pipelineLayoutInfo{};
+      pipelineLayoutInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
+      pipelineLayoutInfo.setLayoutCount = static_cast<uint32_t>(setLayouts.size());
+      pipelineLayoutInfo.pSetLayouts = setLayouts.data();
+      pipelineLayoutInfo.pushConstantRangeCount = 1;
+      pipelineLayoutInfo.pPushConstantRanges = &pushConstantRange;
+
+      if (vkCreatePipelineLayout(m_deviceManager->GetDevice(), &pipelineLayoutInfo, nullptr, &m_bindlessPipelineLayout) != VK_SUCCESS)
+      {
+        RENDER_ERROR("Failed to create bindless pipeline layout");
+        return VK_NULL_HANDLE;
+      }
+    }
+
+    // Данные экземпляров читаются из storage буфера, vertex input только для вершин меша
+    return CreateMeshPipeline(name, renderPass, BINDLESS_VERTEX_SHADER_PATH, m_bindlessPipelineLayout, false);
+  }
+
+  VkPipeline PipelineManager::CreateMeshPipeline(const std::string& name, VkRenderPass renderPass,
+                                                 const char* vertexShaderPath, VkPipelineLayout layout,
+                                                 bool instanceVertexInput)
   {
     auto it = m_pipelines.find(name);
     if (it != m_pipelines.end())
@@ -60,7 +98,7 @@
 
     try
     {
-      auto vertShaderCode = ReadShaderFile(VERTEX_SHADER_PATH);
+      auto vertShaderCode = ReadShaderFile(vertexShaderPath);
       auto fragShaderCode = ReadShaderFile(FRAGMENT_SHADER_PATH);
 
       VkShaderModule vertShaderModule = CreateShaderModule(vertShaderCode);
@@ -87,7 +125,7 @@
 
       // СПЕЦИФИЧНЫЕ НАСТРОЙКИ ДЛЯ MESH PIPELINE
       configInfo.renderPass = renderPass;
-      configInfo.pipelineLayout = m_pipelineLayout;
+      configInfo.pipelineLayout = layout;
 
       // ВКЛЮЧАЕМ ТЕСТ ГЛУБИНЫ
       configInfo.depthStencilInfo.depthTestEnable = VK_TRUE;
@@ -100,7 +138,7 @@
       // ВЫКЛЮЧАЕМ BIAS ГЛУБИНЫ ДЛЯ ГЛАДКИХ ПОВЕРХНОСТЕЙ
       configInfo.rasterizationInfo.depthBiasEnable = VK_FALSE;
 
-      VkPipeline pipeline = CreateGraphicsPipeline(configInfo, shaderStages);
+      VkPipeline pipeline = CreateGraphicsPipeline(configInfo, shaderStages, instanceVertexInput);
 
       vkDestroyShaderModule(m_deviceManager->GetDevice(), vertShaderModule, nullptr);
       vkDestroyShaderModule(m_deviceManager->GetDevice(), fragShaderModule, nullptr);
@@ -129,26 +167,21 @@
 
   bool PipelineManager::CreatePipelineLayout()
   {
-    std::array<VkDescriptorSetLayoutBinding, 3> bindings{};
+    // Binding 1 (ModelUBO) больше не используется: модель и цвет приходят из instance буфера
+    std::array<VkDescriptorSetLayoutBinding, 2> bindings{};
 
     bindings[0].binding = 0;
-    bindings[0].descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+    bindings[0].descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC;
     bindings[0].descriptorCount = 1;
     bindings[0].stageFlags = VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT;
     bindings[0].pImmutableSamplers = nullptr;
 
-    bindings[1].binding = 1;
-    bindings[1].descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+    bindings[1].binding = 2;
+    bindings[1].descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC;
     bindings[1].descriptorCount = 1;
-    bindings[1].stageFlags = VK_SHADER_STAGE_VERTEX_BIT;
+    bindings[1].stageFlags = VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT;
     bindings[1].pImmutableSamplers = nullptr;
 
-    bindings[2].binding = 2;
-    bindings[2].descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
-    bindings[2].descriptorCount = 1;
-    bindings[2].stageFlags = VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT;
-    bindings[2].pImmutableSamplers = nullptr;
-
     VkDescriptorSetLayoutCreateInfo layoutInfo{};
     layoutInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
     layoutInfo.bindingCount = static_cast<uint32_t>(bindings.size());
@@ -183,6 +216,12 @@
   {
     VkDevice device = m_deviceManager->GetDevice();
 
+    if (m_bindlessPipelineLayout != VK_NULL_HANDLE)
+    {
+      vkDestroyPipelineLayout(device, m_bindlessPipelineLayout, nullptr);
+      m_bindlessPipelineLayout = VK_NULL_HANDLE;
+    }
+
     if (m_pipelineLayout != VK_NULL_HANDLE)
     {
       vkDestroyPipelineLayout(device, m_pipelineLayout, nullptr);
@@ -200,15 +239,27 @@
 
   VkPipeline PipelineManager::CreateGraphicsPipeline(
       const PipelineConfigInfo& configInfo,
-      const std::vector<VkPipelineShaderStageCreateInfo>& shaderStages)
+      const std::vector<VkPipelineShaderStageCreateInfo>& shaderStages,
+      bool instanceVertexInput)
   {
-    auto bindingDescription = Vertex::GetBindingDescription();
-    auto attributeDescriptions = Vertex::GetAttributeDescriptions();
+    // Binding 0 - вершины меша, binding 1 - данные экземпляров (если они идут через vertex input)
+    std::vector<VkVertexInputBindingDescription> bindingDescriptions = {Vertex::GetBindingDescription()};
+
+    std::vector<VkVertexInputAttributeDescription> attributeDescriptions;
+    for (const auto& attribute : Vertex::GetAttributeDescriptions())
+      attributeDescriptions.push_back(attribute);
+
+    if (instanceVertexInput)
+    {
+      bindingDescriptions.push_back(FInstanceData::GetBindingDescription());
+      for (const auto& attribute : FInstanceData::GetAttributeDescriptions())
+        attributeDescriptions.push_back(attribute);
+    }
 
     VkPipelineVertexInputStateCreateInfo vertexInputInfo{};
     vertexInputInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO;
-    vertexInputInfo.vertexBindingDescriptionCount = 1;
-    vertexInputInfo.pVertexBindingDescriptions = &bindingDescription;
+    vertexInputInfo.vertexBindingDescriptionCount = static_cast<uint32_t>(bindingDescriptions.size());
+    vertexInputInfo.pVertexBindingDescriptions = bindingDescriptions.data();
     vertexInputInfo.vertexAttributeDescriptionCount = static_cast<uint32_t>(attributeDescriptions.size());
     vertexInputInfo.pVertexAttributeDescriptions = attributeDescriptions.data();
 
@@ -1,20 +1,12 @@
 #include "Engine/Core/Rendering/Vulkan/Managers/SwapchainManager.h"
 
-#include <SDL3/SDL.h>
 #include <algorithm>
 #include <stdexcept>
 
 #include "Engine/Utils/Logger.h"
 
-
-#include <SDL3/SDL.h>
-#include <algorithm>
-#include <stdexcept>
-
-#include "Engine/Utils/Logger.h"
-
-  SwapchainManager::SwapchainManager(VkInstance instance, VkSurfaceKHR surface, std::shared_ptr<DeviceManager> deviceManager, SDL_Window* window)
-      : m_instance(instance), m_surface(surface), m_deviceManager(deviceManager), m_window(window)
+  SwapchainManager::SwapchainManager(VkInstance instance, VkSurfaceKHR surface, std::shared_ptr<DeviceManager> deviceManager)
+      : m_instance(instance), m_surface(surface), m_deviceManager(deviceManager)
   {
   }
 
@@ -40,7 +32,7 @@
     }
     catch (const std::exception& e)
     {
-      RENDER_ERROR("Failed to initialize SwapchainManager: %s", e.what());
+      RENDER_ERROR("Failed to initialize SwapchainManager: ", e.what());
       return false;
     }
   }
@@ -139,8 +131,8 @@
     m_swapchainImageFormat = surfaceFormat.format;
     m_swapchainExtent = extent;
 
-    RENDER_DEBUG("Swapchain created with %d images, format: %d, extent: %dx%d",
-                    imageCount, surfaceFormat.format, extent.width, extent.height);
+    RENDER_DEBUG("Swapchain created with ", imageCount, " images, format: ", surfaceFormat.format,
+                 ", extent: ", extent.width, "x", extent.height);
   }
 
   void SwapchainManager::CreateImageViews()
@@ -168,7 +160,7 @@
       VK_CHECK(result, "Failed to create image views!");
     }
 
-    RENDER_DEBUG("Created %d image views", m_swapchainImageViews.size());
+    RENDER_DEBUG("Created ", m_swapchainImageViews.size(), " image views");
   }
 
   void SwapchainManager::CreateDepthResources()
@@ -227,7 +219,7 @@
     result = vkCreateImageView(device, &viewInfo, nullptr, &m_depthImageView);
     VK_CHECK(result, "Failed to create depth image view!");
 
-    RENDER_DEBUG("Depth resources created with format: %d", m_depthFormat);
+    RENDER_DEBUG("Depth resources created with format: ", m_depthFormat);
   }
 
   void SwapchainManager::CreateRenderPass()
@@ -319,7 +311,7 @@
       VK_CHECK(result, "Failed to create framebuffer!");
     }
 
-    RENDER_DEBUG("Created %d framebuffers with depth attachment", m_swapchainFramebuffers.size());
+    RENDER_DEBUG("Created ", m_swapchainFramebuffers.size(), " framebuffers with depth attachment");
   }
 
   void SwapchainManager::CleanupSwapchain()
@@ -404,12 +396,14 @@
     {
       VkExtent2D actualExtent = {800, 600};
 
-      if (m_window)
+      const uint64_t windowExtent = m_windowExtent.load(std::memory_order_relaxed);
+      const uint32_t windowWidth = static_cast<uint32_t>(windowExtent >> 32);
+      const uint32_t windowHeight = static_cast<uint32_t>(windowExtent);
+
+      if (windowWidth > 0 && windowHeight > 0)
       {
-        int width = 0, height = 0;
-        SDL_GetWindowSize(m_window, &width, &height);
-        actualExtent.width = static_cast<uint32_t>(width);
-        actualExtent.height = static_cast<uint32_t>(height);
+        actualExtent.width = windowWidth;
+        actualExtent.height = windowHeight;
       }
 
       actualExtent.width = std::clamp(actualExtent.width,
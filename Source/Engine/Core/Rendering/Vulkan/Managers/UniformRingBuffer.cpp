@@ -0,0 +1,72 @@
+#include "Engine/Core/Rendering/Vulkan/Managers/UniformRingBuffer.h"
+
+#include <algorithm>
+
+  UniformRingBuffer::UniformRingBuffer(std::shared_ptr<DeviceManager> deviceManager, std::shared_ptr<BufferManager> bufferManager)
+      : m_deviceManager(deviceManager), m_bufferManager(bufferManager)
+  {
+  }
+
+  UniformRingBuffer::~UniformRingBuffer()
+  {
+    Shutdown();
+  }
+
+  bool UniformRingBuffer::Initialize(const std::string& name, VkDeviceSize frameSize, uint32_t frameCount)
+  {
+    m_alignment = std::max<VkDeviceSize>(m_deviceManager->GetProperties().limits.minUniformBufferOffsetAlignment, 1);
+    m_frameSize = (frameSize + m_alignment - 1) / m_alignment * m_alignment;
+
+    m_buffer = m_bufferManager->CreateUniformBuffer(name, m_frameSize * frameCount);
+    if (!m_buffer)
+    {
+      RENDER_ERROR("Failed to create uniform ring buffer '", name, "'");
+      return false;
+    }
+
+    m_mappedData = static_cast<uint8_t*>(m_bufferManager->MapBuffer(m_buffer));
+    if (!m_mappedData)
+    {
+      RENDER_ERROR("Failed to map uniform ring buffer '", name, "'");
+      m_bufferManager->DestroyBuffer(m_buffer);
+      m_buffer = {};
+      return false;
+    }
+
+    m_name = name;
+    BeginFrame(0);
+
+    RENDER_DEBUG("Uniform ring buffer '", name, "' created: ", frameCount, " x ", m_frameSize, " bytes");
+    return true;
+  }
+
+  void UniformRingBuffer::Shutdown()
+  {
+    if (m_buffer && m_bufferManager)
+    {
+      m_bufferManager->DestroyBuffer(m_buffer);
+    }
+    m_buffer = {};
+    m_name.clear();
+    m_mappedData = nullptr;
+  }
+
+  void UniformRingBuffer::BeginFrame(uint32_t frameIndex)
+  {
+    m_cursor = m_frameSize * frameIndex;
+    m_frameEnd = m_cursor + m_frameSize;
+  }
+
+  void* UniformRingBuffer::Allocate(VkDeviceSize size, uint32_t& outOffset)
+  {
+    if (!m_mappedData || m_cursor + size > m_frameEnd)
+    {
+      RENDER_ERROR("Uniform ring buffer '", m_name, "' is out of space for this frame");
+      return nullptr;
+    }
+
+    outOffset = static_cast<uint32_t>(m_cursor);
+    void* data = m_mappedData + m_cursor;
+    m_cursor += (size + m_alignment - 1) / m_alignment * m_alignment;
+    return data;
+  }
@@ -0,0 +1,309 @@
+#include "Engine/Core/Rendering/Vulkan/Managers/UploadManager.h"
+
+namespace
+{
+  constexpr VkDeviceSize STAGING_ALIGNMENT = 16;
+}  // namespace
+
+  UploadManager::UploadManager(std::shared_ptr<DeviceManager> deviceManager, std::shared_ptr<BufferManager> bufferManager)
+      : m_deviceManager(deviceManager), m_bufferManager(bufferManager)
+  {
+  }
+
+  UploadManager::~UploadManager()
+  {
+    Shutdown();
+  }
+
+  bool UploadManager::Initialize(VkDeviceSize stagingSize, uint32_t maxBatchesInFlight)
+  {
+    RENDER_DEBUG("Initializing UploadManager...");
+
+    VkDevice device = m_deviceManager->GetDevice();
+    m_queue = m_deviceManager->GetTransferQueue();
+
+    VkCommandPoolCreateInfo poolInfo{};
+    poolInfo.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+    poolInfo.queueFamilyIndex = m_deviceManager->getIndices().transferFamily;
+    poolInfo.flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT | VK_COMMAND_POOL_CREATE_TRANSIENT_BIT;
+
+    VkResult result = vkCreateCommandPool(device, &poolInfo, nullptr, &m_commandPool);
+    VK_CHECK(result, "Failed to create upload command pool");
+
+    m_batches.resize(maxBatchesInFlight);
+    for (auto& batch : m_batches)
+    {
+      VkCommandBufferAllocateInfo allocInfo{};
+      allocInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+      allocInfo.commandPool = m_commandPool;
+      allocInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+      allocInfo.commandBufferCount = 1;
+      result = vkAllocateCommandBuffers(device, &allocInfo, &batch.commandBuffer);
+      VK_CHECK(result, "Failed to allocate upload command buffer");
+
+      VkFenceCreateInfo fenceInfo{};
+      fenceInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+      result = vkCreateFence(device, &fenceInfo, nullptr, &batch.fence);
+      VK_CHECK(result, "Failed to create upload fence");
+    }
+
+    m_stagingHandle = m_bufferManager->CreateStagingBuffer("upload_staging_ring", stagingSize);
+    if (!m_stagingHandle)
+    {
+      RENDER_ERROR("Failed to create upload staging ring");
+      return false;
+    }
+    m_stagingBuffer = m_bufferManager->GetBuffer(m_stagingHandle);
+    m_stagingData = static_cast<uint8_t*>(m_bufferManager->MapBuffer(m_stagingHandle));
+    m_stagingSize = stagingSize;
+
+    RENDER_DEBUG("UploadManager initialized: ", stagingSize / 1024, " KB staging, ",
+                 m_deviceManager->HasDedicatedTransferQueue() ? "dedicated transfer queue" : "graphics queue");
+    return m_stagingData != nullptr;
+  }
+
+  void UploadManager::Shutdown()
+  {
+    if (m_commandPool == VK_NULL_HANDLE)
+    {
+      return;
+    }
+
+    if (m_recording)
+    {
+      vkEndCommandBuffer(m_batches[m_currentBatch].commandBuffer);
+      m_recording = false;
+    }
+    WaitIdle();
+
+    VkDevice device = m_deviceManager->GetDevice();
+    for (auto& batch : m_batches)
+    {
+      for (BufferHandle staging : batch.oversizedStaging)
+      {
+        m_bufferManager->DestroyBuffer(staging);
+      }
+      vkDestroyFence(device, batch.fence, nullptr);
+    }
+    m_batches.clear();
+    m_failedTickets.clear();
+
+    vkDestroyCommandPool(device, m_commandPool, nullptr);
+    m_commandPool = VK_NULL_HANDLE;
+
+    m_bufferManager->DestroyBuffer(m_stagingHandle);
+    m_stagingHandle = {};
+    m_stagingBuffer = VK_NULL_HANDLE;
+    m_stagingData = nullptr;
+
+    RENDER_DEBUG("UploadManager shutdown complete");
+  }
+
+  uint64_t UploadManager::UploadBuffer(VkBuffer dstBuffer, const void* data, VkDeviceSize size, VkDeviceSize dstOffset)
+  {
+    if (dstBuffer == VK_NULL_HANDLE || size == 0 || !BeginBatch())
+    {
+      return 0;
+    }
+
+    UploadBatch& batch = m_batches[m_currentBatch];
+
+    VkBuffer srcBuffer = m_stagingBuffer;
+    VkDeviceSize srcOffset = 0;
+    if (size > m_stagingSize)
+    {
+      // Не помещается в кольцо вовсе: отдельный staging, живущий до завершения партии
+      BufferHandle staging = m_bufferManager->CreateStagingBuffer("", size);
+      if (!staging)
+      {
+        return 0;
+      }
+      memcpy(m_bufferManager->MapBuffer(staging), data, (size_t)size);
+      srcBuffer = m_bufferManager->GetBuffer(staging);
+      batch.oversizedStaging.push_back(staging);
+    }
+    else
+    {
+      while (!AllocateStaging(size, srcOffset))
+      {
+        // Кольцо занято отправленными партиями: ждем самую старую
+        if (m_inFlight.empty())
+        {
+          RENDER_ERROR("Upload staging ring exhausted by a single batch");
+          return 0;
+        }
+        RetireOldestBatch(true);
+      }
+      memcpy(m_stagingData + srcOffset, data, (size_t)size);
+    }
+
+    VkBufferCopy copyRegion{};
+    copyRegion.srcOffset = srcOffset;
+    copyRegion.dstOffset = dstOffset;
+    copyRegion.size = size;
+    vkCmdCopyBuffer(batch.commandBuffer, srcBuffer, dstBuffer, 1, &copyRegion);
+
+    return m_nextTicket;
+  }
+
+  void UploadManager::Submit()
+  {
+    if (!m_recording)
+    {
+      return;
+    }
+
+    UploadBatch& batch = m_batches[m_currentBatch];
+    vkEndCommandBuffer(batch.commandBuffer);
+    m_recording = false;
+
+    VkSubmitInfo submitInfo{};
+    submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+    submitInfo.commandBufferCount = 1;
+    submitInfo.pCommandBuffers = &batch.commandBuffer;
+
+    // Тикет расходуется и при ошибке: выданный UploadBuffer тикет не должен достаться следующей партии
+    batch.ticket = m_nextTicket++;
+
+    VkResult result = vkQueueSubmit(m_queue, 1, &submitInfo, batch.fence);
+    if (result != VK_SUCCESS)
+    {
+      RENDER_ERROR("Failed to submit upload batch ", batch.ticket, ", result: ", static_cast<int>(result));
+      DiscardBatch(batch);
+      return;
+    }
+
+    batch.inFlight = true;
+    m_inFlight.push_back(m_currentBatch);
+    m_currentBatch = (m_currentBatch + 1) % static_cast<uint32_t>(m_batches.size());
+  }
+
+  void UploadManager::TakeFailedTickets(std::vector<uint64_t>& outTickets)
+  {
+    outTickets.clear();
+    outTickets.swap(m_failedTickets);
+  }
+
+  void UploadManager::Update()
+  {
+    while (!m_inFlight.empty())
+    {
+      const UploadBatch& oldest = m_batches[m_inFlight.front()];
+      if (vkGetFenceStatus(m_deviceManager->GetDevice(), oldest.fence) != VK_SUCCESS)
+      {
+        break;
+      }
+      RetireOldestBatch(false);
+    }
+  }
+
+  void UploadManager::WaitIdle()
+  {
+    Submit();
+    while (!m_inFlight.empty())
+    {
+      RetireOldestBatch(true);
+    }
+  }
+
+  bool UploadManager::BeginBatch()
+  {
+    if (m_recording)
+    {
+      return true;
+    }
+
+    UploadBatch& batch = m_batches[m_currentBatch];
+    if (batch.inFlight)
+    {
+      // Все партии в полете: ждем ту, что занимает этот слот (она самая старая)
+      while (batch.inFlight)
+      {
+        RetireOldestBatch(true);
+      }
+    }
+
+    vkResetCommandBuffer(batch.commandBuffer, 0);
+
+    VkCommandBufferBeginInfo beginInfo{};
+    beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+    beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+    if (vkBeginCommandBuffer(batch.commandBuffer, &beginInfo) != VK_SUCCESS)
+    {
+      RENDER_ERROR("Failed to begin upload command buffer");
+      return false;
+    }
+
+    batch.stagingStart = m_stagingHead;
+    batch.stagingBytes = 0;
+    m_recording = true;
+    return true;
+  }
+
+  bool UploadManager::AllocateStaging(VkDeviceSize size, VkDeviceSize& outOffset)
+  {
+    VkDeviceSize offset = (m_stagingHead + STAGING_ALIGNMENT - 1) / STAGING_ALIGNMENT * STAGING_ALIGNMENT;
+    if (offset + size > m_stagingSize)
+    {
+      offset = 0;  // хвост кольца пропускаем, он освободится вместе с партией
+    }
+
+    // Занятое место считается от головы вперед, включая выравнивание и пропущенный хвост
+    const VkDeviceSize consumed = (offset >= m_stagingHead ? offset - m_stagingHead : m_stagingSize - m_stagingHead + offset) + size;
+    if (m_stagingUsed + consumed > m_stagingSize)
+    {
+      return false;
+    }
+
+    m_stagingHead = offset + size;
+    m_stagingUsed += consumed;
+    m_batches[m_currentBatch].stagingBytes += consumed;
+    outOffset = offset;
+    return true;
+  }
+
+  void UploadManager::RetireBatch(UploadBatch& batch)
+  {
+    vkResetFences(m_deviceManager->GetDevice(), 1, &batch.fence);
+
+    for (BufferHandle staging : batch.oversizedStaging)
+    {
+      m_bufferManager->DestroyBuffer(staging);
+    }
+    batch.oversizedStaging.clear();
+
+    m_stagingUsed -= batch.stagingBytes;
+    batch.stagingBytes = 0;
+    batch.inFlight = false;
+    m_completedTicket = batch.ticket;
+  }
+
+  void UploadManager::RetireOldestBatch(bool wait)
+  {
+    UploadBatch& batch = m_batches[m_inFlight.front()];
+    if (wait)
+    {
+      vkWaitForFences(m_deviceManager->GetDevice(), 1, &batch.fence, VK_TRUE, UINT64_MAX);
+    }
+    RetireBatch(batch);
+    m_inFlight.pop_front();
+  }
+
+  void UploadManager::DiscardBatch(UploadBatch& batch)
+  {
+    // Партия не попала в очередь, GPU ее памяти не касался: освобождаем сразу
+    vkResetCommandBuffer(batch.commandBuffer, 0);
+
+    for (BufferHandle staging : batch.oversizedStaging)
+    {
+      m_bufferManager->DestroyBuffer(staging);
+    }
+    batch.oversizedStaging.clear();
+
+    // Партия заняла место последней, поэтому голова кольца просто откатывается
+    m_stagingHead = batch.stagingStart;
+    m_stagingUsed -= batch.stagingBytes;
+    batch.stagingBytes = 0;
+
+    m_failedTickets.push_back(batch.ticket);
+  }
@@ -0,0 +1,163 @@
+#include "Engine/Core/Utilities/MappedFile.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+CMappedFile::~CMappedFile()
+{
+  Close();
+}
+
+CMappedFile::CMappedFile(CMappedFile&& other) noexcept
+{
+  MoveFrom(other);
+}
+
+CMappedFile& CMappedFile::operator=(CMappedFile&& other) noexcept
+{
+  if (this != &other)
+  {
+    Close();
+    MoveFrom(other);
+  }
+  return *this;
+}
+
+void CMappedFile::MoveFrom(CMappedFile& other) noexcept
+{
+  m_Data = other.m_Data;
+  m_Size = other.m_Size;
+  m_IsOpen = other.m_IsOpen;
+#ifdef _WIN32
+  m_File = other.m_File;
+  m_Mapping = other.m_Mapping;
+  other.m_File = nullptr;
+  other.m_Mapping = nullptr;
+#else
+  m_Descriptor = other.m_Descriptor;
+  other.m_Descriptor = -1;
+#endif
+  other.m_Data = nullptr;
+  other.m_Size = 0;
+  other.m_IsOpen = false;
+}
+
+#ifdef _WIN32
+
+bool CMappedFile::Open(const std::string& filePath)
+{
+  Close();
+
+  HANDLE file = CreateFileA(filePath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                            FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+  if (file == INVALID_HANDLE_VALUE)
+    return false;
+
+  LARGE_INTEGER size;
+  if (!GetFileSizeEx(file, &size))
+  {
+    CloseHandle(file);
+    return false;
+  }
+
+  m_File = file;
+  m_Size = static_cast<size_t>(size.QuadPart);
+  m_IsOpen = true;
+  if (m_Size == 0)
+    return true;
+
+  HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+  if (!mapping)
+  {
+    Close();
+    return false;
+  }
+  m_Mapping = mapping;
+
+  m_Data = static_cast<const char*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+  if (!m_Data)
+  {
+    Close();
+    return false;
+  }
+  return true;
+}
+
+void CMappedFile::Close()
+{
+  if (m_Data)
+  {
+    UnmapViewOfFile(m_Data);
+  }
+  if (m_Mapping)
+  {
+    CloseHandle(static_cast<HANDLE>(m_Mapping));
+  }
+  if (m_File)
+  {
+    CloseHandle(static_cast<HANDLE>(m_File));
+  }
+  m_Data = nullptr;
+  m_Mapping = nullptr;
+  m_File = nullptr;
+  m_Size = 0;
+  m_IsOpen = false;
+}
+
+#else
+
+bool CMappedFile::Open(const std::string& filePath)
+{
+  Close();
+
+  int descriptor = ::open(filePath.c_str(), O_RDONLY);
+  if (descriptor < 0)
+    return false;
+
+  struct stat info;
+  if (::fstat(descriptor, &info) != 0)
+  {
+    ::close(descriptor);
+    return false;
+  }
+
+  m_Descriptor = descriptor;
+  m_Size = static_cast<size_t>(info.st_size);
+  m_IsOpen = true;
+  if (m_Size == 0)
+    return true;
+
+  void* data = ::mmap(nullptr, m_Size, PROT_READ, MAP_PRIVATE, descriptor, 0);
+  if (data == MAP_FAILED)
+  {
+    Close();
+    return false;
+  }
+  ::madvise(data, m_Size, MADV_SEQUENTIAL);
+  m_Data = static_cast<const char*>(data);
+  return true;
+}
+
+void CMappedFile::Close()
+{
+  if (m_Data)
+  {
+    ::munmap(const_cast<char*>(m_Data), m_Size);
+  }
+  if (m_Descriptor >= 0)
+  {
+    ::close(m_Descriptor);
+  }
+  m_Data = nullptr;
+  m_Descriptor = -1;
+  m_Size = 0;
+  m_IsOpen = false;
+}
+
+#endif
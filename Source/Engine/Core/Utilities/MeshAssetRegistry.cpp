@@ -0,0 +1,171 @@
+#include "Engine/Core/Utilities/MeshAssetRegistry.h"
+
+#include <cstring>
+
+#include "CoreMinimal.h"
+#include "Engine/Core/Utilities/MeshCooker.h"
+
+namespace
+{
+  // FNV-1a по сырым байтам
+  uint64_t HashBytes(const void* data, size_t size, uint64_t hash)
+  {
+    const auto* bytes = static_cast<const uint8_t*>(data);
+    for (size_t i = 0; i < size; ++i)
+    {
+      hash ^= bytes[i];
+      hash *= 0x100000001B3ull;
+    }
+    return hash;
+  }
+
+  bool SameContent(const FStaticMesh& a, const FStaticMesh& b)
+  {
+    return a.vertices.size() == b.vertices.size() && a.indices == b.indices &&
+           std::memcmp(a.vertices.data(), b.vertices.data(), a.vertices.size() * sizeof(Vertex)) == 0;
+  }
+}  // namespace
+
+CMeshAssetRegistry& CMeshAssetRegistry::Get()
+{
+  static CMeshAssetRegistry instance;
+  return instance;
+}
+
+uint64_t CMeshAssetRegistry::HashMesh(const FStaticMesh& mesh)
+{
+  uint64_t hash = 0xCBF29CE484222325ull;
+  hash = HashBytes(mesh.vertices.data(), mesh.vertices.size() * sizeof(Vertex), hash);
+  hash = HashBytes(mesh.indices.data(), mesh.indices.size() * sizeof(uint32_t), hash);
+  return hash;
+}
+
+FMeshAssetRef CMeshAssetRegistry::Load(const std::string& path)
+{
+  CE_PROFILE_SCOPE("CMeshAssetRegistry::Load");
+  {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    auto it = m_ByName.find(path);
+    auto entry = (it != m_ByName.end()) ? m_Entries.find(it->second) : m_Entries.end();
+    if (entry != m_Entries.end())
+    {
+      if (FMeshAssetRef asset = entry->second.Asset.lock())
+        return asset;
+    }
+  }
+
+  // Загрузка вне блокировки: параллельные загрузки разных файлов не ждут друг друга
+  FStaticMesh mesh = MeshCooker::LoadMesh(path);
+  if (mesh.vertices.empty() || mesh.indices.empty())
+    return nullptr;
+
+  const uint64_t hash = HashMesh(mesh);
+  std::lock_guard<std::mutex> lock(m_Mutex);
+  FMeshAssetRef asset = FindLiveByHash(hash, mesh);
+  if (!asset)
+  {
+    asset = Insert(path, hash, std::move(mesh));
+  }
+  m_ByName[path] = asset->Id;
+  return asset;
+}
+
+FMeshAssetRef CMeshAssetRegistry::Register(const std::string& name, FStaticMesh&& mesh)
+{
+  if (mesh.vertices.empty() || mesh.indices.empty())
+    return nullptr;
+
+  const uint64_t hash = HashMesh(mesh);
+  std::lock_guard<std::mutex> lock(m_Mutex);
+  if (FMeshAssetRef existing = FindLiveByHash(hash, mesh))
+    return existing;
+  return Insert(name, hash, std::move(mesh));
+}
+
+void CMeshAssetRegistry::CollectReleased(std::vector<FMeshAssetId>& outReleased)
+{
+  std::lock_guard<std::mutex> lock(m_Mutex);
+  for (auto it = m_Entries.begin(); it != m_Entries.end();)
+  {
+    if (!it->second.Asset.expired())
+    {
+      ++it;
+      continue;
+    }
+
+    const FMeshAssetId id = it->first;
+    auto range = m_ByHash.equal_range(it->second.ContentHash);
+    for (auto hashIt = range.first; hashIt != range.second; ++hashIt)
+    {
+      if (hashIt->second == id)
+      {
+        m_ByHash.erase(hashIt);
+        break;
+      }
+    }
+    outReleased.push_back(id);
+    it = m_Entries.erase(it);
+  }
+
+  for (auto it = m_ByName.begin(); it != m_ByName.end();)
+  {
+    it = m_Entries.count(it->second) ? std::next(it) : m_ByName.erase(it);
+  }
+}
+
+FMeshAssetRef CMeshAssetRegistry::Find(FMeshAssetId id) const
+{
+  std::lock_guard<std::mutex> lock(m_Mutex);
+  auto it = m_Entries.find(id);
+  return it != m_Entries.end() ? it->second.Asset.lock() : nullptr;
+}
+
+size_t CMeshAssetRegistry::GetLiveAssetCount() const
+{
+  std::lock_guard<std::mutex> lock(m_Mutex);
+  size_t count = 0;
+  for (const auto& [id, entry] : m_Entries)
+  {
+    if (!entry.Asset.expired())
+    {
+      ++count;
+    }
+  }
+  return count;
+}
+
+FMeshAssetRef CMeshAssetRegistry::FindLiveByHash(uint64_t hash, const FStaticMesh& mesh) const
+{
+  auto range = m_ByHash.equal_range(hash);
+  for (auto it = range.first; it != range.second; ++it)
+  {
+    auto entry = m_Entries.find(it->second);
+    if (entry == m_Entries.end())
+      continue;
+
+    FMeshAssetRef asset = entry->second.Asset.lock();
+    if (asset && SameContent(asset->Mesh, mesh))
+      return asset;
+  }
+  return nullptr;
+}
+
+FMeshAssetRef CMeshAssetRegistry::Insert(const std::string& name, uint64_t hash, FStaticMesh&& mesh)
+{
+  auto asset = std::make_shared<FMeshAsset>();
+  asset->Id = m_NextId++;
+  asset->Name = name;
+  asset->ContentHash = hash;
+  asset->Mesh = std::move(mesh);
+  if (!asset->Mesh.bounds.IsValid())
+  {
+    // Процедурные меши приходят без границ
+    asset->Mesh.ComputeBounds();
+  }
+
+  m_Entries[asset->Id] = FEntry{asset, hash};
+  m_ByHash.emplace(hash, asset->Id);
+
+  CORE_DEBUG("Registered mesh asset: ", name.c_str());
+  return asset;
+}
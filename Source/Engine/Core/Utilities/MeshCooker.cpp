@@ -0,0 +1,334 @@
+#include "Engine/Core/Utilities/MeshCooker.h"
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <vector>
+
+#include "CoreMinimal.h"
+#include "Engine/Core/Utilities/ObjLoader.h"
+
+namespace
+{
+  constexpr uint64_t BLOCK_ALIGNMENT = 16;
+
+  uint64_t AlignUp(uint64_t value)
+  {
+    return (value + BLOCK_ALIGNMENT - 1) & ~(BLOCK_ALIGNMENT - 1);
+  }
+
+  // Удаляет недописанный файл на любом пути выхода, пока его не отпустили после rename
+  struct FTempFileGuard
+  {
+    std::string Path;
+    bool Released = false;
+
+    ~FTempFileGuard()
+    {
+      if (!Released)
+      {
+        std::error_code error;
+        std::filesystem::remove(Path, error);
+      }
+    }
+  };
+
+  bool FileExists(const std::string& path)
+  {
+    std::error_code error;
+    return std::filesystem::is_regular_file(path, error);
+  }
+
+  // Тот же fallback, что и в ObjLoader: запуск из build/ видит ассеты уровнем выше
+  std::string ResolveAssetPath(const std::string& path)
+  {
+    if (!FileExists(path) && path.find("Assets/") == 0 && FileExists("../" + path))
+    {
+      return "../" + path;
+    }
+    return path;
+  }
+}  // namespace
+
+bool CCookedMesh::Open(const std::string& filePath)
+{
+  Close();
+
+  if (!m_File.Open(filePath))
+    return false;
+
+  const size_t size = m_File.GetSize();
+  if (size < sizeof(FCookedMeshHeader))
+  {
+    CORE_WARN("Cooked mesh is truncated: ", filePath.c_str());
+    Close();
+    return false;
+  }
+
+  const auto* header = reinterpret_cast<const FCookedMeshHeader*>(m_File.GetData());
+  if (header->Magic != FCookedMeshHeader::MAGIC || header->Version != FCookedMeshHeader::VERSION ||
+      header->VertexStride != sizeof(Vertex))
+  {
+    CORE_DEBUG("Cooked mesh has incompatible format: ", filePath.c_str());
+    Close();
+    return false;
+  }
+
+  const uint64_t vertexBytes = static_cast<uint64_t>(header->VertexCount) * header->VertexStride;
+  const uint64_t indexBytes = static_cast<uint64_t>(header->IndexCount) * header->IndexSize;
+  const bool validIndexSize = header->IndexSize == sizeof(uint16_t) || header->IndexSize == sizeof(uint32_t);
+  if (!validIndexSize || header->VertexOffset % BLOCK_ALIGNMENT != 0 || header->IndexOffset % BLOCK_ALIGNMENT != 0 ||
+      header->VertexOffset + vertexBytes > size || header->IndexOffset + indexBytes > size)
+  {
+    CORE_WARN("Cooked mesh is corrupted: ", filePath.c_str());
+    Close();
+    return false;
+  }
+
+  m_Header = header;
+  return true;
+}
+
+void CCookedMesh::Close()
+{
+  m_Header = nullptr;
+  m_File.Close();
+}
+
+std::span<const Vertex> CCookedMesh::GetVertices() const
+{
+  if (!m_Header)
+    return {};
+  const auto* vertices = reinterpret_cast<const Vertex*>(m_File.GetData() + m_Header->VertexOffset);
+  return {vertices, m_Header->VertexCount};
+}
+
+std::span<const uint16_t> CCookedMesh::GetIndices16() const
+{
+  if (!m_Header || m_Header->IndexSize != sizeof(uint16_t))
+    return {};
+  const auto* indices = reinterpret_cast<const uint16_t*>(m_File.GetData() + m_Header->IndexOffset);
+  return {indices, m_Header->IndexCount};
+}
+
+std::span<const uint32_t> CCookedMesh::GetIndices32() const
+{
+  if (!m_Header || m_Header->IndexSize != sizeof(uint32_t))
+    return {};
+  const auto* indices = reinterpret_cast<const uint32_t*>(m_File.GetData() + m_Header->IndexOffset);
+  return {indices, m_Header->IndexCount};
+}
+
+FVector CCookedMesh::GetBoundsMin() const
+{
+  return m_Header ? FVector(m_Header->BoundsMin[0], m_Header->BoundsMin[1], m_Header->BoundsMin[2]) : FVector(0.0f);
+}
+
+FVector CCookedMesh::GetBoundsMax() const
+{
+  return m_Header ? FVector(m_Header->BoundsMax[0], m_Header->BoundsMax[1], m_Header->BoundsMax[2]) : FVector(0.0f);
+}
+
+FStaticMesh CCookedMesh::ToStaticMesh() const
+{
+  FStaticMesh mesh;
+  std::span<const Vertex> vertices = GetVertices();
+  mesh.vertices.assign(vertices.begin(), vertices.end());
+
+  if (GetIndexSize() == sizeof(uint16_t))
+  {
+    std::span<const uint16_t> indices = GetIndices16();
+    mesh.indices.assign(indices.begin(), indices.end());
+  }
+  else
+  {
+    std::span<const uint32_t> indices = GetIndices32();
+    mesh.indices.assign(indices.begin(), indices.end());
+  }
+
+  // Бокс уже посчитан при запекании
+  mesh.bounds = FBox(GetBoundsMin(), GetBoundsMax());
+  mesh.ComputeBoundingSphere();
+  return mesh;
+}
+
+std::string MeshCooker::GetCookedPath(const std::string& sourcePath)
+{
+  return std::filesystem::path(sourcePath).replace_extension(".cemesh").string();
+}
+
+bool MeshCooker::WriteCooked(const FStaticMesh& mesh, const std::string& cookedPath)
+{
+  if (mesh.vertices.size() > std::numeric_limits<uint32_t>::max() ||
+      mesh.indices.size() > std::numeric_limits<uint32_t>::max())
+  {
+    CORE_ERROR("Mesh is too large to cook: ", cookedPath.c_str());
+    return false;
+  }
+
+  FCookedMeshHeader header;
+  header.VertexCount = static_cast<uint32_t>(mesh.vertices.size());
+  header.IndexCount = static_cast<uint32_t>(mesh.indices.size());
+  header.IndexSize = mesh.vertices.size() <= 65536 ? sizeof(uint16_t) : sizeof(uint32_t);
+  header.VertexOffset = AlignUp(sizeof(FCookedMeshHeader));
+  header.IndexOffset = AlignUp(header.VertexOffset + static_cast<uint64_t>(header.VertexCount) * sizeof(Vertex));
+
+  if (!mesh.vertices.empty())
+  {
+    const FVector& first = mesh.vertices[0].position;
+    header.BoundsMin[0] = header.BoundsMax[0] = first.x;
+    header.BoundsMin[1] = header.BoundsMax[1] = first.y;
+    header.BoundsMin[2] = header.BoundsMax[2] = first.z;
+    for (const Vertex& vertex : mesh.vertices)
+    {
+      const float position[3] = {vertex.position.x, vertex.position.y, vertex.position.z};
+      for (int axis = 0; axis < 3; ++axis)
+      {
+        header.BoundsMin[axis] = std::min(header.BoundsMin[axis], position[axis]);
+        header.BoundsMax[axis] = std::max(header.BoundsMax[axis], position[axis]);
+      }
+    }
+  }
+
+  const std::string tempPath = cookedPath + ".tmp";
+  // Объявлен до потока: файл закрывается раньше, чем охранник его удаляет
+  FTempFileGuard tempGuard{tempPath};
+  {
+    std::ofstream file(tempPath, std::ios::binary | std::ios::trunc);
+    if (!file.is_open())
+    {
+      CORE_ERROR("Failed to create cooked mesh: ", cookedPath.c_str());
+      return false;
+    }
+
+    static const char padding[BLOCK_ALIGNMENT] = {};
+    auto writePadding = [&file](uint64_t target)
+    {
+      const uint64_t position = static_cast<uint64_t>(file.tellp());
+      file.write(padding, static_cast<std::streamsize>(target - position));
+    };
+
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    writePadding(header.VertexOffset);
+    file.write(reinterpret_cast<const char*>(mesh.vertices.data()),
+               static_cast<std::streamsize>(mesh.vertices.size() * sizeof(Vertex)));
+    writePadding(header.IndexOffset);
+
+    if (header.IndexSize == sizeof(uint16_t))
+    {
+      std::vector<uint16_t> narrow(mesh.indices.begin(), mesh.indices.end());
+      file.write(reinterpret_cast<const char*>(narrow.data()),
+                 static_cast<std::streamsize>(narrow.size() * sizeof(uint16_t)));
+    }
+    else
+    {
+      file.write(reinterpret_cast<const char*>(mesh.indices.data()),
+                 static_cast<std::streamsize>(mesh.indices.size() * sizeof(uint32_t)));
+    }
+
+    if (!file.good())
+    {
+      CORE_ERROR("Failed to write cooked mesh: ", cookedPath.c_str());
+      return false;
+    }
+  }
+
+  std::error_code error;
+  std::filesystem::rename(tempPath, cookedPath, error);
+  if (error)
+  {
+    CORE_ERROR("Failed to finalize cooked mesh: ", cookedPath.c_str());
+    return false;
+  }
+  tempGuard.Released = true;
+  return true;
+}
+
+bool MeshCooker::CookOBJ(const std::string& sourcePath, const std::string& cookedPath)
+{
+  const std::string resolvedSource = ResolveAssetPath(sourcePath);
+  FStaticMesh mesh = ObjLoader::LoadOBJ(resolvedSource);
+  if (mesh.vertices.empty() || mesh.indices.empty())
+  {
+    CORE_ERROR("Nothing to cook: ", sourcePath.c_str());
+    return false;
+  }
+
+  const std::string target = cookedPath.empty() ? GetCookedPath(resolvedSource) : cookedPath;
+  if (!WriteCooked(mesh, target))
+    return false;
+
+  CORE_DISPLAY("Cooked mesh: ", target.c_str());
+  return true;
+}
+
+uint32_t MeshCooker::CookDirectory(const std::string& directory, bool force)
+{
+  const std::string resolvedDirectory = ResolveAssetPath(directory);
+
+  std::vector<std::string> sources;
+  std::error_code error;
+  for (const auto& entry : std::filesystem::directory_iterator(resolvedDirectory, error))
+  {
+    if (entry.is_regular_file() && entry.path().extension() == ".obj")
+    {
+      sources.push_back(entry.path().string());
+    }
+  }
+  if (error)
+  {
+    CORE_ERROR("Failed to read mesh directory: ", resolvedDirectory.c_str());
+    return 0;
+  }
+  std::sort(sources.begin(), sources.end());
+
+  uint32_t cooked = 0;
+  for (const std::string& source : sources)
+  {
+    if (!force && IsCookedUpToDate(source, GetCookedPath(source)))
+      continue;
+    if (CookOBJ(source))
+    {
+      ++cooked;
+    }
+  }
+  return cooked;
+}
+
+bool MeshCooker::IsCookedUpToDate(const std::string& sourcePath, const std::string& cookedPath)
+{
+  std::error_code error;
+  const auto cookedTime = std::filesystem::last_write_time(cookedPath, error);
+  if (error)
+    return false;
+
+  const auto sourceTime = std::filesystem::last_write_time(sourcePath, error);
+  if (error)
+    return true;  // поставка только с запеченными ассетами
+
+  return cookedTime >= sourceTime;
+}
+
+FStaticMesh MeshCooker::LoadMesh(const std::string& sourcePath)
+{
+  CE_PROFILE_SCOPE("MeshCooker::LoadMesh");
+  const std::string resolvedSource = ResolveAssetPath(sourcePath);
+  std::string cookedPath = GetCookedPath(resolvedSource);
+  if (!FileExists(resolvedSource) && !FileExists(cookedPath))
+  {
+    cookedPath = ResolveAssetPath(GetCookedPath(sourcePath));
+  }
+
+  if (IsCookedUpToDate(resolvedSource, cookedPath))
+  {
+    CCookedMesh cooked;
+    if (cooked.Open(cookedPath))
+    {
+      CORE_DEBUG("Loaded cooked mesh: ", cookedPath.c_str());
+      return cooked.ToStaticMesh();
+    }
+  }
+
+  return ObjLoader::LoadOBJ(resolvedSource);
+}
@@ -1,154 +1,510 @@
 #include "Engine/Core/Utilities/ObjLoader.h"
 
-#include <fstream>
-#include <glm/glm.hpp>
-#include <map>
-#include <sstream>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <thread>
 
-#include "Engine/Utils/Logger.h"
 #include "Engine/Core/CoreTypes.h"
+#include "Engine/Core/Utilities/MappedFile.h"
+#include "Engine/Utils/Logger.h"
 
-FStaticMesh ObjLoader::LoadOBJ(const std::string& filePath)
+namespace
 {
-  FStaticMesh mesh;
-  std::vector<FVector> positions;
-  std::vector<FVector> normals;
-  std::vector<FVector2D> texCoords;
-  std::vector<Vertex> vertices;
-  std::vector<uint32_t> indices;
-  std::map<Vertex, uint32_t> vertexMap;
+  constexpr uint32_t INVALID_INDEX = UINT32_MAX;
+
+  // Угол грани до разрешения индексов. Отрицательные OBJ индексы отсчитываются
+  // от конца уже прочитанных данных, поэтому внутри куска они хранятся
+  // относительно начала куска и получают смещение после сведения кусков.
+  struct FObjCorner
+  {
+    int64_t Index[3];    // позиция, uv, нормаль
+    uint8_t Relative;    // бит i - Index[i] относителен куску
+  };
 
-  std::string fullPath = filePath;
-  std::ifstream file(fullPath);
-  if (!file.is_open() && fullPath.find("Assets/") == 0) {
-    fullPath = "../" + fullPath;
-    file.open(fullPath);
+  struct FObjChunk
+  {
+    const char* Begin = nullptr;
+    const char* End = nullptr;
+
+    std::vector<FVector> Positions;
+    std::vector<FVector> Normals;
+    std::vector<FVector2D> TexCoords;
+    std::vector<FObjCorner> Corners;
+    std::vector<uint32_t> FaceSizes;
+
+    uint32_t LineCount = 0;
+    uint32_t FirstInvalidLine = 0;  // номер строки внутри куска, 0 = ошибок нет
+  };
+
+  // ---- Токенизатор ----
+
+  inline bool IsSpace(char c)
+  {
+    return c == ' ' || c == '\t' || c == '\r';
   }
-  if (!file.is_open())
+
+  inline const char* SkipSpaces(const char* p, const char* end)
   {
-    CORE_ERROR("Failed to open OBJ file: ", filePath.c_str());
-    return mesh;
+    while (p < end && IsSpace(*p))
+      ++p;
+    return p;
+  }
+
+  inline const char* SkipToken(const char* p, const char* end)
+  {
+    while (p < end && !IsSpace(*p))
+      ++p;
+    return p;
   }
 
-  std::string line;
-  uint32_t lineNum = 0;
+  bool ParseInt(const char*& p, const char* end, int64_t& out)
+  {
+    const char* s = p;
+    bool negative = false;
+    if (s < end && (*s == '-' || *s == '+'))
+    {
+      negative = (*s == '-');
+      ++s;
+    }
+    if (s >= end || *s < '0' || *s > '9')
+      return false;
 
-  while (std::getline(file, line))
+    int64_t value = 0;
+    while (s < end && *s >= '0' && *s <= '9')
+    {
+      value = value * 10 + (*s - '0');
+      ++s;
+    }
+    out = negative ? -value : value;
+    p = s;
+    return true;
+  }
+
+  bool ParseFloat(const char*& p, const char* end, float& out)
   {
-    lineNum++;
-    if (line.empty() || line[0] == '#')
-      continue;
+    static const double POW10[] = {1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+                                   1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
 
-    std::istringstream iss(line);
-    std::string token;
-    iss >> token;
+    const char* s = p;
+    bool negative = false;
+    if (s < end && (*s == '-' || *s == '+'))
+    {
+      negative = (*s == '-');
+      ++s;
+    }
 
-    if (token == "v")
+    uint64_t mantissa = 0;
+    int exponent = 0;
+    int digits = 0;
+    bool anyDigits = false;
+
+    while (s < end && *s >= '0' && *s <= '9')
     {
-      float x, y, z;
-      if (iss >> x >> y >> z)
+      if (digits < 19)
       {
-        positions.push_back(FVector(x, y, z));
+        mantissa = mantissa * 10 + static_cast<uint64_t>(*s - '0');
+        if (mantissa)
+          ++digits;
       }
       else
       {
-       CORE_WARN("Invalid vertex format at line ", lineNum);
+        ++exponent;
       }
+      anyDigits = true;
+      ++s;
     }
-    else if (token == "vn")
+    if (s < end && *s == '.')
     {
-      float x, y, z;
-      if (iss >> x >> y >> z)
+      ++s;
+      while (s < end && *s >= '0' && *s <= '9')
       {
-        normals.push_back(FVector(x, y, z));
+        if (digits < 19)
+        {
+          mantissa = mantissa * 10 + static_cast<uint64_t>(*s - '0');
+          if (mantissa)
+            ++digits;
+          --exponent;
+        }
+        anyDigits = true;
+        ++s;
       }
     }
-    else if (token == "vt")
+    if (!anyDigits)
+      return false;
+
+    if (s < end && (*s == 'e' || *s == 'E'))
     {
-      float u, v;
-      if (iss >> u >> v)
+      const char* e = s + 1;
+      int64_t expValue = 0;
+      if (ParseInt(e, end, expValue))
       {
-        texCoords.push_back(FVector2D(u, v));
+        exponent += static_cast<int>(std::clamp<int64_t>(expValue, -1000, 1000));
+        s = e;
       }
     }
-    else if (token == "f")
+
+    double value = static_cast<double>(mantissa);
+    if (exponent < 0)
+    {
+      value = (exponent >= -22) ? value / POW10[-exponent] : value * std::pow(10.0, exponent);
+    }
+    else if (exponent > 0)
     {
-      
+      value = (exponent <= 22) ? value * POW10[exponent] : value * std::pow(10.0, exponent);
+    }
 
-      std::vector<uint32_t> faceIndices;
-      std::string vertexStr;
+    out = static_cast<float>(negative ? -value : value);
+    p = s;
+    return true;
+  }
 
-      while (iss >> vertexStr)
+  inline bool MatchKeyword(const char* p, const char* end, const char* keyword, size_t length)
+  {
+    return static_cast<size_t>(end - p) >= length && std::memcmp(p, keyword, length) == 0 &&
+           (p + length == end || IsSpace(p[length]));
+  }
+
+  // ---- Разбор одного куска ----
+
+  void ParseFaceCorner(const char*& p, const char* end, FObjChunk& chunk)
+  {
+    const size_t localCounts[3] = {chunk.Positions.size(), chunk.TexCoords.size(), chunk.Normals.size()};
+
+    int64_t raw[3] = {0, 0, 0};
+    if (!ParseInt(p, end, raw[0]))
+    {
+      p = SkipToken(p, end);
+      return;
+    }
+    if (p < end && *p == '/')
+    {
+      ++p;
+      if (p < end && *p != '/')
       {
-        std::istringstream vertexStream(vertexStr);
-        int posIdx = 0, texIdx = 0, normIdx = 0;
-        char slash;
+        ParseInt(p, end, raw[1]);
+      }
+      if (p < end && *p == '/')
+      {
+        ++p;
+        ParseInt(p, end, raw[2]);
+      }
+    }
+    p = SkipToken(p, end);
 
-        // v
-        if (vertexStream >> posIdx)
-        {
-          // Adjust for negative indices
-          if (posIdx > 0) posIdx--;
-          else if (posIdx < 0) posIdx += positions.size();
+    // Отсутствующий индекс ведет себя как 0, как и раньше
+    FObjCorner corner{};
+    for (int i = 0; i < 3; ++i)
+    {
+      if (raw[i] > 0)
+      {
+        corner.Index[i] = raw[i] - 1;
+      }
+      else if (raw[i] < 0)
+      {
+        corner.Index[i] = static_cast<int64_t>(localCounts[i]) + raw[i];
+        corner.Relative |= static_cast<uint8_t>(1u << i);
+      }
+    }
+    chunk.Corners.push_back(corner);
+  }
 
-          if (vertexStream.peek() == '/')
+  void ParseChunk(FObjChunk& chunk)
+  {
+    const char* p = chunk.Begin;
+    const char* end = chunk.End;
+
+    while (p < end)
+    {
+      const char* lineEnd = static_cast<const char*>(std::memchr(p, '\n', static_cast<size_t>(end - p)));
+      if (!lineEnd)
+        lineEnd = end;
+      ++chunk.LineCount;
+
+      const char* s = SkipSpaces(p, lineEnd);
+      if (s < lineEnd && *s != '#')
+      {
+        if (MatchKeyword(s, lineEnd, "v", 1))
+        {
+          s += 1;
+          float x, y, z;
+          s = SkipSpaces(s, lineEnd);
+          bool ok = ParseFloat(s, lineEnd, x);
+          s = SkipSpaces(s, lineEnd);
+          ok = ok && ParseFloat(s, lineEnd, y);
+          s = SkipSpaces(s, lineEnd);
+          ok = ok && ParseFloat(s, lineEnd, z);
+          if (ok)
           {
-            vertexStream >> slash;
-
-
-            if (vertexStream.peek() != '/')
-            {
-              vertexStream >> texIdx;
-              if (texIdx > 0) texIdx--;
-              else if (texIdx < 0) texIdx += texCoords.size();
-            }
-
-            if (vertexStream.peek() == '/')
-            {
-              vertexStream >> slash >> normIdx;
-              if (normIdx > 0) normIdx--;
-              else if (normIdx < 0) normIdx += normals.size();
-            }
+            chunk.Positions.emplace_back(x, y, z);
           }
-
-         
-          Vertex vertex;
-          if (posIdx >= 0 && static_cast<size_t>(posIdx) < positions.size())
+          else if (chunk.FirstInvalidLine == 0)
           {
-            vertex.position = positions[posIdx];
+            chunk.FirstInvalidLine = chunk.LineCount;
           }
-          if (normIdx >= 0 && static_cast<size_t>(normIdx) < normals.size())
+        }
+        else if (MatchKeyword(s, lineEnd, "vn", 2))
+        {
+          s += 2;
+          float x, y, z;
+          s = SkipSpaces(s, lineEnd);
+          bool ok = ParseFloat(s, lineEnd, x);
+          s = SkipSpaces(s, lineEnd);
+          ok = ok && ParseFloat(s, lineEnd, y);
+          s = SkipSpaces(s, lineEnd);
+          ok = ok && ParseFloat(s, lineEnd, z);
+          if (ok)
           {
-            vertex.normal = normals[normIdx];
+            chunk.Normals.emplace_back(x, y, z);
           }
-          else
+        }
+        else if (MatchKeyword(s, lineEnd, "vt", 2))
+        {
+          s += 2;
+          float u, v;
+          s = SkipSpaces(s, lineEnd);
+          bool ok = ParseFloat(s, lineEnd, u);
+          s = SkipSpaces(s, lineEnd);
+          ok = ok && ParseFloat(s, lineEnd, v);
+          if (ok)
           {
-            vertex.normal = FVector(0.0f, 1.0f, 0.0f);  // Дефолтная нормаль
+            chunk.TexCoords.emplace_back(u, v);
           }
-          if (texIdx >= 0 && static_cast<size_t>(texIdx) < texCoords.size())
+        }
+        else if (MatchKeyword(s, lineEnd, "f", 1))
+        {
+          s += 1;
+          const size_t firstCorner = chunk.Corners.size();
+          while (true)
           {
-            vertex.texCoord = texCoords[texIdx];
+            s = SkipSpaces(s, lineEnd);
+            if (s >= lineEnd)
+              break;
+            ParseFaceCorner(s, lineEnd, chunk);
           }
-          vertex.color = FVector(1.0f);
+          chunk.FaceSizes.push_back(static_cast<uint32_t>(chunk.Corners.size() - firstCorner));
+        }
+      }
+
+      p = (lineEnd < end) ? lineEnd + 1 : end;
+    }
+  }
+
+  // Делит буфер на куски по границам строк
+  std::vector<FObjChunk> SplitChunks(const char* data, size_t size, const FObjLoadSettings& settings)
+  {
+    uint32_t threads = settings.MaxThreads ? settings.MaxThreads : std::max(1u, std::thread::hardware_concurrency());
+    const size_t minChunk = std::max<size_t>(1, settings.MinChunkBytes);
+    const size_t bySize = std::max<size_t>(1, size / minChunk);
+    const size_t chunkCount = std::min<size_t>(threads, bySize);
+
+    std::vector<FObjChunk> chunks;
+    chunks.reserve(chunkCount);
+
+    const char* end = data + size;
+    const char* begin = data;
+    for (size_t i = 0; i < chunkCount && begin < end; ++i)
+    {
+      const char* chunkEnd = end;
+      if (i + 1 < chunkCount)
+      {
+        chunkEnd = std::min(end, data + size * (i + 1) / chunkCount);
+        const char* newline = static_cast<const char*>(std::memchr(chunkEnd, '\n', static_cast<size_t>(end - chunkEnd)));
+        chunkEnd = newline ? newline + 1 : end;
+      }
+      if (chunkEnd <= begin)
+        continue;
+
+      FObjChunk chunk;
+      chunk.Begin = begin;
+      chunk.End = chunkEnd;
+      chunks.push_back(std::move(chunk));
+      begin = chunkEnd;
+    }
+    return chunks;
+  }
+
+  // ---- Дедупликация по тройке индексов ----
+
+  class FCornerHashMap
+  {
+   public:
+    explicit FCornerHashMap(size_t expected)
+    {
+      size_t capacity = 16;
+      while (capacity < expected * 2)
+        capacity <<= 1;
+      m_Mask = capacity - 1;
+      m_Slots.assign(capacity, FSlot{});
+    }
+
+    // Возвращает индекс вершины и true, если тройка встретилась впервые
+    std::pair<uint32_t, bool> FindOrAdd(uint32_t p, uint32_t t, uint32_t n, uint32_t newValue)
+    {
+      uint64_t h = p * 0x9E3779B97F4A7C15ull;
+      h ^= (t + 0x632BE59BD9B4E019ull) * 0xC2B2AE3D27D4EB4Full;
+      h ^= (n + 0x85EBCA77C2B2AE63ull) * 0x165667B19E3779F9ull;
+      h ^= h >> 29;
+
+      size_t slot = static_cast<size_t>(h) & m_Mask;
+      while (true)
+      {
+        FSlot& entry = m_Slots[slot];
+        if (entry.Value == INVALID_INDEX)
+        {
+          entry = {p, t, n, newValue};
+          return {newValue, true};
+        }
+        if (entry.Position == p && entry.TexCoord == t && entry.Normal == n)
+        {
+          return {entry.Value, false};
+        }
+        slot = (slot + 1) & m_Mask;
+      }
+    }
+
+   private:
+    struct FSlot
+    {
+      uint32_t Position = 0;
+      uint32_t TexCoord = 0;
+      uint32_t Normal = 0;
+      uint32_t Value = INVALID_INDEX;
+    };
+
+    std::vector<FSlot> m_Slots;
+    size_t m_Mask = 0;
+  };
+
+  inline uint32_t ResolveIndex(const FObjCorner& corner, int i, size_t chunkOffset, size_t total)
+  {
+    int64_t index = corner.Index[i];
+    if (corner.Relative & (1u << i))
+    {
+      index += static_cast<int64_t>(chunkOffset);
+    }
+    return (index >= 0 && static_cast<size_t>(index) < total) ? static_cast<uint32_t>(index) : INVALID_INDEX;
+  }
+}  // namespace
 
-          // Deduplicate vertices
-          auto it = vertexMap.find(vertex);
-          if (it == vertexMap.end())
+FStaticMesh ObjLoader::LoadOBJ(const std::string& filePath)
+{
+  return LoadOBJ(filePath, FObjLoadSettings{});
+}
+
+FStaticMesh ObjLoader::LoadOBJ(const std::string& filePath, const FObjLoadSettings& settings)
+{
+  CE_PROFILE_SCOPE("ObjLoader::LoadOBJ");
+  CMappedFile file;
+  if (!file.Open(filePath) && filePath.find("Assets/") == 0)
+  {
+    file.Open("../" + filePath);
+  }
+  if (!file.IsOpen())
+  {
+    CORE_ERROR("Failed to open OBJ file: ", filePath.c_str());
+    return FStaticMesh();
+  }
+
+  return ParseOBJ(file.GetData(), file.GetSize(), settings, filePath);
+}
+
+FStaticMesh ObjLoader::ParseOBJ(const char* data, size_t size, const FObjLoadSettings& settings,
+                                const std::string& name)
+{
+  FStaticMesh mesh;
+  if (!data || size == 0)
+  {
+    CORE_WARN("OBJ file loaded but contains no geometry: ", name.c_str());
+    return mesh;
+  }
+
+  // 1. Параллельный разбор кусков
+  std::vector<FObjChunk> chunks = SplitChunks(data, size, settings);
+  {
+    std::vector<std::thread> workers;
+    workers.reserve(chunks.size());
+    for (size_t i = 1; i < chunks.size(); ++i)
+    {
+      workers.emplace_back(ParseChunk, std::ref(chunks[i]));
+    }
+    ParseChunk(chunks[0]);
+    for (auto& worker : workers)
+    {
+      worker.join();
+    }
+  }
+
+  // 2. Сведение атрибутов в общие массивы
+  size_t positionCount = 0, texCoordCount = 0, normalCount = 0, cornerCount = 0, lineOffset = 0;
+  for (const auto& chunk : chunks)
+  {
+    if (chunk.FirstInvalidLine != 0)
+    {
+      CORE_WARN("Invalid vertex format at line ", static_cast<uint32_t>(lineOffset + chunk.FirstInvalidLine));
+    }
+    positionCount += chunk.Positions.size();
+    texCoordCount += chunk.TexCoords.size();
+    normalCount += chunk.Normals.size();
+    cornerCount += chunk.Corners.size();
+    lineOffset += chunk.LineCount;
+  }
+
+  std::vector<FVector> positions;
+  std::vector<FVector2D> texCoords;
+  std::vector<FVector> normals;
+  positions.reserve(positionCount);
+  texCoords.reserve(texCoordCount);
+  normals.reserve(normalCount);
+  for (const auto& chunk : chunks)
+  {
+    positions.insert(positions.end(), chunk.Positions.begin(), chunk.Positions.end());
+    texCoords.insert(texCoords.end(), chunk.TexCoords.begin(), chunk.TexCoords.end());
+    normals.insert(normals.end(), chunk.Normals.begin(), chunk.Normals.end());
+  }
+
+  // 3. Дедупликация и триангуляция в порядке файла
+  std::vector<Vertex> vertices;
+  std::vector<uint32_t> indices;
+  vertices.reserve(cornerCount / 2 + 1);
+  indices.reserve(cornerCount * 3 / 2);
+
+  FCornerHashMap vertexMap(cornerCount);
+  std::vector<uint32_t> faceIndices;
+
+  size_t offsets[3] = {0, 0, 0};
+  for (const auto& chunk : chunks)
+  {
+    size_t cornerIndex = 0;
+    for (uint32_t faceSize : chunk.FaceSizes)
+    {
+      faceIndices.clear();
+      for (uint32_t c = 0; c < faceSize; ++c)
+      {
+        const FObjCorner& corner = chunk.Corners[cornerIndex++];
+        const uint32_t p = ResolveIndex(corner, 0, offsets[0], positions.size());
+        const uint32_t t = ResolveIndex(corner, 1, offsets[1], texCoords.size());
+        const uint32_t n = ResolveIndex(corner, 2, offsets[2], normals.size());
+
+        auto [index, isNew] = vertexMap.FindOrAdd(p, t, n, static_cast<uint32_t>(vertices.size()));
+        if (isNew)
+        {
+          Vertex vertex;
+          if (p != INVALID_INDEX)
           {
-            uint32_t index = static_cast<uint32_t>(vertices.size());
-            vertices.push_back(vertex);
-            vertexMap[vertex] = index;
-            faceIndices.push_back(index);
+            vertex.position = positions[p];
           }
-          else
+          vertex.normal = (n != INVALID_INDEX) ? normals[n] : FVector(0.0f, 1.0f, 0.0f);  // Дефолтная нормаль
+          if (t != INVALID_INDEX)
           {
-            faceIndices.push_back(it->second);
+            vertex.texCoord = texCoords[t];
           }
+          vertex.color = FVector(1.0f);
+          vertices.push_back(vertex);
         }
+        faceIndices.push_back(index);
       }
 
-      
-
       if (faceIndices.size() == 3)
       {
         // Already triangulated, add directly
@@ -167,22 +523,25 @@ FStaticMesh ObjLoader::LoadOBJ(const std::string& filePath)
         }
       }
     }
-  }
 
-  file.close();
+    offsets[0] += chunk.Positions.size();
+    offsets[1] += chunk.TexCoords.size();
+    offsets[2] += chunk.Normals.size();
+  }
 
   if (vertices.empty() || indices.empty())
   {
-    CORE_WARN("OBJ file loaded but contains no geometry: ", filePath.c_str());
+    CORE_WARN("OBJ file loaded but contains no geometry: ", name.c_str());
     return mesh;
   }
 
-  mesh.vertices = vertices;
-  mesh.indices = indices;
+  mesh.vertices = std::move(vertices);
+  mesh.indices = std::move(indices);
   mesh.color = FVector(1.0f);
+  mesh.ComputeBounds();
 
-  CORE_LOG("Successfully loaded OBJ: ", filePath.c_str(), " (vertices: ", vertices.size(), ", indices: ", indices.size(),
-         ")");
+  CORE_LOG("Successfully loaded OBJ: ", name.c_str(), " (vertices: ", mesh.vertices.size(), ", indices: ",
+           mesh.indices.size(), ")");
 
   return mesh;
 }
@@ -101,7 +101,8 @@ void CActor::BeginPlay()
 
 void CActor::Update(float DeltaTime)
 {
-  CObject::Update(DeltaTime);
+  // Компоненты тикают по своим FTickFunction в расписании уровня
+  (void)DeltaTime;
 }
 
 
@@ -25,6 +25,8 @@ m_InputComponent = AddSubObject<CInputComponent>("Input", this, "InputComponent"
     m_SpringArm->SetArmLength(5.7f);
     m_SpringArm->SetCameraLag(0.5f);
     m_SpringArm->SetUsePawnControlRotation(true);
+    // Спринг-арм берет вращение контроллера, которое пешка применяет в своем тике
+    m_SpringArm->GetPrimaryTick().AddPrerequisite(GetPrimaryTick());
     m_Camera = AddDefaultSubObject<CCameraComponent>("Camera", this, "Camera Component");
     m_Camera->AttachToComponent(m_SpringArm);
     m_Camera->SetFieldOfView(120.f);
@@ -50,14 +50,7 @@
 
   CCameraComponent* CPawn::FindCameraComponent() const
   {    
-    CCameraComponent* camera = nullptr;
-    ForEachComponent<CCameraComponent>([&camera](CCameraComponent* comp)
-                                      {
-      if (!camera) 
-      {
-        camera = comp;
-       
-      } });
+    CCameraComponent* camera = FindComponent<CCameraComponent>();
 
     if (!camera)
     {
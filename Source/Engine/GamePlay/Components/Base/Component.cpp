@@ -1,10 +1,20 @@
 #include "Engine/GamePlay/Components/Base/Component.h"
 
+#include "Engine/GamePlay/World/ComponentRegistry.h"
+
 CComponent::CComponent(CObject* Owner, FString NewName)
     : CObject(Owner, NewName)
 {
 }
 
+CComponent::~CComponent()
+{
+  if (m_Registry)
+  {
+    m_Registry->Unregister(this);
+  }
+}
+
 void CComponent::Update(float DeltaTime)
 {
   CObject::Update(DeltaTime);
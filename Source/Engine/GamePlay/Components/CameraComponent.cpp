@@ -45,8 +45,9 @@
 {
 
 
-    if (auto* springArm = dynamic_cast<CSpringArmComponent*>(GetParent()))
+    if (GetParent() && GetParent()->IsA<CSpringArmComponent>())
     {
+        auto* springArm = static_cast<CSpringArmComponent*>(GetParent());
         FVector worldPos = springArm->GetCameraWorldLocation();
         FVector targetPos = springArm->GetWorldLocation() + springArm->GetTargetOffset();
         FVector up = springArm->GetUpVector();
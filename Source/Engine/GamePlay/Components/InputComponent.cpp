@@ -12,7 +12,10 @@ CInputComponent::CInputComponent(CObject* Owner, FString NewName)
     // Register with input system
     CInputSystem::Get().RegisterInputComponent(this);
 
-    CORE_DEBUG("InputComponent created: %s", NewName.c_str());
+    // Update is driven by CInputSystem, not by the level tick schedule
+    m_PrimaryTick.SetCanEverTick(false);
+
+    CORE_DEBUG("InputComponent created: ", NewName);
 }
 
 CInputComponent::~CInputComponent()
@@ -20,21 +23,21 @@ CInputComponent::~CInputComponent()
     // Unregister from input system
     CInputSystem::Get().UnregisterInputComponent(this);
 
-    CORE_DEBUG("InputComponent destroyed: %s", GetName().c_str());
+    CORE_DEBUG("InputComponent destroyed: ", GetName());
 }
 
 // Bind action
 void CInputComponent::BindAction(const FString& ActionName, EInputEvent EventType, std::function<void()> Callback)
 {
     m_ActionBindings[ActionName].push_back({Callback, EventType});
-    CORE_DEBUG("Action bound: %s (event type: %d)", ActionName.c_str(), static_cast<int>(EventType));
+    CORE_DEBUG("Action bound: ", ActionName, " (event type: ", static_cast<int>(EventType), ")");
 }
 
 // Bind axis
 void CInputComponent::BindAxis(const FString& AxisName, std::function<void(float)> Callback, float Scale)
 {
     m_AxisBindings[AxisName] = {Callback, Scale};
-    CORE_DEBUG("Axis bound: %s (scale: %.2f)", AxisName.c_str(), Scale);
+    CORE_DEBUG("Axis bound: ", AxisName, " (scale: ", Scale, ")");
 }
 
 // Trigger action
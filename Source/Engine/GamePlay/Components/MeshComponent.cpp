@@ -1,13 +1,11 @@
 #include "Engine/GamePlay/Components/MeshComponent.h"
 
-#include "Engine/Core/Utilities/ObjLoader.h"
+#include "Engine/Core/Utilities/MeshAssetRegistry.h"
 
 
   CMeshComponent::CMeshComponent(CObject* Owner, FString NewName)
       : CSceneComponent(Owner, NewName)
   {
-    m_Mesh.vertices.clear();
-    m_Mesh.indices.clear();
   }
 
   void CMeshComponent::SetMesh(const std::string& MeshPath)
@@ -16,13 +14,13 @@
     // По умолчанию не создаем куб, только если путь не пустой
     if (!MeshPath.empty())
     {
-      // Пытаемся загрузить OBJ файл
-      FStaticMesh loadedMesh = ObjLoader::LoadOBJ(MeshPath);
+      // Пытаемся получить меш из реестра (загружается один раз на путь)
+      FMeshAssetRef loadedMesh = CMeshAssetRegistry::Get().Load(MeshPath);
 
       // Если загрузка успешна (есть вершины), используем загруженный меш
-      if (!loadedMesh.vertices.empty() && !loadedMesh.indices.empty())
+      if (loadedMesh)
       {
-        m_Mesh = loadedMesh;
+        m_MeshAsset = std::move(loadedMesh);
       }
       else
       {
@@ -34,9 +32,9 @@
     else
     {
       // Если путь пустой - очищаем меш
-      m_Mesh.vertices.clear();
-      m_Mesh.indices.clear();
+      m_MeshAsset.reset();
     }
+    OnMeshChanged();
   }
 
   void CMeshComponent::SetMaterial(const std::string& MaterialPath)
@@ -99,9 +97,32 @@
         // Левая грань
         20, 22, 21, 22, 20, 23};
 
-    m_Mesh.vertices = vertices;
-    m_Mesh.indices = indices;
-    m_Mesh.color = FVector(1.0f, 0.0f, 0.0f); // Red color for visibility
+    FStaticMesh cube;
+    cube.vertices = std::move(vertices);
+    cube.indices = std::move(indices);
+    m_MeshAsset = CMeshAssetRegistry::Get().Register("DefaultCube", std::move(cube));
+    OnMeshChanged();
+    m_Color = FVector(1.0f, 0.0f, 0.0f); // Red color for visibility
+  }
+
+  void CMeshComponent::SetStaticMesh(const FStaticMesh& Mesh)
+  {
+    FStaticMesh copy = Mesh;
+    m_MeshAsset = CMeshAssetRegistry::Get().Register(GetName(), std::move(copy));
+    m_Color = Mesh.color;
+    OnMeshChanged();
+  }
+
+  void CMeshComponent::SetMeshAsset(FMeshAssetRef Asset)
+  {
+    m_MeshAsset = std::move(Asset);
+    OnMeshChanged();
+  }
+
+  const FStaticMesh& CMeshComponent::GetMeshData() const
+  {
+    static const FStaticMesh EmptyMesh;
+    return m_MeshAsset ? m_MeshAsset->Mesh : EmptyMesh;
   }
 
   FMatrix CMeshComponent::GetRenderTransform() const
@@ -109,14 +130,16 @@
     return GetWorldTransform();
   }
 
-  void CMeshComponent::UpdateMeshTransform()
+  bool CMeshComponent::GetLocalBounds(FBox& OutBounds) const
   {
-    m_Mesh.transform = GetWorldTransform();
+    if (!m_MeshAsset || !m_MeshAsset->Mesh.bounds.IsValid())
+      return false;
+
+    OutBounds = m_MeshAsset->Mesh.bounds;
+    return true;
   }
 
-  void CMeshComponent::Update(float DeltaTime)
+  void CMeshComponent::OnMeshChanged()
   {
-    CSceneComponent::Update(DeltaTime);
-
-    UpdateMeshTransform();
-  }
\ No newline at end of file
+    MarkWorldTransformDirty();
+  }
@@ -1,17 +1,43 @@
 #include "Engine/GamePlay/Components/SceneComponent.h"
 #include "Engine/Core/CoreTypes.h"
+#include "Engine/GamePlay/World/Levels/Level.h"
 #include "Engine/Utils/Math/MathConstants.hpp"
 
 
 CSceneComponent::CSceneComponent(CObject* Owner, FString NewName)
     : CComponent(Owner, NewName)
 {
-  m_TransformMatrix= m_TransformMatrix.Identity ;
+  m_TransformHandle = Transforms().Allocate();
+}
+
+CSceneComponent::~CSceneComponent()
+{
+  // Лист индекса уровня хранит указатель на компонент, а запись - его хэндл
+  if (m_Level)
+  {
+    m_Level->UntrackSceneComponent(this);
+  }
+
+  // Отвязываемся от иерархии, чтобы не оставлять висячих указателей
+  if (m_Parent)
+  {
+    m_Parent->RemoveChild(this);
+  }
+  for (auto* child : m_Children)
+  {
+    if (child && child != this)
+    {
+      child->m_Parent = nullptr;
+      Transforms().SetParent(child->m_TransformHandle, INVALID_TRANSFORM_HANDLE);
+      child->MarkWorldTransformDirty();
+    }
+  }
+  Transforms().Release(m_TransformHandle);
 }
 
 void CSceneComponent::SetPosition(const FVector& Position)
 {
-  m_RelativeLocation = Position;
+  Transforms().LocalPosition(m_TransformHandle) = Position;
   UpdateTransformMatrix();
 }
 
@@ -22,7 +48,7 @@ void CSceneComponent::SetPosition(float X, float Y, float Z)
 
 void CSceneComponent::SetRelativePosition(const FVector& Position)
 {
-  m_RelativeLocation = Position;
+  Transforms().LocalPosition(m_TransformHandle) = Position;
   UpdateTransformMatrix();
 }
 
@@ -37,8 +63,7 @@ void CSceneComponent::SetRelativePosition(float val)
 }
 void CSceneComponent::SetRotation(const FVector& Rotation)
 {
-  m_WorldRotation = Rotation;
-  m_RotationQuat = FQuat::FromEuler(
+  Transforms().LocalRotation(m_TransformHandle) = FQuat::FromEuler(
       CEMath::DEG_TO_RAD * Rotation.x,
       CEMath::DEG_TO_RAD *Rotation.y,
       CEMath::DEG_TO_RAD * Rotation.z
@@ -54,7 +79,7 @@ void CSceneComponent::SetRotation(float Pitch, float Yaw, float Roll)
 void CSceneComponent::SetRelativeRotation(const FVector& Rotation)
 {
   m_RelativeRotation = Rotation;
-  m_RotationQuat = FQuat::FromEuler(
+  Transforms().LocalRotation(m_TransformHandle) = FQuat::FromEuler(
       CEMath::DEG_TO_RAD * Rotation.x,
       CEMath::DEG_TO_RAD *Rotation.y,
       CEMath::DEG_TO_RAD * Rotation.z
@@ -69,21 +94,21 @@ void CSceneComponent::SetRelativeRotation(float Pitch, float Yaw, float Roll)
 
 void CSceneComponent::SetRotation(const FQuat& Rotation)
 {
-  m_RotationQuat = Rotation;
+  Transforms().LocalRotation(m_TransformHandle) = Rotation;
   UpdateRotationFromQuat();
   UpdateTransformMatrix();
 }
 
 void CSceneComponent::SetRelativeRotation(const FQuat& Rotation)
 {
-  m_RotationQuat = Rotation;
+  Transforms().LocalRotation(m_TransformHandle) = Rotation;
   UpdateRotationFromQuat();
   UpdateTransformMatrix();
 }
 
 void CSceneComponent::SetScale(const FVector& Scale)
 {
-  m_WorldScale = Scale;
+  Transforms().WorldScale(m_TransformHandle) = Scale;
   UpdateTransformMatrix();
 }
 
@@ -99,7 +124,7 @@ void CSceneComponent::SetScale(float value)
 
 void CSceneComponent::SetRelativeScale(const FVector& Scale)
 {
-  m_RelativeScale = Scale;
+  Transforms().LocalScale(m_TransformHandle) = Scale;
   UpdateTransformMatrix();
 }
 
@@ -113,19 +138,26 @@ void CSceneComponent::SetRelativeScale(float value)
   SetRelativeScale(FVector(value, value, value));
 }
 
-const FVector& CSceneComponent::GetPosition() const
+FVector CSceneComponent::GetPosition() const
 {
-  return m_WorldLocation;
+  return GetWorldLocation();
 }
 
-const FVector& CSceneComponent::GetRelativePosition() const
+FVector CSceneComponent::GetRelativePosition() const
 {
-  return m_RelativeLocation;
+  return Transforms().LocalPosition(m_TransformHandle);
 }
 
-const FVector& CSceneComponent::GetRotation() const
+FVector CSceneComponent::GetRotation() const
 {
-  return m_WorldRotation;
+  if (m_Parent && m_Parent != this)
+  {
+    // Вычисляем мировое вращение
+    FQuat parentRot = m_Parent->GetRotationQuat();
+    FQuat worldRot = parentRot * GetRotationQuat();
+    return worldRot.ToEuler() * CEMath::RAD_TO_DEG;
+  }
+  return m_RelativeRotation;
 }
 
 const FVector& CSceneComponent::GetRelativeRotation() const
@@ -133,68 +165,35 @@ const FVector& CSceneComponent::GetRelativeRotation() const
   return m_RelativeRotation;
 }
 
-const FVector& CSceneComponent::GetScale() const
+FVector CSceneComponent::GetScale() const
 {
-  return m_WorldScale;
+  return Transforms().GetWorldScale(m_TransformHandle);
 }
 
-const FVector& CSceneComponent::GetRelativeScale() const
+FVector CSceneComponent::GetRelativeScale() const
 {
-  return m_RelativeScale;
+  return Transforms().LocalScale(m_TransformHandle);
 }
 
-const FMatrix& CSceneComponent::GetTransformMatrix() const
+FMatrix CSceneComponent::GetTransformMatrix() const
 {
-  return m_TransformMatrix;
+  return Transforms().GetLocalMatrix(m_TransformHandle);
 }
 
 FMatrix CSceneComponent::GetWorldTransform() const
 {
-  // Защита от рекурсии
-  if (m_IsComputingWorldTransform)
-  {
-    CORE_ERROR("Recursive world transform computation detected for component: {}", GetName());
-    return m_TransformMatrix;
-  }
-
-  m_IsComputingWorldTransform = true;
-
-  FMatrix result;
-
-  try
-  {
-    if (m_Parent && m_Parent != this)
-    {
-      result = m_Parent->GetWorldTransform() * m_TransformMatrix;
-    }
-    else
-    {
-      result = m_TransformMatrix;
-    }
-  }
-  catch (...)
-  {
-    CORE_ERROR("Exception in GetWorldTransform for component: {}", GetName());
-    result = m_TransformMatrix;
-  }
-
-  m_IsComputingWorldTransform = false;
-  return result;
+  return Transforms().GetWorldMatrix(m_TransformHandle);
 }
 
 FVector CSceneComponent::GetWorldLocation() const
 {
-  if (m_Parent)
-  {
-    FMatrix parentTransform = m_Parent->GetWorldTransform();
-    return (parentTransform * FVector4(m_RelativeLocation, 1.0f)).ToVector3D();
-  }
-  return m_WorldLocation;
+  const FMatrix& world = Transforms().GetWorldMatrix(m_TransformHandle);
+  return FVector(world.m[0][3], world.m[1][3], world.m[2][3]);
 }
 
 FVector CSceneComponent::GetForwardVector() const
 {
-  FVector euler = m_RotationQuat.ToEuler();
+  FVector euler = Transforms().LocalRotation(m_TransformHandle).ToEuler();
   float pitch = euler.x;
   float yaw = euler.y;
 
@@ -222,7 +221,7 @@ FVector CSceneComponent::GetUpVector() const
 void CSceneComponent::AddYawInput(float Value)
 {
   FQuat yawRot = FQuat::FromAxisAngle(FVector::UnitY, CEMath::DEG_TO_RAD * (Value));
-  m_RotationQuat = yawRot * m_RotationQuat;
+  Transforms().LocalRotation(m_TransformHandle) = yawRot * Transforms().LocalRotation(m_TransformHandle);
   UpdateRotationFromQuat();
   UpdateTransformMatrix();
 }
@@ -238,7 +237,7 @@ void CSceneComponent::AddPitchInput(float Value)
   }
 
   FQuat pitchRot = FQuat::FromAxisAngle(GetRightVector(), CEMath::DEG_TO_RAD * (Value));
-  m_RotationQuat = m_RotationQuat * pitchRot;
+  Transforms().LocalRotation(m_TransformHandle) = Transforms().LocalRotation(m_TransformHandle) * pitchRot;
   UpdateRotationFromQuat();
   UpdateTransformMatrix();
 }
@@ -275,6 +274,8 @@ void CSceneComponent::AttachToComponent(CSceneComponent* Parent)
     m_Parent->AddChild(this);
   }
 
+  Transforms().SetParent(m_TransformHandle, m_Parent ? m_Parent->m_TransformHandle : INVALID_TRANSFORM_HANDLE);
+
   UpdateTransformMatrix();
 }
 
@@ -285,7 +286,7 @@ void CSceneComponent::DetachFromParent()
 
 void CSceneComponent::Move(const FVector& Delta)
 {
-  m_RelativeLocation += Delta;
+  Transforms().LocalPosition(m_TransformHandle) += Delta;
   UpdateTransformMatrix();
 }
 
@@ -293,7 +294,7 @@ void CSceneComponent::Rotate(const FVector& Delta)
 {
   m_RelativeRotation += Delta;
   ClampPitchRotation();
-  m_RotationQuat = FQuat::FromEuler(
+  Transforms().LocalRotation(m_TransformHandle) = FQuat::FromEuler(
       CEMath::DEG_TO_RAD *(m_RelativeRotation.x),
       CEMath::DEG_TO_RAD *(m_RelativeRotation.y),
       CEMath::DEG_TO_RAD *(m_RelativeRotation.z)
@@ -303,82 +304,48 @@ void CSceneComponent::Rotate(const FVector& Delta)
 
 void CSceneComponent::Rotate(const FQuat& Delta)
 {
-  m_RotationQuat = Delta * m_RotationQuat;
+  Transforms().LocalRotation(m_TransformHandle) = Delta * Transforms().LocalRotation(m_TransformHandle);
   UpdateRotationFromQuat();
   UpdateTransformMatrix();
 }
 
 void CSceneComponent::Update(float DeltaTime)
 {
-  UpdateTransformMatrix();
-  for (size_t i = 0; i < m_Children.size(); i++)
-  {
-    auto child = m_Children[i];
-
-
-    if (child && child != this)
-    {
-      child->Update(DeltaTime);
-    }
-  }
+  // Дети тикают сами по расписанию уровня, повторно их не обновляем
+  (void)DeltaTime;
 }
 
 void CSceneComponent::UpdateTransformMatrix()
 {
- 
-  if (m_Parent && m_Parent != this)
+  // Локальная матрица T * R * S собирается в CTransformStore при пересчете
+  MarkWorldTransformDirty();
+}
+
+void CSceneComponent::MarkWorldTransformDirty()
+{
+  // Грязный узел уже гарантирует грязное поддерево
+  if (Transforms().IsDirty(m_TransformHandle))
+    return;
+
+  Transforms().MarkDirty(m_TransformHandle);
+  for (auto* child : m_Children)
   {
-    try
-    {
-      FMatrix parentTransform = m_Parent->GetWorldTransform();
-
-      m_WorldLocation = (parentTransform * FVector4(m_RelativeLocation, 1.0f)).ToVector3D();
-      
-      FVector parentScale = m_Parent->GetScale();
-      m_WorldScale = FVector(
-          m_RelativeScale.x * parentScale.x,
-          m_RelativeScale.y * parentScale.y,
-          m_RelativeScale.z * parentScale.z
-      );
-
-      // Вычисляем мировое вращение
-      FQuat parentRot = m_Parent->GetRotationQuat();
-      FQuat worldRot = parentRot * m_RotationQuat;
-      m_WorldRotation = worldRot.ToEuler() * CEMath::RAD_TO_DEG    ;
-    }
-    catch (...)
+    if (child && child != this)
     {
-      CORE_ERROR("Exception in parent transform computation for component: {}", GetName());
-      // Fallback to local transforms
-      m_WorldLocation = m_RelativeLocation;
-      m_WorldScale = m_RelativeScale;
-      m_WorldRotation = m_RelativeRotation;
+      child->MarkWorldTransformDirty();
     }
   }
-  else
-  {
-    m_WorldLocation = m_RelativeLocation;
-    m_WorldScale = m_RelativeScale;
-    m_WorldRotation = m_RelativeRotation;
-  }
-
-  // Создаем матрицу трансформации: Translation * Rotation * Scale
-  FMatrix translation = FMatrix::Translate(m_RelativeLocation);
-  FMatrix rotation = m_RotationQuat.ToMatrix() ;
-  FMatrix scale = FMatrix::Scale(m_RelativeScale);
-
-  m_TransformMatrix = translation * rotation * scale;
 }
 
 void CSceneComponent::UpdateRotationFromQuat()
 {
-  m_RelativeRotation = m_RotationQuat.ToEuler() * CEMath::RAD_TO_DEG;
+  m_RelativeRotation = Transforms().LocalRotation(m_TransformHandle).ToEuler() * CEMath::RAD_TO_DEG;
   ClampPitchRotation();
 }
 
 void CSceneComponent::UpdateQuatFromRotation()
 {
-  m_RotationQuat = FQuat::FromEuler(
+  Transforms().LocalRotation(m_TransformHandle) = FQuat::FromEuler(
       CEMath::DEG_TO_RAD*(m_RelativeRotation.x),
       CEMath::DEG_TO_RAD*(m_RelativeRotation.y),
       CEMath::DEG_TO_RAD*(m_RelativeRotation.z)
@@ -59,13 +59,7 @@ FQuat rotationQuat = GetRotationQuat();
     FVector cameraOffset = FVector(0.0f, 0.0f, m_ArmLength);
     FVector rotatedOffset = rotationQuat * cameraOffset;
 
-    CCameraComponent* camera = nullptr;
-    ForEachComponent<CCameraComponent>([&camera](CCameraComponent* comp) {
-      if (!camera) {
-        camera = comp;
-      }
-    });
-    if (camera) {
+    if (CCameraComponent* camera = FindComponent<CCameraComponent>()) {
       camera->SetRelativePosition(rotatedOffset);
     }
 
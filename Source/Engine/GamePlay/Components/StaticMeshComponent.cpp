@@ -1,6 +1,6 @@
 // CEStaticMeshComponent.cpp
 #include "Engine/GamePlay/Components/StaticMeshComponent.h"
-#include "Engine/Core/Utilities/ObjLoader.h"
+#include "Engine/Core/Utilities/MeshAssetRegistry.h"
 
 #include "Engine/Core/CoreTypes.h"
 #include <fstream>
@@ -13,8 +13,6 @@
       : CMeshComponent(Owner, NewName)
   {
     // Не создаем куб по умолчанию - меш будет пустым
-    m_Mesh.vertices.clear();
-    m_Mesh.indices.clear();
   }
 
   void CStaticMeshComponent::SetMesh(const std::string& MeshPath)
@@ -22,28 +20,25 @@
     m_MeshPath = MeshPath;
     if (!MeshPath.empty())
     {
-      FStaticMesh loadedMesh = ObjLoader::LoadOBJ(MeshPath);
-      if (!loadedMesh.vertices.empty() && !loadedMesh.indices.empty())
+      FMeshAssetRef loadedMesh = CMeshAssetRegistry::Get().Load(MeshPath);
+      if (loadedMesh)
       {
-        m_Mesh = loadedMesh;
-        return;
+        m_MeshAsset = std::move(loadedMesh);
       }
-
-      if (MeshPath.find(".cube") != std::string::npos)
+      else if (MeshPath.find(".cube") != std::string::npos)
       {
         CreateCubeMesh();
       }
       else
       {
-        m_Mesh.vertices.clear();
-        m_Mesh.indices.clear();
+        m_MeshAsset.reset();
       }
     }
     else
     {
-      m_Mesh.vertices.clear();
-      m_Mesh.indices.clear();
+      m_MeshAsset.reset();
     }
+    OnMeshChanged();
   }
 
 
@@ -0,0 +1,329 @@
+#include "Engine/GamePlay/Entities/EntityManager.h"
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+#include "CoreMinimal.h"
+
+namespace
+{
+  struct FComponentTypeInfo
+  {
+    uint32_t Size = 0;
+    uint32_t Alignment = 0;
+  };
+
+  std::mutex& GetComponentTypesMutex()
+  {
+    static std::mutex mutex;
+    return mutex;
+  }
+
+  std::vector<FComponentTypeInfo>& GetComponentTypes()
+  {
+    static std::vector<FComponentTypeInfo> types;
+    return types;
+  }
+
+  FComponentTypeInfo GetComponentType(uint32_t ComponentId)
+  {
+    std::lock_guard<std::mutex> lock(GetComponentTypesMutex());
+    return GetComponentTypes()[ComponentId];
+  }
+
+  uint32_t AlignUp(uint32_t Value, uint32_t Alignment)
+  {
+    return (Value + Alignment - 1) / Alignment * Alignment;
+  }
+}  // namespace
+
+uint32_t RegisterEntityComponentType(uint32_t Size, uint32_t Alignment)
+{
+  std::lock_guard<std::mutex> lock(GetComponentTypesMutex());
+  std::vector<FComponentTypeInfo>& types = GetComponentTypes();
+  if (types.size() >= MAX_ENTITY_COMPONENT_TYPES)
+  {
+    throw std::runtime_error("Too many entity component types, limit is " + std::to_string(MAX_ENTITY_COMPONENT_TYPES));
+  }
+
+  types.push_back(FComponentTypeInfo{Size, Alignment});
+  return static_cast<uint32_t>(types.size() - 1);
+}
+
+void CEntityManager::DestroyEntity(FEntity Entity)
+{
+  const FEntityRecord* found = FindRecord(Entity);
+  if (!found)
+    return;
+
+  FEntityRecord& record = m_Records[Entity.Index];
+  RemoveRow(*m_Archetypes[record.Archetype], record.Row);
+
+  record.Archetype = UINT32_MAX;
+  // 0 зарезервирован под невалидный хэндл
+  record.Generation = record.Generation == UINT32_MAX ? 1 : record.Generation + 1;
+  m_FreeRecords.push_back(Entity.Index);
+  --m_LiveCount;
+}
+
+void CEntityManager::DestroyEntityDeferred(FEntity Entity)
+{
+  std::lock_guard<std::mutex> lock(m_DeferredMutex);
+  m_DeferredDestroys.push_back(Entity);
+}
+
+void CEntityManager::FlushDeferred()
+{
+  // Повторное удаление одной сущности безопасно: второй хэндл уже устарел
+  for (FEntity entity : m_DeferredDestroys)
+  {
+    DestroyEntity(entity);
+  }
+  m_DeferredDestroys.clear();
+}
+
+void CEntityManager::Clear()
+{
+  m_Archetypes.clear();
+  m_ArchetypeByMask.clear();
+  for (uint32_t i = 0; i < m_Records.size(); ++i)
+  {
+    FEntityRecord& record = m_Records[i];
+    if (record.Archetype != UINT32_MAX)
+    {
+      record.Archetype = UINT32_MAX;
+      record.Generation = record.Generation == UINT32_MAX ? 1 : record.Generation + 1;
+      m_FreeRecords.push_back(i);
+    }
+  }
+  m_LiveCount = 0;
+  m_DeferredDestroys.clear();
+  m_RetainedMeshes.clear();
+}
+
+bool CEntityManager::IsAlive(FEntity Entity) const
+{
+  return FindRecord(Entity) != nullptr;
+}
+
+FEntityMesh CEntityManager::MakeMesh(const FMeshAssetRef& Asset, const FVector& Color)
+{
+  FEntityMesh mesh;
+  mesh.Color = Color;
+  if (!Asset)
+    return mesh;
+
+  m_RetainedMeshes.emplace(Asset->Id, Asset);
+  mesh.Mesh = &Asset->Mesh;
+  mesh.MeshId = Asset->Id;
+  if (Asset->Mesh.bounds.IsValid())
+  {
+    mesh.BoundsCenter = Asset->Mesh.bounds.GetCenter();
+    mesh.BoundsRadius = Asset->Mesh.bounds.GetExtents().Length();
+  }
+  return mesh;
+}
+
+void CEntityManager::AddSystem(const FString& Name, FSystem System)
+{
+  m_Systems.push_back(FNamedSystem{Name, std::move(System)});
+}
+
+void CEntityManager::RunSystems(float DeltaTime)
+{
+  CE_PROFILE_SCOPE("CEntityManager::RunSystems");
+  for (FNamedSystem& system : m_Systems)
+  {
+    system.System(*this, DeltaTime);
+  }
+  FlushDeferred();
+}
+
+void CEntityManager::GatherChunks(FEntityComponentMask Mask, std::vector<FChunkRef>& OutChunks) const
+{
+  for (const auto& archetype : m_Archetypes)
+  {
+    if ((archetype->Mask & Mask) != Mask)
+      continue;
+
+    for (uint32_t chunk = 0; chunk < archetype->Chunks.size(); ++chunk)
+    {
+      OutChunks.push_back(FChunkRef{archetype.get(), chunk});
+    }
+  }
+}
+
+uint32_t CEntityManager::FindOrCreateArchetype(FEntityComponentMask Mask)
+{
+  auto it = m_ArchetypeByMask.find(Mask);
+  if (it != m_ArchetypeByMask.end())
+    return it->second;
+
+  auto archetype = std::make_unique<FArchetype>();
+  archetype->Mask = Mask;
+  archetype->Offsets.fill(UINT32_MAX);
+
+  uint32_t rowSize = sizeof(FEntity);
+  std::vector<FComponentTypeInfo> types;
+  for (uint32_t id = 0; id < MAX_ENTITY_COMPONENT_TYPES; ++id)
+  {
+    if (Mask & (FEntityComponentMask(1) << id))
+    {
+      const FComponentTypeInfo type = GetComponentType(id);
+      archetype->Columns.push_back(FColumn{id, 0, type.Size});
+      types.push_back(type);
+      rowSize += type.Size;
+    }
+  }
+
+  // Оценка без выравнивания, затем уменьшение, пока массивы с отступами не влезут в чанк
+  uint32_t capacity = ENTITY_CHUNK_SIZE / rowSize;
+  while (capacity > 0)
+  {
+    uint32_t offset = sizeof(FEntity) * capacity;
+    for (size_t i = 0; i < archetype->Columns.size(); ++i)
+    {
+      offset = AlignUp(offset, types[i].Alignment);
+      archetype->Columns[i].Offset = offset;
+      offset += types[i].Size * capacity;
+    }
+    if (offset <= ENTITY_CHUNK_SIZE)
+      break;
+    --capacity;
+  }
+  if (capacity == 0)
+  {
+    throw std::runtime_error("Entity components do not fit into a chunk, row size: " + std::to_string(rowSize));
+  }
+  for (const FColumn& column : archetype->Columns)
+  {
+    archetype->Offsets[column.ComponentId] = column.Offset;
+  }
+  archetype->Capacity = capacity;
+
+  const uint32_t index = static_cast<uint32_t>(m_Archetypes.size());
+  m_Archetypes.push_back(std::move(archetype));
+  m_ArchetypeByMask.emplace(Mask, index);
+  return index;
+}
+
+FEntity CEntityManager::AllocateEntity(uint32_t Archetype)
+{
+  uint32_t index;
+  if (!m_FreeRecords.empty())
+  {
+    index = m_FreeRecords.back();
+    m_FreeRecords.pop_back();
+  }
+  else
+  {
+    index = static_cast<uint32_t>(m_Records.size());
+    m_Records.emplace_back();
+  }
+
+  FEntityRecord& record = m_Records[index];
+  const FEntity entity{index, record.Generation};
+  record.Archetype = Archetype;
+  record.Row = AppendRow(*m_Archetypes[Archetype], entity);
+  ++m_LiveCount;
+  return entity;
+}
+
+uint32_t CEntityManager::AppendRow(FArchetype& Archetype, FEntity Entity)
+{
+  const uint32_t row = Archetype.EntityCount;
+  const uint32_t chunk = row / Archetype.Capacity;
+  const uint32_t slot = row % Archetype.Capacity;
+  if (chunk == Archetype.Chunks.size())
+  {
+    // Без обнуления: строки заполняются по мере добавления
+    Archetype.Chunks.push_back(std::unique_ptr<FChunk>(new FChunk));
+  }
+
+  std::byte* data = Archetype.Chunks[chunk]->Data;
+  reinterpret_cast<FEntity*>(data)[slot] = Entity;
+  // Компоненты, которым не передали значение, начинаются с нулей
+  for (const FColumn& column : Archetype.Columns)
+  {
+    std::memset(data + column.Offset + slot * column.Size, 0, column.Size);
+  }
+
+  ++Archetype.EntityCount;
+  return row;
+}
+
+void CEntityManager::RemoveRow(FArchetype& Archetype, uint32_t Row)
+{
+  const uint32_t last = Archetype.EntityCount - 1;
+  const uint32_t lastChunk = last / Archetype.Capacity;
+  const uint32_t lastSlot = last % Archetype.Capacity;
+
+  if (Row != last)
+  {
+    // Последняя сущность архетипа переезжает в дыру: чанки остаются плотными
+    std::byte* dst = Archetype.Chunks[Row / Archetype.Capacity]->Data;
+    std::byte* src = Archetype.Chunks[lastChunk]->Data;
+    const uint32_t slot = Row % Archetype.Capacity;
+
+    const FEntity moved = reinterpret_cast<FEntity*>(src)[lastSlot];
+    reinterpret_cast<FEntity*>(dst)[slot] = moved;
+    for (const FColumn& column : Archetype.Columns)
+    {
+      std::memcpy(dst + column.Offset + slot * column.Size, src + column.Offset + lastSlot * column.Size, column.Size);
+    }
+    m_Records[moved.Index].Row = Row;
+  }
+
+  --Archetype.EntityCount;
+  if (lastSlot == 0)
+  {
+    Archetype.Chunks.pop_back();
+  }
+}
+
+void CEntityManager::MoveToArchetype(FEntity Entity, FEntityComponentMask Mask)
+{
+  const uint32_t target = FindOrCreateArchetype(Mask);
+  FEntityRecord& record = m_Records[Entity.Index];
+  FArchetype& source = *m_Archetypes[record.Archetype];
+  FArchetype& destination = *m_Archetypes[target];
+
+  const uint32_t row = AppendRow(destination, Entity);
+  std::byte* dst = destination.Chunks[row / destination.Capacity]->Data;
+  const std::byte* src = source.Chunks[record.Row / source.Capacity]->Data;
+  const uint32_t dstSlot = row % destination.Capacity;
+  const uint32_t srcSlot = record.Row % source.Capacity;
+  for (const FColumn& column : source.Columns)
+  {
+    const uint32_t dstOffset = destination.Offsets[column.ComponentId];
+    if (dstOffset == UINT32_MAX)
+      continue;
+
+    std::memcpy(dst + dstOffset + dstSlot * column.Size, src + column.Offset + srcSlot * column.Size, column.Size);
+  }
+
+  RemoveRow(source, record.Row);
+  record.Archetype = target;
+  record.Row = row;
+}
+
+void* CEntityManager::GetComponentData(const FEntityRecord& Record, uint32_t ComponentId, uint32_t Size) const
+{
+  const FArchetype& archetype = *m_Archetypes[Record.Archetype];
+  const uint32_t offset = archetype.Offsets[ComponentId];
+  if (offset == UINT32_MAX)
+    return nullptr;
+
+  return archetype.Chunks[Record.Row / archetype.Capacity]->Data + offset + (Record.Row % archetype.Capacity) * Size;
+}
+
+const CEntityManager::FEntityRecord* CEntityManager::FindRecord(FEntity Entity) const
+{
+  if (Entity.Index >= m_Records.size())
+    return nullptr;
+
+  const FEntityRecord& record = m_Records[Entity.Index];
+  return record.Generation == Entity.Generation && record.Archetype != UINT32_MAX ? &record : nullptr;
+}
@@ -0,0 +1,101 @@
+#include "Engine/GamePlay/Entities/EntitySystems.h"
+
+#include "Engine/Core/Rendering/Data/RenderData.h"
+#include "Engine/GamePlay/World/TransformStore.h"
+
+namespace
+{
+  bool IsEntityVisible(const FFrustum* Frustum, const FEntityTransform& Transform, const FEntityMesh& Mesh)
+  {
+    if (!Frustum)
+      return true;
+
+    const FVector& scale = Transform.Scale;
+    const float maxScale = std::max(std::abs(scale.x), std::max(std::abs(scale.y), std::abs(scale.z)));
+    const FVector center = Transform.Position + Transform.Rotation * (Mesh.BoundsCenter * scale);
+    return Frustum->IntersectsSphere(center, Mesh.BoundsRadius * maxScale);
+  }
+}  // namespace
+
+namespace EntitySystems
+{
+  void Movement(CEntityManager& Entities, float DeltaTime)
+  {
+    Entities.ParallelForEach<FEntityTransform, const FEntityVelocity>(
+        [DeltaTime](FEntityTransform& Transform, const FEntityVelocity& Velocity)
+        {
+          Transform.Position = Transform.Position + Velocity.Linear * DeltaTime;
+        });
+  }
+
+  void Lifetime(CEntityManager& Entities, float DeltaTime)
+  {
+    Entities.ParallelForEachChunk<FEntityLifetime>(
+        [&Entities, DeltaTime](const FEntityChunkView& Chunk, FEntityLifetime* Lifetimes)
+        {
+          for (uint32_t i = 0; i < Chunk.Count; ++i)
+          {
+            Lifetimes[i].Remaining -= DeltaTime;
+            if (Lifetimes[i].Remaining <= 0.0f)
+            {
+              Entities.DestroyEntityDeferred(Chunk.Entities[i]);
+            }
+          }
+        });
+  }
+
+  void CollectRenderObjects(CEntityManager& Entities, const FFrustum* Frustum, FrameRenderData& RenderData)
+  {
+    const uint32_t chunkCount = Entities.CountChunks<const FEntityTransform, const FEntityMesh>();
+    if (chunkCount == 0)
+      return;
+
+    // Первый проход: сколько видимых в каждом чанке
+    std::vector<uint32_t> offsets(chunkCount + 1, 0);
+    Entities.ParallelForEachChunk<const FEntityTransform, const FEntityMesh>(
+        [Frustum, &offsets](const FEntityChunkView& Chunk, const FEntityTransform* Transforms, const FEntityMesh* Meshes)
+        {
+          uint32_t visible = 0;
+          for (uint32_t i = 0; i < Chunk.Count; ++i)
+          {
+            visible += Meshes[i].Mesh && IsEntityVisible(Frustum, Transforms[i], Meshes[i]);
+          }
+          offsets[Chunk.Index + 1] = visible;
+        });
+
+    for (uint32_t i = 0; i < chunkCount; ++i)
+    {
+      offsets[i + 1] += offsets[i];
+    }
+
+    const size_t base = RenderData.renderObjects.size();
+    const uint32_t visibleCount = offsets[chunkCount];
+    RenderData.renderObjects.resize(base + visibleCount);
+
+    // Второй проход: каждый чанк пишет в свой диапазон, порядок как у чанков
+    RenderObject* output = RenderData.renderObjects.data() + base;
+    Entities.ParallelForEachChunk<const FEntityTransform, const FEntityMesh>(
+        [Frustum, &offsets, output](const FEntityChunkView& Chunk, const FEntityTransform* Transforms, const FEntityMesh* Meshes)
+        {
+          RenderObject* object = output + offsets[Chunk.Index];
+          for (uint32_t i = 0; i < Chunk.Count; ++i)
+          {
+            const FEntityMesh& mesh = Meshes[i];
+            const FEntityTransform& transform = Transforms[i];
+            if (!mesh.Mesh || !IsEntityVisible(Frustum, transform, mesh))
+              continue;
+
+            object->mesh = mesh.Mesh;
+            object->meshId = mesh.MeshId;
+            object->transform = CTransformStore::ComposeMatrix(transform.Position, transform.Rotation, transform.Scale);
+            object->color = mesh.Color;
+            ++object;
+          }
+        });
+
+    const uint32_t tested = Entities.CountEntities<const FEntityTransform, const FEntityMesh>();
+    RenderData.culling.testedObjects += tested;
+    RenderData.culling.visibleObjects += visibleCount;
+    RenderData.culling.culledObjects += tested - visibleCount;
+  }
+}  // namespace EntitySystems
@@ -80,15 +80,14 @@
   void CGameInstance::Update(float DeltaTime)
   {
     CObject::Update(DeltaTime);
-
-    if (m_CurrentWorld)
-    {
-      m_CurrentWorld->Update(DeltaTime);
-    }
   }
 
   void CGameInstance::Tick(float DeltaTime)
   {
     Update(DeltaTime);
-    m_CurrentWorld->Tick(DeltaTime);
+    // Мир обновляется только через Tick, Update инстанса его не трогает
+    if (m_CurrentWorld)
+    {
+      m_CurrentWorld->Tick(DeltaTime);
+    }
   }
\ No newline at end of file
@@ -29,7 +29,7 @@ CInputSystem& CInputSystem::Get()
 // Initialize
 void CInputSystem::Initialize(SDL_Window* Window)
 {
-    CORE_DEBUG("[InputSystem] Initialize called with window: %p", Window);
+    CORE_DEBUG("[InputSystem] Initialize called with window: ", static_cast<const void*>(Window));
 
     m_Window = Window;
 
@@ -38,7 +38,7 @@ void CInputSystem::Initialize(SDL_Window* Window)
         // Get initial mouse state
         float x, y;
         int buttons = SDL_GetMouseState(&x, &y);
-        CORE_DEBUG("[InputSystem] Initial mouse state: x=%.1f, y=%.1f, buttons=0x%08X", x, y, buttons);
+        CORE_DEBUG("[InputSystem] Initial mouse state: x=", x, ", y=", y, ", buttons=", buttons);
 
         m_LastMousePosition = FVector2D(x, y);
         m_MousePosition = FVector2D(x, y);
@@ -92,12 +92,12 @@ void CInputSystem::RegisterInputComponent(CInputComponent* Component)
         if (it == m_InputComponents.end())
         {
             m_InputComponents.push_back(Component);
-            CORE_DEBUG("[InputSystem] Registered InputComponent: %p", Component);
-            CORE_DEBUG("[InputSystem] Total components: %d", m_InputComponents.size());
+            CORE_DEBUG("[InputSystem] Registered InputComponent: ", static_cast<const void*>(Component));
+            CORE_DEBUG("[InputSystem] Total components: ", m_InputComponents.size());
         }
         else
         {
-            CORE_DEBUG("[InputSystem] InputComponent %p already registered", Component);
+            CORE_DEBUG("[InputSystem] InputComponent ", static_cast<const void*>(Component), " already registered");
         }
     }
     else
@@ -113,26 +113,30 @@ void CInputSystem::UnregisterInputComponent(CInputComponent* Component)
     if (it != m_InputComponents.end())
     {
         m_InputComponents.erase(it);
-        CORE_DEBUG("[InputSystem] Unregistered InputComponent: %p", Component);
-        CORE_DEBUG("[InputSystem] Remaining components: %d", m_InputComponents.size());
+        CORE_DEBUG("[InputSystem] Unregistered InputComponent: ", static_cast<const void*>(Component));
+        CORE_DEBUG("[InputSystem] Remaining components: ", m_InputComponents.size());
     }
     else
     {
-        CORE_WARN("[InputSystem] InputComponent %p not found for unregistration", Component);
+        CORE_WARN("[InputSystem] InputComponent ", static_cast<const void*>(Component), " not found for unregistration");
     }
 }
 
 // Update
 void CInputSystem::Update(float DeltaTime)
 {
+    CE_PROFILE_SCOPE("CInputSystem::Update");
     // Save previous key states
     m_PreviousKeyStates = m_KeyStates;
 
-    // Process SDL events
-    SDL_Event event;
-    while (SDL_PollEvent(&event))
+    // Process SDL events (no event queue in headless mode)
+    if (!m_Headless)
     {
-        ProcessEvent(event);
+        SDL_Event event;
+        while (SDL_PollEvent(&event))
+        {
+            ProcessEvent(event);
+        }
     }
 
     // Update mouse delta
@@ -315,28 +319,28 @@ void CInputSystem::TriggerAxis(const FString& AxisName, float Value)
 void CInputSystem::AddKeyActionMapping(SDL_Keycode Key, const FString& ActionName, EInputEvent EventType)
 {
     m_KeyActionMappings.push_back({Key, ActionName, EventType});
-    CORE_DEBUG("[InputSystem] Added key action mapping: %d -> %s (%d)", Key, ActionName.c_str(), static_cast<int>(EventType));
+    CORE_DEBUG("[InputSystem] Added key action mapping: ", Key, " -> ", ActionName, " (", static_cast<int>(EventType), ")");
 }
 
 // Add key axis mapping
 void CInputSystem::AddKeyAxisMapping(SDL_Keycode Key, const FString& AxisName, float Scale)
 {
     m_KeyAxisMappings.push_back({Key, AxisName, Scale});
-    CORE_DEBUG("[InputSystem] Added key axis mapping: %d -> %s (scale: %.2f)", Key, AxisName.c_str(), Scale);
+    CORE_DEBUG("[InputSystem] Added key axis mapping: ", Key, " -> ", AxisName, " (scale: ", Scale, ")");
 }
 
 // Add mouse action mapping
 void CInputSystem::AddMouseActionMapping(Uint8 Button, const FString& ActionName, EInputEvent EventType)
 {
     m_MouseActionMappings.push_back({Button, ActionName, EventType});
-    CORE_DEBUG("[InputSystem] Added mouse action mapping: %d -> %s (%d)", Button, ActionName.c_str(), static_cast<int>(EventType));
+    CORE_DEBUG("[InputSystem] Added mouse action mapping: ", Button, " -> ", ActionName, " (", static_cast<int>(EventType), ")");
 }
 
 // Add mouse axis mapping
 void CInputSystem::AddMouseAxisMapping(const FString& AxisName, float Scale)
 {
     m_MouseAxisMappings.push_back({AxisName, Scale});
-    CORE_DEBUG("[InputSystem] Added mouse axis mapping: %s (scale: %.2f)", AxisName.c_str(), Scale);
+    CORE_DEBUG("[InputSystem] Added mouse axis mapping: ", AxisName, " (scale: ", Scale, ")");
 }
 
 // State queries
@@ -0,0 +1,72 @@
+#include "Engine/GamePlay/World/ComponentRegistry.h"
+
+#include "Engine/GamePlay/Components/Base/Component.h"
+
+CComponentRegistry::~CComponentRegistry()
+{
+  Clear();
+}
+
+void CComponentRegistry::Register(CComponent* Component)
+{
+  if (Component->m_Registry == this)
+    return;
+
+  if (Component->m_Registry)
+  {
+    Component->m_Registry->Unregister(Component);
+  }
+
+  // Класс запоминается: в деструкторе компонента GetClassInfo() уже вернет базовый
+  const ClassInfo* classInfo = Component->GetClassInfo();
+  Component->m_Registry = this;
+  Component->m_RegisteredClass = classInfo;
+  Component->m_RegistrySlots.clear();
+  for (const ClassInfo* info = classInfo; info; info = info->GetParent())
+  {
+    const uint32_t typeId = info->GetTypeId();
+    if (typeId >= m_ComponentsByType.size())
+    {
+      m_ComponentsByType.resize(typeId + 1);
+    }
+
+    std::vector<CComponent*>& components = m_ComponentsByType[typeId];
+    Component->m_RegistrySlots.push_back(static_cast<uint32_t>(components.size()));
+    components.push_back(Component);
+  }
+}
+
+void CComponentRegistry::Unregister(CComponent* Component)
+{
+  if (Component->m_Registry != this)
+    return;
+
+  // Слоты идут от собственного класса к корню; у переставленного компонента
+  // слот того же типа ищется по разнице глубин
+  const ClassInfo* info = Component->m_RegisteredClass;
+  for (uint32_t slot : Component->m_RegistrySlots)
+  {
+    std::vector<CComponent*>& components = m_ComponentsByType[info->GetTypeId()];
+    CComponent* last = components.back();
+    components[slot] = last;
+    last->m_RegistrySlots[last->m_RegisteredClass->GetDepth() - info->GetDepth()] = slot;
+    components.pop_back();
+
+    info = info->GetParent();
+  }
+
+  Component->m_Registry = nullptr;
+  Component->m_RegisteredClass = nullptr;
+  Component->m_RegistrySlots.clear();
+}
+
+void CComponentRegistry::Clear()
+{
+  for (CComponent* component : Get<CComponent>())
+  {
+    component->m_Registry = nullptr;
+    component->m_RegisteredClass = nullptr;
+    component->m_RegistrySlots.clear();
+  }
+  m_ComponentsByType.clear();
+}
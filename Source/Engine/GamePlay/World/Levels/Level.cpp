@@ -1,5 +1,23 @@
 #include "Engine/GamePlay/World/Levels/Level.h"
 
+#include <limits>
+
+#include "Engine/GamePlay/Components/SceneComponent.h"
+
+namespace
+{
+  // Точный мировой бокс компонента (в дереве лежат толстые боксы с запасом)
+  bool GetWorldBounds(const CSceneComponent* Component, FBox& OutBounds)
+  {
+    FBox localBounds;
+    if (!Component->GetLocalBounds(localBounds))
+      return false;
+
+    OutBounds = localBounds.TransformedBy(Component->GetWorldTransform());
+    return true;
+  }
+}  // namespace
+
 CLevel::CLevel(CObject* Owner, FString LevelName)
     : CObject(Owner, LevelName)
 {
@@ -8,6 +26,14 @@ CLevel::CLevel(CObject* Owner, FString LevelName)
 
 CLevel::~CLevel()
 {
+  // Акторы разрушаются после полей уровня: их компоненты не должны звать уже мертвый учет
+  for (FTrackedComponent& tracked : m_TrackedComponents)
+  {
+    if (tracked.Component)
+    {
+      tracked.Component->m_Level = nullptr;
+    }
+  }
   CORE_DEBUG("Level destroyed: ", GetName());
 }
 
@@ -20,6 +46,8 @@ void CLevel::DestroyActor(CActor* Actor)
   if (it != m_Actors.end())
   {
     CORE_DEBUG("Destroying actor: ", Actor->GetName());
+    // Листья и тики снимаются до удаления: запросы не должны вернуть мертвый компонент
+    UnregisterActor(Actor);
     m_Actors.erase(it);
   }
 }
@@ -36,39 +64,235 @@ CActor* CLevel::FindActorByName(const FString& Name)
   return nullptr;
 }
 
+void CLevel::RegisterActor(CActor* Actor)
+{
+  if (!Actor)
+    return;
 
+  m_TickScheduler.Register(Actor->GetPrimaryTick());
+  for (auto* component : Actor->GetComponents<CComponent>())
+  {
+    RegisterComponent(component);
+  }
+}
 
-void CLevel::BeginPlay()
+void CLevel::RegisterComponent(CComponent* Component)
 {
-  CObject::BeginPlay();
+  if (!Component)
+    return;
 
-  for (auto& actor : m_Actors)
+  m_TickScheduler.Register(Component->GetPrimaryTick());
+  m_ComponentRegistry.Register(Component);
+
+  if (!Component->IsA<CSceneComponent>())
+    return;
+
+  auto* sceneComponent = static_cast<CSceneComponent*>(Component);
+  const FTransformHandle handle = sceneComponent->GetTransformHandle();
+  if (handle == INVALID_TRANSFORM_HANDLE)
+    return;
+
+  if (handle >= m_TrackedComponents.size())
   {
-    actor->BeginPlay();
+    m_TrackedComponents.resize(handle + 1);
+  }
+
+  // Компонент на учете другого уровня переезжает, как и в CComponentRegistry
+  if (sceneComponent->m_Level && sceneComponent->m_Level != this)
+  {
+    sceneComponent->m_Level->UntrackSceneComponent(sceneComponent);
   }
+
+  FTrackedComponent& tracked = m_TrackedComponents[handle];
+  if (tracked.Component != sceneComponent)
+  {
+    // Хэндл освободился и достался другому компоненту
+    if (tracked.Proxy != INVALID_SPATIAL_PROXY)
+    {
+      m_SpatialIndex.DestroyProxy(tracked.Proxy);
+    }
+    if (tracked.Component)
+    {
+      tracked.Component->m_Level = nullptr;
+    }
+    tracked = FTrackedComponent{sceneComponent, INVALID_SPATIAL_PROXY};
+    sceneComponent->m_Level = this;
+  }
+  UpdateComponentProxy(tracked);
 }
 
-void CLevel::Update(float DeltaTime)
+void CLevel::UnregisterActor(CActor* Actor)
 {
-  CObject::Update(DeltaTime);
+  m_TickScheduler.Unregister(Actor->GetPrimaryTick());
+  for (auto* component : Actor->GetComponents<CComponent>())
+  {
+    m_TickScheduler.Unregister(component->GetPrimaryTick());
+    m_ComponentRegistry.Unregister(component);
+  }
 
-  for (auto& actor : m_Actors)
+  for (auto* component : Actor->GetComponents<CSceneComponent>())
   {
-    actor->Update(DeltaTime);
+    UntrackSceneComponent(component);
   }
 }
 
-void CLevel::Tick(float DeltaTime)
+void CLevel::UntrackSceneComponent(CSceneComponent* Component)
 {
+  if (Component->m_Level != this)
+    return;
 
-  Update(DeltaTime);
+  const FTransformHandle handle = Component->GetTransformHandle();
+  if (handle < m_TrackedComponents.size() && m_TrackedComponents[handle].Component == Component)
+  {
+    FTrackedComponent& tracked = m_TrackedComponents[handle];
+    if (tracked.Proxy != INVALID_SPATIAL_PROXY)
+    {
+      m_SpatialIndex.DestroyProxy(tracked.Proxy);
+    }
+    tracked = FTrackedComponent{};
+  }
+  Component->m_Level = nullptr;
+}
+
+void CLevel::UpdateComponentProxy(FTrackedComponent& Tracked)
+{
+  FBox bounds;
+  if (!GetWorldBounds(Tracked.Component, bounds))
+  {
+    // Меш сняли: компонент остается на учете, но без листа
+    if (Tracked.Proxy != INVALID_SPATIAL_PROXY)
+    {
+      m_SpatialIndex.DestroyProxy(Tracked.Proxy);
+      Tracked.Proxy = INVALID_SPATIAL_PROXY;
+    }
+    return;
+  }
 
+  if (Tracked.Proxy == INVALID_SPATIAL_PROXY)
+  {
+    Tracked.Proxy = m_SpatialIndex.CreateProxy(bounds, Tracked.Component);
+  }
+  else
+  {
+    m_SpatialIndex.MoveProxy(Tracked.Proxy, bounds);
+  }
+}
 
+void CLevel::SyncSpatialIndex()
+{
+  // Смена меша тоже помечает трансформацию, поэтому сюда попадают и новые границы
+  for (FTransformHandle handle : CTransformStore::Get().GetMovedHandles())
+  {
+    if (handle < m_TrackedComponents.size() && m_TrackedComponents[handle].Component)
+    {
+      UpdateComponentProxy(m_TrackedComponents[handle]);
+    }
+  }
+}
 
-  for (auto& actor : m_Actors)
+void CLevel::QueryBox(const FBox& Box, std::vector<CSceneComponent*>& OutComponents) const
+{
+  m_SpatialIndex.QueryBox(Box, [this, &Box, &OutComponents](FSpatialProxyId proxy)
+                          {
+                            auto* component = static_cast<CSceneComponent*>(m_SpatialIndex.GetUserData(proxy));
+                            FBox bounds;
+                            if (GetWorldBounds(component, bounds) && bounds.Intersects(Box))
+                            {
+                              OutComponents.push_back(component);
+                            }
+                            return true;
+                          });
+}
+
+void CLevel::QuerySphere(const FSphere& Sphere, std::vector<CSceneComponent*>& OutComponents) const
+{
+  m_SpatialIndex.QuerySphere(Sphere, [this, &Sphere, &OutComponents](FSpatialProxyId proxy)
+                             {
+                               auto* component = static_cast<CSceneComponent*>(m_SpatialIndex.GetUserData(proxy));
+                               FBox bounds;
+                               if (GetWorldBounds(component, bounds) && bounds.IntersectsSphere(Sphere.center, Sphere.radius))
+                               {
+                                 OutComponents.push_back(component);
+                               }
+                               return true;
+                             });
+}
+
+void CLevel::QueryFrustum(const FFrustum& Frustum, std::vector<CSceneComponent*>& OutComponents) const
+{
+  m_SpatialIndex.QueryFrustum(Frustum, [this, &Frustum, &OutComponents](FSpatialProxyId proxy)
+                              {
+                                auto* component = static_cast<CSceneComponent*>(m_SpatialIndex.GetUserData(proxy));
+                                FBox bounds;
+                                if (GetWorldBounds(component, bounds) && Frustum.IntersectsBox(bounds))
+                                {
+                                  OutComponents.push_back(component);
+                                }
+                                return true;
+                              });
+}
+
+CSceneComponent* CLevel::RayCast(const FVector& Origin, const FVector& Direction, float MaxDistance,
+                                 float* OutDistance) const
+{
+  const float inf = std::numeric_limits<float>::infinity();
+  const FVector invDirection(Direction.x != 0.0f ? 1.0f / Direction.x : inf,
+                             Direction.y != 0.0f ? 1.0f / Direction.y : inf,
+                             Direction.z != 0.0f ? 1.0f / Direction.z : inf);
+
+  CSceneComponent* closest = nullptr;
+  float closestDistance = MaxDistance;
+  m_SpatialIndex.RayCast(Origin, Direction, MaxDistance,
+                         [&](FSpatialProxyId proxy, float)
+                         {
+                           auto* component = static_cast<CSceneComponent*>(m_SpatialIndex.GetUserData(proxy));
+                           FBox bounds;
+                           float entry = 0.0f;
+                           if (!GetWorldBounds(component, bounds) ||
+                               !bounds.IntersectsRay(Origin, invDirection, closestDistance, entry))
+                           {
+                             return -1.0f;
+                           }
+
+                           closest = component;
+                           closestDistance = entry;
+                           // Начало луча внутри бокса: ближе не бывает
+                           return entry;
+                         });
+
+  if (closest && OutDistance)
   {
+    *OutDistance = closestDistance;
+  }
+  return closest;
+}
+
+void CLevel::BeginPlay()
+{
+  CObject::BeginPlay();
 
-    actor->Tick(DeltaTime);
+  for (auto& actor : m_Actors)
+  {
+    actor->BeginPlay();
+  }
 
+  // Компоненты, созданные или переназначенные после спавна, становятся на учет здесь
+  for (auto& actor : m_Actors)
+  {
+    RegisterActor(actor.get());
   }
 }
+
+void CLevel::Update(float DeltaTime)
+{
+  CObject::Update(DeltaTime);
+}
+
+void CLevel::Tick(float DeltaTime)
+{
+  CE_PROFILE_SCOPE("CLevel::Tick");
+  Update(DeltaTime);
+
+  // Каждый актор и компонент уровня тикает ровно один раз, по группам и пререквизитам
+  m_TickScheduler.RunTicks(DeltaTime);
+}
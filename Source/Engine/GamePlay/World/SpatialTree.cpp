@@ -0,0 +1,263 @@
+#include "Engine/GamePlay/World/SpatialTree.h"
+
+#include <algorithm>
+
+FSpatialProxyId CSpatialTree::CreateProxy(const FBox& Bounds, void* UserData)
+{
+  const int32_t proxy = AllocateNode();
+  FNode& node = m_Nodes[proxy];
+  node.Bounds = Bounds.Expanded(FAT_BOUNDS_MARGIN);
+  node.UserData = UserData;
+  node.Height = 0;
+
+  InsertLeaf(proxy);
+  ++m_ProxyCount;
+  return proxy;
+}
+
+void CSpatialTree::DestroyProxy(FSpatialProxyId Proxy)
+{
+  if (Proxy < 0 || Proxy >= static_cast<int32_t>(m_Nodes.size()) || !m_Nodes[Proxy].IsLeaf() ||
+      m_Nodes[Proxy].Height != 0)
+    return;
+
+  RemoveLeaf(Proxy);
+  FreeNode(Proxy);
+  --m_ProxyCount;
+}
+
+bool CSpatialTree::MoveProxy(FSpatialProxyId Proxy, const FBox& Bounds)
+{
+  const FBox& fatBounds = m_Nodes[Proxy].Bounds;
+
+  // Толстый бокс, сильно больше нужного, тоже переставляем, иначе после
+  // уменьшения объекта он навсегда останется рыхлым
+  const FBox hugeBounds = Bounds.Expanded(4.0f * FAT_BOUNDS_MARGIN);
+  if (fatBounds.Contains(Bounds) && hugeBounds.Contains(fatBounds))
+    return false;
+
+  RemoveLeaf(Proxy);
+  m_Nodes[Proxy].Bounds = Bounds.Expanded(FAT_BOUNDS_MARGIN);
+  InsertLeaf(Proxy);
+  return true;
+}
+
+void CSpatialTree::Clear()
+{
+  m_Nodes.clear();
+  m_Root = NULL_NODE;
+  m_FreeList = NULL_NODE;
+  m_ProxyCount = 0;
+}
+
+int32_t CSpatialTree::AllocateNode()
+{
+  int32_t node;
+  if (m_FreeList != NULL_NODE)
+  {
+    node = m_FreeList;
+    m_FreeList = m_Nodes[node].Parent;
+  }
+  else
+  {
+    node = static_cast<int32_t>(m_Nodes.size());
+    m_Nodes.emplace_back();
+  }
+
+  m_Nodes[node] = FNode{};
+  return node;
+}
+
+void CSpatialTree::FreeNode(int32_t Node)
+{
+  m_Nodes[Node] = FNode{};
+  m_Nodes[Node].Parent = m_FreeList;
+  m_FreeList = Node;
+}
+
+void CSpatialTree::InsertLeaf(int32_t Leaf)
+{
+  if (m_Root == NULL_NODE)
+  {
+    m_Root = Leaf;
+    m_Nodes[Leaf].Parent = NULL_NODE;
+    return;
+  }
+
+  // Спуск к соседу: на каждом уровне сравниваем стоимость нового родителя здесь
+  // и нижнюю оценку стоимости спуска в каждого ребенка
+  const FBox leafBounds = m_Nodes[Leaf].Bounds;
+  int32_t index = m_Root;
+  while (!m_Nodes[index].IsLeaf())
+  {
+    const FNode& node = m_Nodes[index];
+    const float area = node.Bounds.GetHalfSurfaceArea();
+    const float combinedArea = node.Bounds.Merged(leafBounds).GetHalfSurfaceArea();
+
+    const float cost = 2.0f * combinedArea;
+    // Прирост площади, который получат все предки при спуске ниже
+    const float inheritanceCost = 2.0f * (combinedArea - area);
+
+    auto descendCost = [this, &leafBounds, inheritanceCost](int32_t child)
+    {
+      const FNode& childNode = m_Nodes[child];
+      const float merged = childNode.Bounds.Merged(leafBounds).GetHalfSurfaceArea();
+      return childNode.IsLeaf() ? merged + inheritanceCost
+                                : merged - childNode.Bounds.GetHalfSurfaceArea() + inheritanceCost;
+    };
+
+    const float cost1 = descendCost(node.Child1);
+    const float cost2 = descendCost(node.Child2);
+    if (cost < cost1 && cost < cost2)
+      break;
+
+    index = cost1 < cost2 ? node.Child1 : node.Child2;
+  }
+
+  const int32_t sibling = index;
+  const int32_t oldParent = m_Nodes[sibling].Parent;
+  const int32_t newParent = AllocateNode();
+
+  FNode& parentNode = m_Nodes[newParent];
+  parentNode.Parent = oldParent;
+  parentNode.Bounds = leafBounds.Merged(m_Nodes[sibling].Bounds);
+  parentNode.Height = m_Nodes[sibling].Height + 1;
+  parentNode.Child1 = sibling;
+  parentNode.Child2 = Leaf;
+  m_Nodes[sibling].Parent = newParent;
+  m_Nodes[Leaf].Parent = newParent;
+
+  if (oldParent != NULL_NODE)
+  {
+    if (m_Nodes[oldParent].Child1 == sibling)
+      m_Nodes[oldParent].Child1 = newParent;
+    else
+      m_Nodes[oldParent].Child2 = newParent;
+  }
+  else
+  {
+    m_Root = newParent;
+  }
+
+  RefitAncestors(m_Nodes[Leaf].Parent);
+}
+
+void CSpatialTree::RemoveLeaf(int32_t Leaf)
+{
+  if (Leaf == m_Root)
+  {
+    m_Root = NULL_NODE;
+    return;
+  }
+
+  const int32_t parent = m_Nodes[Leaf].Parent;
+  const int32_t grandParent = m_Nodes[parent].Parent;
+  const int32_t sibling = m_Nodes[parent].Child1 == Leaf ? m_Nodes[parent].Child2 : m_Nodes[parent].Child1;
+
+  // Родитель листа исчезает, сосед занимает его место
+  if (grandParent != NULL_NODE)
+  {
+    if (m_Nodes[grandParent].Child1 == parent)
+      m_Nodes[grandParent].Child1 = sibling;
+    else
+      m_Nodes[grandParent].Child2 = sibling;
+    m_Nodes[sibling].Parent = grandParent;
+    FreeNode(parent);
+
+    RefitAncestors(grandParent);
+  }
+  else
+  {
+    m_Root = sibling;
+    m_Nodes[sibling].Parent = NULL_NODE;
+    FreeNode(parent);
+  }
+  m_Nodes[Leaf].Parent = NULL_NODE;
+}
+
+void CSpatialTree::RefitAncestors(int32_t Node)
+{
+  int32_t index = Node;
+  while (index != NULL_NODE)
+  {
+    index = Balance(index);
+
+    FNode& node = m_Nodes[index];
+    const FNode& child1 = m_Nodes[node.Child1];
+    const FNode& child2 = m_Nodes[node.Child2];
+    node.Height = 1 + std::max(child1.Height, child2.Height);
+    node.Bounds = child1.Bounds.Merged(child2.Bounds);
+
+    index = node.Parent;
+  }
+}
+
+int32_t CSpatialTree::Balance(int32_t Node)
+{
+  const int32_t iA = Node;
+  FNode& A = m_Nodes[iA];
+  if (A.IsLeaf() || A.Height < 2)
+    return iA;
+
+  const int32_t iB = A.Child1;
+  const int32_t iC = A.Child2;
+  FNode& B = m_Nodes[iB];
+  FNode& C = m_Nodes[iC];
+  const int32_t balance = C.Height - B.Height;
+
+  // Поворот: более высокий ребенок поднимается на место A
+  auto rotateUp = [this, iA, &A](int32_t iUp, FNode& Up, const FNode& Stay, bool upIsChild2)
+  {
+    const int32_t iF = Up.Child1;
+    const int32_t iG = Up.Child2;
+    FNode& F = m_Nodes[iF];
+    FNode& G = m_Nodes[iG];
+
+    Up.Child1 = iA;
+    Up.Parent = A.Parent;
+    A.Parent = iUp;
+
+    if (Up.Parent != NULL_NODE)
+    {
+      if (m_Nodes[Up.Parent].Child1 == iA)
+        m_Nodes[Up.Parent].Child1 = iUp;
+      else
+        m_Nodes[Up.Parent].Child2 = iUp;
+    }
+    else
+    {
+      m_Root = iUp;
+    }
+
+    // Более высокий внук остается под Up, низкий переходит к A на место Up
+    const bool keepF = F.Height > G.Height;
+    const int32_t iKeep = keepF ? iF : iG;
+    const int32_t iMove = keepF ? iG : iF;
+    FNode& Keep = m_Nodes[iKeep];
+    FNode& Move = m_Nodes[iMove];
+
+    Up.Child2 = iKeep;
+    if (upIsChild2)
+      A.Child2 = iMove;
+    else
+      A.Child1 = iMove;
+    Move.Parent = iA;
+
+    A.Bounds = Stay.Bounds.Merged(Move.Bounds);
+    Up.Bounds = A.Bounds.Merged(Keep.Bounds);
+    A.Height = 1 + std::max(Stay.Height, Move.Height);
+    Up.Height = 1 + std::max(A.Height, Keep.Height);
+  };
+
+  if (balance > 1)
+  {
+    rotateUp(iC, C, B, true);
+    return iC;
+  }
+  if (balance < -1)
+  {
+    rotateUp(iB, B, C, false);
+    return iB;
+  }
+  return iA;
+}
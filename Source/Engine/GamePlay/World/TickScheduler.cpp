@@ -0,0 +1,335 @@
+#include "Engine/GamePlay/World/TickScheduler.h"
+
+#include "CoreMinimal.h"
+#include "Engine/Core/Jobs/JobSystem.h"
+#include "Engine/Core/Object.h"
+
+namespace
+{
+  // Меньше тиков на кусок не окупают постановку задачи
+  constexpr uint32_t MIN_PARALLEL_TICK_CHUNK = 16;
+  // Кусков на поток: запас для кражи, если тики неравномерные
+  constexpr uint32_t PARALLEL_TICK_CHUNKS_PER_THREAD = 4;
+
+  constexpr uint8_t VISIT_NONE = 0;
+  constexpr uint8_t VISIT_IN_PROGRESS = 1;
+  constexpr uint8_t VISIT_DONE = 2;
+
+  void EraseLink(std::vector<FTickFunction*>& Links, FTickFunction* Function)
+  {
+    auto it = std::find(Links.begin(), Links.end(), Function);
+    if (it != Links.end())
+    {
+      *it = Links.back();
+      Links.pop_back();
+    }
+  }
+}  // namespace
+
+FTickFunction::FTickFunction(CObject* Target)
+    : m_Target(Target)
+{
+}
+
+FTickFunction::~FTickFunction()
+{
+  if (m_Scheduler)
+  {
+    m_Scheduler->Unregister(*this);
+  }
+
+  // Связи с двух сторон: ни у кого не остается висячего указателя
+  for (FTickFunction* prerequisite : m_Prerequisites)
+  {
+    EraseLink(prerequisite->m_Dependents, this);
+  }
+  for (FTickFunction* dependent : m_Dependents)
+  {
+    EraseLink(dependent->m_Prerequisites, this);
+    dependent->MarkScheduleDirty();
+  }
+}
+
+void FTickFunction::SetTickGroup(ETickGroup Group)
+{
+  if (m_Group == Group)
+    return;
+
+  m_Group = Group;
+  MarkScheduleDirty();
+}
+
+void FTickFunction::SetTickEnabled(bool bEnabled)
+{
+  if (m_bEnabled == bEnabled)
+    return;
+
+  m_bEnabled = bEnabled;
+  m_TimeSinceTick = 0.0f;
+  MarkScheduleDirty();
+}
+
+void FTickFunction::SetCanEverTick(bool bCanEverTick)
+{
+  if (m_bCanEverTick == bCanEverTick)
+    return;
+
+  m_bCanEverTick = bCanEverTick;
+  MarkScheduleDirty();
+}
+
+void FTickFunction::SetTickInParallel(bool bEnabled)
+{
+  if (m_bTickInParallel == bEnabled)
+    return;
+
+  m_bTickInParallel = bEnabled;
+  MarkScheduleDirty();
+}
+
+void FTickFunction::AddPrerequisite(FTickFunction& Prerequisite)
+{
+  if (&Prerequisite == this ||
+      std::find(m_Prerequisites.begin(), m_Prerequisites.end(), &Prerequisite) != m_Prerequisites.end())
+    return;
+
+  m_Prerequisites.push_back(&Prerequisite);
+  Prerequisite.m_Dependents.push_back(this);
+  MarkScheduleDirty();
+}
+
+void FTickFunction::RemovePrerequisite(FTickFunction& Prerequisite)
+{
+  EraseLink(m_Prerequisites, &Prerequisite);
+  EraseLink(Prerequisite.m_Dependents, this);
+  MarkScheduleDirty();
+}
+
+void FTickFunction::MarkScheduleDirty()
+{
+  if (m_Scheduler)
+  {
+    m_Scheduler->MarkDirty();
+  }
+}
+
+CTickScheduler::~CTickScheduler()
+{
+  Clear();
+}
+
+void CTickScheduler::Register(FTickFunction& Function)
+{
+  if (Function.m_Scheduler == this)
+    return;
+
+  if (Function.m_Scheduler)
+  {
+    Function.m_Scheduler->Unregister(Function);
+  }
+
+  Function.m_Scheduler = this;
+  Function.m_RegisteredIndex = static_cast<uint32_t>(m_Functions.size());
+  Function.m_TimeSinceTick = 0.0f;
+  m_Functions.push_back(&Function);
+  m_Dirty = true;
+}
+
+void CTickScheduler::Unregister(FTickFunction& Function)
+{
+  if (Function.m_Scheduler != this)
+    return;
+
+  // swap-remove из списка зарегистрированных
+  const uint32_t index = Function.m_RegisteredIndex;
+  FTickFunction* last = m_Functions.back();
+  m_Functions[index] = last;
+  last->m_RegisteredIndex = index;
+  m_Functions.pop_back();
+
+  // Расписание не сдвигаем: текущий кадр может по нему идти
+  if (Function.m_ScheduledIndex != UINT32_MAX)
+  {
+    m_Schedule[Function.m_ScheduledIndex] = nullptr;
+  }
+
+  Function.m_Scheduler = nullptr;
+  Function.m_RegisteredIndex = UINT32_MAX;
+  Function.m_ScheduledIndex = UINT32_MAX;
+  m_Dirty = true;
+}
+
+void CTickScheduler::Clear()
+{
+  for (FTickFunction* function : m_Functions)
+  {
+    function->m_Scheduler = nullptr;
+    function->m_RegisteredIndex = UINT32_MAX;
+    function->m_ScheduledIndex = UINT32_MAX;
+  }
+  m_Functions.clear();
+  m_Schedule.clear();
+  for (FGroupRange& range : m_Groups)
+  {
+    range = FGroupRange{};
+  }
+  m_Dirty = false;
+}
+
+bool CTickScheduler::IsSchedulable(const FTickFunction& Function) const
+{
+  return Function.m_Scheduler == this && Function.m_bCanEverTick && Function.m_bEnabled;
+}
+
+bool CTickScheduler::CanRunInParallel(const FTickFunction& Function) const
+{
+  if (!m_ParallelTickEnabled || !Function.m_bTickInParallel)
+    return false;
+
+  // Пререквизит из той же группы должен закончиться раньше: такой тик идет последовательно
+  for (const FTickFunction* prerequisite : Function.m_Prerequisites)
+  {
+    if (IsSchedulable(*prerequisite) && prerequisite->m_EffectiveGroup == Function.m_EffectiveGroup)
+      return false;
+  }
+  return true;
+}
+
+void CTickScheduler::Visit(FTickFunction& Function)
+{
+  if (Function.m_VisitState == VISIT_DONE)
+    return;
+
+  Function.m_VisitState = VISIT_IN_PROGRESS;
+  ETickGroup group = Function.m_Group;
+  for (FTickFunction* prerequisite : Function.m_Prerequisites)
+  {
+    if (!IsSchedulable(*prerequisite))
+      continue;
+
+    if (prerequisite->m_VisitState == VISIT_IN_PROGRESS)
+    {
+      CORE_WARN("Tick prerequisite cycle: ", Function.m_Target->GetName(), " <-> ",
+                prerequisite->m_Target->GetName(), ", dependency ignored");
+      continue;
+    }
+
+    Visit(*prerequisite);
+    group = std::max(group, prerequisite->m_EffectiveGroup);
+  }
+
+  Function.m_EffectiveGroup = group;
+  Function.m_VisitState = VISIT_DONE;
+  m_BuildOrder.push_back(&Function);
+}
+
+void CTickScheduler::Rebuild()
+{
+  for (FTickFunction* function : m_Functions)
+  {
+    function->m_VisitState = VISIT_NONE;
+    function->m_ScheduledIndex = UINT32_MAX;
+  }
+
+  // Топологический порядок; обход по списку регистрации, поэтому независимые тики идут
+  // в порядке спавна (снятие с учета переставляет последний зарегистрированный на место снятого)
+  m_BuildOrder.clear();
+  for (FTickFunction* function : m_Functions)
+  {
+    if (IsSchedulable(*function))
+    {
+      Visit(*function);
+    }
+  }
+
+  // Раскладка по группам; пререквизит никогда не в более поздней группе, чем зависимый,
+  // поэтому порядок внутри группы остается топологическим
+  m_Schedule.clear();
+  for (size_t group = 0; group < static_cast<size_t>(ETickGroup::Count); ++group)
+  {
+    const ETickGroup tickGroup = static_cast<ETickGroup>(group);
+    FGroupRange& range = m_Groups[group];
+    range.Begin = static_cast<uint32_t>(m_Schedule.size());
+
+    for (FTickFunction* function : m_BuildOrder)
+    {
+      if (function->m_EffectiveGroup == tickGroup && CanRunInParallel(*function))
+      {
+        m_Schedule.push_back(function);
+      }
+    }
+    range.ParallelEnd = static_cast<uint32_t>(m_Schedule.size());
+
+    for (FTickFunction* function : m_BuildOrder)
+    {
+      if (function->m_EffectiveGroup == tickGroup && !CanRunInParallel(*function))
+      {
+        m_Schedule.push_back(function);
+      }
+    }
+    range.End = static_cast<uint32_t>(m_Schedule.size());
+  }
+
+  for (uint32_t i = 0; i < m_Schedule.size(); ++i)
+  {
+    m_Schedule[i]->m_ScheduledIndex = i;
+  }
+  m_Dirty = false;
+}
+
+void CTickScheduler::TickFunction(FTickFunction& Function, float DeltaTime)
+{
+  float tickDelta = DeltaTime;
+  if (Function.m_Interval > 0.0f)
+  {
+    Function.m_TimeSinceTick += DeltaTime;
+    if (Function.m_TimeSinceTick < Function.m_Interval)
+      return;
+
+    tickDelta = Function.m_TimeSinceTick;
+    Function.m_TimeSinceTick = 0.0f;
+  }
+  Function.m_Target->Tick(tickDelta);
+}
+
+void CTickScheduler::RunTicks(float DeltaTime)
+{
+  CE_PROFILE_SCOPE("CTickScheduler::RunTicks");
+  if (m_Dirty)
+  {
+    Rebuild();
+  }
+
+  for (const FGroupRange& range : m_Groups)
+  {
+    // Параллельная часть первой: последовательные тики группы могут от нее зависеть
+    if (range.ParallelEnd > range.Begin)
+    {
+      CJobSystem& jobs = CJobSystem::Get();
+      const uint32_t count = range.ParallelEnd - range.Begin;
+      const uint32_t chunkSize = std::max(MIN_PARALLEL_TICK_CHUNK,
+                                          count / (jobs.GetConcurrency() * PARALLEL_TICK_CHUNKS_PER_THREAD));
+      FTickFunction* const* parallel = m_Schedule.data() + range.Begin;
+      jobs.ParallelFor(count, chunkSize, [parallel, DeltaTime](uint32_t Begin, uint32_t End)
+                       {
+                         for (uint32_t i = Begin; i < End; ++i)
+                         {
+                           // Снятые с учета до прохода функции обнулены, как и в последовательной части
+                           if (FTickFunction* function = parallel[i])
+                           {
+                             TickFunction(*function, DeltaTime);
+                           }
+                         }
+                       });
+    }
+
+    // Индексом и с проверкой: тик может снять с учета другой объект
+    for (uint32_t i = range.ParallelEnd; i < range.End; ++i)
+    {
+      if (FTickFunction* function = m_Schedule[i])
+      {
+        TickFunction(*function, DeltaTime);
+      }
+    }
+  }
+}
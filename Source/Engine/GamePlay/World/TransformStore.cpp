@@ -0,0 +1,327 @@
+#include "Engine/GamePlay/World/TransformStore.h"
+
+#include <algorithm>
+
+namespace
+{
+  // Локальная матрица Translation * Rotation * Scale без промежуточных умножений
+  void ComposeLocal(const FVector& t, const FQuat& rotation, const FVector& s, float out[4][4])
+  {
+    FQuat q = rotation.Normalized();
+
+    float xx = q.x * q.x;
+    float yy = q.y * q.y;
+    float zz = q.z * q.z;
+    float xy = q.x * q.y;
+    float xz = q.x * q.z;
+    float yz = q.y * q.z;
+    float wx = q.w * q.x;
+    float wy = q.w * q.y;
+    float wz = q.w * q.z;
+
+    out[0][0] = (1.0f - 2.0f * (yy + zz)) * s.x;
+    out[0][1] = 2.0f * (xy - wz) * s.y;
+    out[0][2] = 2.0f * (xz + wy) * s.z;
+    out[0][3] = t.x;
+
+    out[1][0] = 2.0f * (xy + wz) * s.x;
+    out[1][1] = (1.0f - 2.0f * (xx + zz)) * s.y;
+    out[1][2] = 2.0f * (yz - wx) * s.z;
+    out[1][3] = t.y;
+
+    out[2][0] = 2.0f * (xz - wy) * s.x;
+    out[2][1] = 2.0f * (yz + wx) * s.y;
+    out[2][2] = (1.0f - 2.0f * (xx + yy)) * s.z;
+    out[2][3] = t.z;
+
+    out[3][0] = 0.0f;
+    out[3][1] = 0.0f;
+    out[3][2] = 0.0f;
+    out[3][3] = 1.0f;
+  }
+}  // namespace
+
+CTransformStore& CTransformStore::Get()
+{
+  static CTransformStore instance;
+  return instance;
+}
+
+FTransformHandle CTransformStore::Allocate()
+{
+  FTransformHandle handle;
+  if (!m_FreeHandles.empty())
+  {
+    handle = m_FreeHandles.back();
+    m_FreeHandles.pop_back();
+  }
+  else
+  {
+    handle = static_cast<FTransformHandle>(m_HandleToDense.size());
+    m_HandleToDense.push_back(0);
+    m_MovedFlag.push_back(0);
+  }
+
+  // Новый узел без родителя: порядок "родитель раньше ребенка" не нарушается
+  uint32_t dense = static_cast<uint32_t>(m_DenseToHandle.size());
+  m_HandleToDense[handle] = dense;
+  m_DenseToHandle.push_back(handle);
+  m_LocalPosition.emplace_back(0.0f, 0.0f, 0.0f);
+  m_LocalRotation.push_back(FQuat::Identity());
+  m_LocalScale.emplace_back(1.0f, 1.0f, 1.0f);
+  m_WorldScale.emplace_back(1.0f, 1.0f, 1.0f);
+  m_WorldMatrix.push_back(FMatrix::Identity);
+  m_Parent.push_back(INVALID_TRANSFORM_HANDLE);
+  m_Dirty.push_back(1);
+
+  return handle;
+}
+
+void CTransformStore::Release(FTransformHandle Handle)
+{
+  if (Handle == INVALID_TRANSFORM_HANDLE || Handle >= m_HandleToDense.size())
+    return;
+
+  // swap-remove: последний элемент переезжает на место удаленного
+  uint32_t dense = m_HandleToDense[Handle];
+  uint32_t last = static_cast<uint32_t>(m_DenseToHandle.size() - 1);
+  if (dense != last)
+  {
+    m_LocalPosition[dense] = m_LocalPosition[last];
+    m_LocalRotation[dense] = m_LocalRotation[last];
+    m_LocalScale[dense] = m_LocalScale[last];
+    m_WorldScale[dense] = m_WorldScale[last];
+    m_WorldMatrix[dense] = m_WorldMatrix[last];
+    m_Parent[dense] = m_Parent[last];
+    m_Dirty[dense] = m_Dirty[last];
+    m_DenseToHandle[dense] = m_DenseToHandle[last];
+    m_HandleToDense[m_DenseToHandle[dense]] = dense;
+    m_NeedsSort = true;
+  }
+
+  m_LocalPosition.pop_back();
+  m_LocalRotation.pop_back();
+  m_LocalScale.pop_back();
+  m_WorldScale.pop_back();
+  m_WorldMatrix.pop_back();
+  m_Parent.pop_back();
+  m_Dirty.pop_back();
+  m_DenseToHandle.pop_back();
+
+  // Хэндл достанется новому узлу: чужая отметка о сдвиге не должна перейти к нему
+  if (m_MovedFlag[Handle] == MOVED_LISTED)
+  {
+    auto it = std::find(m_MovedHandles.begin(), m_MovedHandles.end(), Handle);
+    *it = m_MovedHandles.back();
+    m_MovedHandles.pop_back();
+  }
+  m_MovedFlag[Handle] = MOVED_NONE;
+
+  m_HandleToDense[Handle] = UINT32_MAX;
+  m_FreeHandles.push_back(Handle);
+}
+
+void CTransformStore::SetParent(FTransformHandle Handle, FTransformHandle Parent)
+{
+  uint32_t dense = m_HandleToDense[Handle];
+  m_Parent[dense] = Parent;
+
+  if (Parent != INVALID_TRANSFORM_HANDLE && m_HandleToDense[Parent] > dense)
+  {
+    m_NeedsSort = true;
+  }
+}
+
+FMatrix CTransformStore::GetLocalMatrix(FTransformHandle Handle) const
+{
+  uint32_t dense = m_HandleToDense[Handle];
+  FMatrix result;
+  ComposeLocal(m_LocalPosition[dense], m_LocalRotation[dense], m_LocalScale[dense], result.m);
+  return result;
+}
+
+FMatrix CTransformStore::ComposeMatrix(const FVector& Position, const FQuat& Rotation, const FVector& Scale)
+{
+  FMatrix result;
+  ComposeLocal(Position, Rotation, Scale, result.m);
+  return result;
+}
+
+const FMatrix& CTransformStore::GetWorldMatrix(FTransformHandle Handle)
+{
+  uint32_t dense = m_HandleToDense[Handle];
+  RefreshWorld(dense);
+  return m_WorldMatrix[dense];
+}
+
+const FVector& CTransformStore::GetWorldScale(FTransformHandle Handle)
+{
+  uint32_t dense = m_HandleToDense[Handle];
+  RefreshWorld(dense);
+  return m_WorldScale[dense];
+}
+
+void CTransformStore::RefreshWorld(uint32_t Dense)
+{
+  if (!m_Dirty[Dense])
+    return;
+
+  FTransformHandle parent = m_Parent[Dense];
+  if (parent != INVALID_TRANSFORM_HANDLE)
+  {
+    RefreshWorld(m_HandleToDense[parent]);
+  }
+  ComposeWorld(Dense);
+
+  // Ленивый пересчет вызывается и из параллельного тика акторов: общий список не трогаем,
+  // узел попадет в него в следующем UpdateWorldTransforms
+  const FTransformHandle handle = m_DenseToHandle[Dense];
+  if (m_MovedFlag[handle] == MOVED_NONE)
+  {
+    m_MovedFlag[handle] = MOVED_LAZY;
+    m_HasLazyMoves.store(true, std::memory_order_relaxed);
+  }
+}
+
+void CTransformStore::ComposeWorld(uint32_t Dense)
+{
+  FTransformHandle parent = m_Parent[Dense];
+  if (parent != INVALID_TRANSFORM_HANDLE)
+  {
+    uint32_t parentDense = m_HandleToDense[parent];
+    alignas(16) float local[4][4];
+    ComposeLocal(m_LocalPosition[Dense], m_LocalRotation[Dense], m_LocalScale[Dense], local);
+    CEMath::SIMD::MultiplyMatrix(m_WorldMatrix[parentDense].m, local, m_WorldMatrix[Dense].m);
+
+    const FVector& parentScale = m_WorldScale[parentDense];
+    const FVector& scale = m_LocalScale[Dense];
+    m_WorldScale[Dense] = FVector(scale.x * parentScale.x, scale.y * parentScale.y, scale.z * parentScale.z);
+  }
+  else
+  {
+    ComposeLocal(m_LocalPosition[Dense], m_LocalRotation[Dense], m_LocalScale[Dense], m_WorldMatrix[Dense].m);
+    m_WorldScale[Dense] = m_LocalScale[Dense];
+  }
+  m_Dirty[Dense] = 0;
+}
+
+void CTransformStore::RecordMoved(FTransformHandle Handle)
+{
+  if (m_MovedFlag[Handle] != MOVED_LISTED)
+  {
+    m_MovedFlag[Handle] = MOVED_LISTED;
+    m_MovedHandles.push_back(Handle);
+  }
+}
+
+void CTransformStore::ClearMovedHandles()
+{
+  for (FTransformHandle handle : m_MovedHandles)
+  {
+    m_MovedFlag[handle] = MOVED_NONE;
+  }
+  m_MovedHandles.clear();
+}
+
+void CTransformStore::UpdateWorldTransforms()
+{
+  CE_PROFILE_SCOPE("CTransformStore::UpdateWorldTransforms");
+  if (m_NeedsSort)
+  {
+    SortHierarchy();
+  }
+
+  if (m_HasLazyMoves.exchange(false, std::memory_order_relaxed))
+  {
+    const FTransformHandle handleCount = static_cast<FTransformHandle>(m_MovedFlag.size());
+    for (FTransformHandle handle = 0; handle < handleCount; ++handle)
+    {
+      if (m_MovedFlag[handle] == MOVED_LAZY)
+      {
+        RecordMoved(handle);
+      }
+    }
+  }
+
+  // Родители всегда раньше детей, поэтому к моменту обработки узла
+  // мировая матрица родителя уже актуальна
+  const uint32_t count = static_cast<uint32_t>(m_DenseToHandle.size());
+  for (uint32_t dense = 0; dense < count; ++dense)
+  {
+    if (m_Dirty[dense])
+    {
+      ComposeWorld(dense);
+      RecordMoved(m_DenseToHandle[dense]);
+    }
+  }
+}
+
+void CTransformStore::SortHierarchy()
+{
+  const uint32_t count = static_cast<uint32_t>(m_DenseToHandle.size());
+
+  // Глубина каждого узла; циклы исключены проверкой в AttachToComponent
+  std::vector<uint32_t> depth(count, UINT32_MAX);
+  uint32_t maxDepth = 0;
+  for (uint32_t dense = 0; dense < count; ++dense)
+  {
+    uint32_t d = 0;
+    FTransformHandle parent = m_Parent[dense];
+    while (parent != INVALID_TRANSFORM_HANDLE)
+    {
+      uint32_t parentDense = m_HandleToDense[parent];
+      if (depth[parentDense] != UINT32_MAX)
+      {
+        d += depth[parentDense] + 1;
+        break;
+      }
+      ++d;
+      parent = m_Parent[parentDense];
+    }
+    depth[dense] = d;
+    maxDepth = std::max(maxDepth, d);
+  }
+
+  // Стабильная сортировка подсчетом по глубине
+  std::vector<uint32_t> offsets(maxDepth + 2, 0);
+  for (uint32_t dense = 0; dense < count; ++dense)
+  {
+    ++offsets[depth[dense] + 1];
+  }
+  for (uint32_t i = 1; i < offsets.size(); ++i)
+  {
+    offsets[i] += offsets[i - 1];
+  }
+  std::vector<uint32_t> order(count);
+  for (uint32_t dense = 0; dense < count; ++dense)
+  {
+    order[offsets[depth[dense]]++] = dense;
+  }
+
+  auto permute = [&order, count](auto& array)
+  {
+    std::remove_reference_t<decltype(array)> sorted;
+    sorted.reserve(count);
+    for (uint32_t i = 0; i < count; ++i)
+    {
+      sorted.push_back(array[order[i]]);
+    }
+    array.swap(sorted);
+  };
+
+  permute(m_LocalPosition);
+  permute(m_LocalRotation);
+  permute(m_LocalScale);
+  permute(m_WorldScale);
+  permute(m_WorldMatrix);
+  permute(m_Parent);
+  permute(m_Dirty);
+  permute(m_DenseToHandle);
+
+  for (uint32_t dense = 0; dense < count; ++dense)
+  {
+    m_HandleToDense[m_DenseToHandle[dense]] = dense;
+  }
+
+  m_NeedsSort = false;
+}
@@ -5,12 +5,16 @@
 #include "Engine/GamePlay/Actors/Actor.h"
 #include "Engine/GamePlay/Components/CameraComponent.h"
 #include "Engine/GamePlay/Components/MeshComponent.h"
+#include "Engine/GamePlay/Entities/EntitySystems.h"
 #include "Engine/GamePlay/World/Levels/Level.h"
+#include "Engine/GamePlay/World/TransformStore.h"
 #include "glm/glm.hpp"
 
 CWorld::CWorld(CObject* Owner, FString WorldName)
     : CObject(Owner, WorldName)
 {
+  m_Entities.AddSystem("Movement", EntitySystems::Movement);
+  m_Entities.AddSystem("Lifetime", EntitySystems::Lifetime);
   CORE_DEBUG("World created: ", WorldName);
 }
 
@@ -141,38 +145,38 @@ void CWorld::BeginPlay()
 void CWorld::Update(float DeltaTime)
 {
   CObject::Update(DeltaTime);
-
-  if (m_CurrentLevel)
-  {
-    m_CurrentLevel->Update(DeltaTime);
-  }
 }
 
 void CWorld::Tick(float DeltaTime)
 {
+  CE_PROFILE_SCOPE("CWorld::Tick");
   Update(DeltaTime);
-  m_CurrentLevel->Tick(DeltaTime);
-}
-
-CCameraComponent* CWorld::FindActiveCamera()
-{
-  if (!m_CurrentLevel)
-    return nullptr;
+  // Уровень обновляется только здесь: Update мира его не трогает, иначе акторы тикали бы дважды
+  if (m_CurrentLevel)
+  {
+    m_CurrentLevel->Tick(DeltaTime);
+  }
+  m_Entities.RunSystems(DeltaTime);
 
-  for (const auto& actor : m_CurrentLevel->GetActors())
+  // Один пакетный проход по всем измененным трансформациям за кадр
+  CTransformStore::Get().UpdateWorldTransforms();
+  if (m_CurrentLevel)
   {
-    auto cameraComponents = actor->GetComponents<CCameraComponent>();
-    if (!cameraComponents.empty())
-    {
-      return cameraComponents[0];
-    }
+    m_CurrentLevel->SyncSpatialIndex();
   }
+  CTransformStore::Get().ClearMovedHandles();
+}
 
-  return nullptr;
+CCameraComponent* CWorld::FindActiveCamera()
+{
+  // Первая камера уровня; порядок - порядок спавна, пока акторы с камерами не удалялись
+  TComponentView<CCameraComponent> cameras = GetAllComponents<CCameraComponent>();
+  return cameras.empty() ? nullptr : cameras[0];
 }
 
 void CWorld::CollectRenderData(FrameRenderData& renderData)
 {
+  CE_PROFILE_SCOPE("CWorld::CollectRenderData");
   if (!m_CurrentLevel)
     return;
 
@@ -204,20 +208,51 @@ void CWorld::CollectRenderData(FrameRenderData& renderData)
     renderData.SetCameraData(defaultCam);
   }
 
-  for (const auto& actor : m_CurrentLevel->GetActors())
+  CullingStats& culling = renderData.culling;
+
+  auto addRenderObject = [&renderData](const CMeshComponent* meshComp)
   {
-    auto meshComponents = actor->GetComponents<CMeshComponent>();
+    RenderObject renderObj;
+    renderObj.mesh = &meshComp->GetMeshData();
+    renderObj.meshId = meshComp->GetMeshAssetId();
+    renderObj.transform = meshComp->GetRenderTransform();
+    renderObj.color = meshComp->GetColor();
 
-    for (auto* meshComp : meshComponents)
-    {
-      RenderObject renderObj;
-      renderObj.mesh = &meshComp->GetMeshData();
-      renderObj.transform = meshComp->GetRenderTransform();
-      renderObj.color = meshComp->GetColor();
+    renderData.AddRenderObject(renderObj);
+  };
+
+  const FFrustum frustum(renderData.camera.GetViewProjection());
+  if (m_FrustumCullingEnabled)
+  {
+    // Пирамида проверяется против дерева уровня: невидимые ветки отсекаются целиком,
+    // поэтому отсеченные объекты не перебираются по одному
+    m_VisibleComponents.clear();
+    m_CurrentLevel->QueryFrustum(frustum, m_VisibleComponents);
 
-      renderData.AddRenderObject(renderObj);
+    culling.testedObjects = m_CurrentLevel->GetSpatialIndex().GetProxyCount();
+    for (auto* component : m_VisibleComponents)
+    {
+      if (component->IsA<CMeshComponent>())
+      {
+        addRenderObject(static_cast<CMeshComponent*>(component));
+        ++culling.visibleObjects;
+      }
     }
+    culling.culledObjects = culling.testedObjects - culling.visibleObjects;
   }
+  else
+  {
+    for (auto* meshComp : m_CurrentLevel->GetAllComponents<CMeshComponent>())
+    {
+      addRenderObject(meshComp);
+      ++culling.testedObjects;
+      ++culling.visibleObjects;
+    }
+  }
+
+  EntitySystems::CollectRenderObjects(m_Entities, m_FrustumCullingEnabled ? &frustum : nullptr, renderData);
+
+  m_LastCullingStats = culling;
 
   auto& lighting = renderData.lighting;
 
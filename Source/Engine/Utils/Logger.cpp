@@ -1,7 +1,127 @@
 #include "Engine/Utils/Logger.h"
 
+#include <memory>
+#include <vector>
+
 namespace CE
 {
+  namespace
+  {
+    // Записей в очереди; при переполнении пишущий поток ждет, а не теряет сообщения
+    constexpr uint64_t LOG_QUEUE_CAPACITY = 8192;
+    // Будить фоновый поток каждые столько записей, чтобы очередь не успела заполниться
+    constexpr uint64_t LOG_QUEUE_WAKE_STEP = LOG_QUEUE_CAPACITY / 4;
+    constexpr uint32_t DEFAULT_FLUSH_INTERVAL_MS = 50;
+
+    // Сырые данные записи: форматирование метки времени - в фоновом потоке
+    struct FLogRecord
+    {
+      int64_t TimeNs = 0;
+      const CLogCategory* Category = nullptr;
+      ELogLevel Level = ELogLevel::Log;
+      std::string Message;
+    };
+
+    /**
+     * @brief Ограниченная очередь: много писателей, один читатель, без блокировок
+     *
+     * У каждой ячейки счетчик последовательности: писатель занимает позицию через CAS
+     * хвоста и публикует ячейку, записав Position + 1; читатель освобождает ее,
+     * записав Position + емкость. Читатель берет записи строго по порядку позиций.
+     */
+    class CLogQueue
+    {
+     public:
+      CLogQueue()
+          : m_Slots(new FSlot[LOG_QUEUE_CAPACITY])
+      {
+        for (uint64_t i = 0; i < LOG_QUEUE_CAPACITY; ++i)
+        {
+          m_Slots[i].Sequence.store(i, std::memory_order_relaxed);
+        }
+      }
+
+      // Позиция записи или UINT64_MAX, если очередь полна
+      uint64_t TryPush(FLogRecord& Record)
+      {
+        uint64_t position = m_Tail.load(std::memory_order_relaxed);
+        while (true)
+        {
+          FSlot& slot = m_Slots[position % LOG_QUEUE_CAPACITY];
+          const uint64_t sequence = slot.Sequence.load(std::memory_order_acquire);
+          const int64_t difference = static_cast<int64_t>(sequence) - static_cast<int64_t>(position);
+          if (difference == 0)
+          {
+            if (m_Tail.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+            {
+              slot.Record = std::move(Record);
+              slot.Sequence.store(position + 1, std::memory_order_release);
+              return position;
+            }
+          }
+          else if (difference < 0)
+          {
+            return UINT64_MAX;
+          }
+          else
+          {
+            position = m_Tail.load(std::memory_order_relaxed);
+          }
+        }
+      }
+
+      bool TryPop(FLogRecord& OutRecord)
+      {
+        FSlot& slot = m_Slots[m_Head % LOG_QUEUE_CAPACITY];
+        if (slot.Sequence.load(std::memory_order_acquire) != m_Head + 1)
+          return false;
+
+        OutRecord = std::move(slot.Record);
+        slot.Record.Message.clear();
+        slot.Sequence.store(m_Head + LOG_QUEUE_CAPACITY, std::memory_order_release);
+        ++m_Head;
+        return true;
+      }
+
+      // Сколько позиций занято писателями (включая еще не опубликованные)
+      uint64_t GetPushedCount() const
+      {
+        return m_Tail.load(std::memory_order_acquire);
+      }
+
+     private:
+      // Ячейка на своей кеш-линии: соседние писатели не делят строку
+      struct alignas(64) FSlot
+      {
+        std::atomic<uint64_t> Sequence{0};
+        FLogRecord Record;
+      };
+
+      std::unique_ptr<FSlot[]> m_Slots;
+      alignas(64) std::atomic<uint64_t> m_Tail{0};
+      // Только фоновый поток
+      alignas(64) uint64_t m_Head = 0;
+    };
+
+    CLogQueue& GetLogQueue()
+    {
+      static CLogQueue queue;
+      return queue;
+    }
+
+    int64_t GetTimeNs()
+    {
+      return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                 std::chrono::system_clock::now().time_since_epoch())
+          .count();
+    }
+
+    bool IsAtLeast(ELogLevel level, ELogLevel threshold)
+    {
+      return static_cast<int>(level) <= static_cast<int>(threshold);
+    }
+  }  // namespace
+
   CLogCategory LogTemp("LogTemp");
   CLogCategory LogCore("LogCore");
   CLogCategory LogRender("LogRender");
@@ -12,14 +132,44 @@ namespace CE
   CLogCategory LogSystem("LogSystem");
 
   // Static member initialization
-  ELogLevel CLogger::s_globalLevel = ELogLevel::Log;
-  bool CLogger::s_consoleOutput = true;
-  bool CLogger::s_fileOutput = true;
-  bool CLogger::s_initialized = false;
+  std::atomic<ELogLevel> CLogger::s_globalLevel{ELogLevel::Log};
+  std::atomic<ELogLevel> CLogger::s_flushLevel{ELogLevel::Warning};
+  std::atomic<uint32_t> CLogger::s_flushIntervalMs{DEFAULT_FLUSH_INTERVAL_MS};
+  std::atomic<bool> CLogger::s_consoleOutput{true};
+  std::atomic<bool> CLogger::s_fileOutput{true};
+  std::atomic<bool> CLogger::s_initialized{false};
   bool CLogger::s_useUniqueLogFile = true;
   bool CLogger::s_overwriteExisting = false;
   std::ofstream CLogger::s_logFile;
-  std::unordered_map<const CLogCategory*, ELogLevel> CLogger::s_categoryLevels;
+  std::array<std::atomic<uint8_t>, MAX_LOG_CATEGORIES> CLogger::s_categoryLevels{};
+
+  std::thread CLogger::s_writer;
+  std::mutex CLogger::s_wakeMutex;
+  std::condition_variable CLogger::s_wakeCondition;
+  bool CLogger::s_wakeRequested = false;
+  bool CLogger::s_stopping = false;
+
+  std::mutex CLogger::s_flushMutex;
+  std::condition_variable CLogger::s_flushCondition;
+  uint64_t CLogger::s_writtenRecords = 0;
+
+  namespace
+  {
+    // Объявлен после статических членов и разрушается раньше них: поток записи
+    // останавливается, даже если Shutdown не вызвали
+    struct FLoggerShutdownGuard
+    {
+      FLoggerShutdownGuard()
+      {
+        // Очередь создается раньше охранника и разрушается позже него
+        GetLogQueue();
+      }
+      ~FLoggerShutdownGuard()
+      {
+        CLogger::Shutdown();
+      }
+    } s_shutdownGuard;
+  }  // namespace
 
   void CLogger::Initialize(bool useUniqueLogFile, bool overwriteExisting)
   {
@@ -45,6 +195,13 @@ namespace CE
       s_fileOutput = false;
     }
 
+    {
+      std::lock_guard<std::mutex> lock(s_wakeMutex);
+      s_stopping = false;
+      s_wakeRequested = false;
+    }
+    s_writer = std::thread(&CLogger::WriterLoop);
+
     s_initialized = true;
     CORE_DISPLAY("Logger initialized");
     CORE_DISPLAY("Log file: ", logPath.string());
@@ -56,13 +213,24 @@ namespace CE
       return;
 
     CORE_DISPLAY("Logger shutting down");
+    s_initialized = false;
+
+    // Поток дописывает всю очередь перед выходом
+    {
+      std::lock_guard<std::mutex> lock(s_wakeMutex);
+      s_stopping = true;
+    }
+    s_wakeCondition.notify_one();
+    if (s_writer.joinable())
+    {
+      s_writer.join();
+    }
+    s_flushCondition.notify_all();
 
     if (s_logFile.is_open())
     {
       s_logFile.close();
     }
-
-    s_initialized = false;
   }
 
   void CLogger::SetGlobalLogLevel(ELogLevel level)
@@ -73,7 +241,7 @@ namespace CE
 
   void CLogger::SetCategoryLogLevel(const CLogCategory& category, ELogLevel level)
   {
-    s_categoryLevels[&category] = level;
+    s_categoryLevels[category.GetIndex()] = static_cast<uint8_t>(static_cast<int>(level) + 1);
     CORE_DISPLAY("Category ", category.GetName(), " log level set to: ", GetLevelString(level));
   }
 
@@ -89,6 +257,168 @@ namespace CE
     CORE_DISPLAY("File output: ", enable ? "enabled" : "disabled");
   }
 
+  void CLogger::SetFlushLevel(ELogLevel level)
+  {
+    s_flushLevel = level;
+  }
+
+  void CLogger::SetFlushInterval(uint32_t milliseconds)
+  {
+    s_flushIntervalMs = milliseconds;
+    WakeWriter();
+  }
+
+  void CLogger::Flush()
+  {
+    if (!s_initialized)
+      return;
+
+    const uint64_t target = GetLogQueue().GetPushedCount();
+    WakeWriter();
+
+    std::unique_lock<std::mutex> lock(s_flushMutex);
+    s_flushCondition.wait(lock, [target] { return s_writtenRecords >= target || !s_initialized; });
+  }
+
+  void CLogger::Log(const CLogCategory& category, ELogLevel level, std::string message)
+  {
+    if (!IsEnabled(category, level))
+      return;
+
+    FLogRecord record;
+    record.TimeNs = GetTimeNs();
+    record.Category = &category;
+    record.Level = level;
+    record.Message = std::move(message);
+
+    CLogQueue& queue = GetLogQueue();
+    uint64_t position = queue.TryPush(record);
+    while (position == UINT64_MAX)
+    {
+      // Очередь полна: фоновый поток отстал, ждем его, а не теряем запись
+      WakeWriter();
+      std::this_thread::yield();
+      position = queue.TryPush(record);
+    }
+
+    if (position % LOG_QUEUE_WAKE_STEP == 0 || IsAtLeast(level, s_flushLevel.load(std::memory_order_relaxed)))
+    {
+      WakeWriter();
+    }
+
+    if (level == ELogLevel::Fatal)
+    {
+      Shutdown();
+      std::exit(1);
+    }
+  }
+
+  void CLogger::WakeWriter()
+  {
+    {
+      std::lock_guard<std::mutex> lock(s_wakeMutex);
+      s_wakeRequested = true;
+    }
+    s_wakeCondition.notify_one();
+  }
+
+  void CLogger::WriterLoop()
+  {
+    CLogQueue& queue = GetLogQueue();
+    FLogRecord record;
+    auto lastFileFlush = std::chrono::steady_clock::now();
+
+    // Метка времени до секунды меняется редко: формат через put_time раз в секунду
+    int64_t cachedSecond = -1;
+    std::string cachedStamp;
+
+    while (true)
+    {
+      uint64_t written = 0;
+      bool flushFile = false;
+      const bool consoleOutput = s_consoleOutput;
+      const bool fileOutput = s_fileOutput;
+      const ELogLevel flushLevel = s_flushLevel;
+
+      while (queue.TryPop(record))
+      {
+        const int64_t second = record.TimeNs / 1000000000;
+        if (second != cachedSecond)
+        {
+          const std::time_t time = static_cast<std::time_t>(second);
+          std::tm timeInfo;
+#ifdef _WIN32
+          localtime_s(&timeInfo, &time);
+#else
+          localtime_r(&time, &timeInfo);
+#endif
+          std::ostringstream stream;
+          stream << std::put_time(&timeInfo, "%Y-%m-%d %H:%M:%S");
+          cachedStamp = stream.str();
+          cachedSecond = second;
+        }
+
+        char milliseconds[8];
+        std::snprintf(milliseconds, sizeof(milliseconds), ".%03d", static_cast<int>(record.TimeNs / 1000000 % 1000));
+
+        std::string fullMessage;
+        fullMessage.reserve(cachedStamp.size() + record.Message.size() + 48);
+        fullMessage.append(cachedStamp).append(milliseconds).append(" ");
+        fullMessage.append(GetLevelDisplayName(record.Level)).append(": [");
+        fullMessage.append(record.Category->GetName()).append("] ").append(record.Message);
+
+        if (consoleOutput)
+        {
+          WriteToConsole(record.Level, *record.Category, fullMessage);
+        }
+        if (fileOutput)
+        {
+          WriteToFile(fullMessage);
+        }
+
+        flushFile = flushFile || IsAtLeast(record.Level, flushLevel);
+        ++written;
+      }
+
+      const auto now = std::chrono::steady_clock::now();
+      if (written > 0)
+      {
+        std::cout.flush();
+      }
+      if (written > 0 || flushFile)
+      {
+        const auto interval = std::chrono::milliseconds(s_flushIntervalMs.load());
+        if (flushFile || now - lastFileFlush >= interval)
+        {
+          if (s_logFile.is_open())
+          {
+            s_logFile.flush();
+          }
+          lastFileFlush = now;
+        }
+      }
+
+      {
+        std::lock_guard<std::mutex> lock(s_flushMutex);
+        s_writtenRecords += written;
+      }
+      s_flushCondition.notify_all();
+
+      std::unique_lock<std::mutex> lock(s_wakeMutex);
+      if (s_stopping && written == 0 && !s_wakeRequested)
+        break;
+
+      s_wakeCondition.wait_for(lock, std::chrono::milliseconds(s_flushIntervalMs.load()),
+                               [] { return s_wakeRequested || s_stopping; });
+      s_wakeRequested = false;
+    }
+
+    if (s_logFile.is_open())
+    {
+      s_logFile.flush();
+    }
+  }
+
   void CLogger::WriteToConsole(ELogLevel level, const CLogCategory& category, const std::string& message)
   {
     (void)category;  // Помечаем как неиспользуемый
@@ -124,7 +454,7 @@ namespace CE
     }
 
     SetConsoleTextAttribute(console, color);
-    std::cout << message << std::endl;
+    std::cout << message << '\n';
     SetConsoleTextAttribute(console, 7);  // Reset to white
 #else
     const char* colorCode = "";
@@ -154,7 +484,7 @@ namespace CE
         break;  // Gray
     }
 
-    std::cout << colorCode << message << "\033[0m" << std::endl;
+    std::cout << colorCode << message << "\033[0m" << '\n';
 #endif
   }
 
@@ -162,33 +492,11 @@ namespace CE
   {
     if (s_logFile.is_open())
     {
-      s_logFile << message << std::endl;
-      s_logFile.flush();
+      // Сброс на диск решает фоновый поток по политике
+      s_logFile << message << '\n';
     }
   }
 
-  std::string CLogger::GetCurrentTimeStamp()
-  {
-    auto now = std::chrono::system_clock::now();
-    auto time_t = std::chrono::system_clock::to_time_t(now);
-    auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(
-                  now.time_since_epoch()) %
-              1000;
-
-    std::tm timeInfo;
-#ifdef _WIN32
-    localtime_s(&timeInfo, &time_t);
-#else
-    localtime_r(&time_t, &timeInfo);
-#endif
-
-    std::ostringstream stream;
-    stream << std::put_time(&timeInfo, "%Y-%m-%d %H:%M:%S");
-    stream << "." << std::setfill('0') << std::setw(3) << ms.count();
-
-    return stream.str();
-  }
-
   std::string CLogger::GetLevelString(ELogLevel level)
   {
     switch (level)
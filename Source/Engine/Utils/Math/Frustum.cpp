@@ -0,0 +1,60 @@
+#include "Math/Frustum.hpp"
+
+namespace CEMath
+{
+    Frustum::Frustum() noexcept
+    {
+        for (int i = 0; i < PLANE_SLOTS; ++i)
+        {
+            m_nx[i] = 0.0f;
+            m_ny[i] = 0.0f;
+            m_nz[i] = 0.0f;
+            m_d[i] = 0.0f;
+        }
+    }
+
+    Frustum::Frustum(const Matrix4x4& viewProjection) noexcept
+    {
+        SetFromMatrix(viewProjection);
+    }
+
+    void Frustum::SetFromMatrix(const Matrix4x4& viewProjection) noexcept
+    {
+        // Gribb/Hartmann: -w <= x <= w, -w <= y <= w, 0 <= z <= w
+        const float* r0 = viewProjection.m[0];
+        const float* r1 = viewProjection.m[1];
+        const float* r2 = viewProjection.m[2];
+        const float* r3 = viewProjection.m[3];
+
+        SetPlane(Left, r3[0] + r0[0], r3[1] + r0[1], r3[2] + r0[2], r3[3] + r0[3]);
+        SetPlane(Right, r3[0] - r0[0], r3[1] - r0[1], r3[2] - r0[2], r3[3] - r0[3]);
+        SetPlane(Bottom, r3[0] + r1[0], r3[1] + r1[1], r3[2] + r1[2], r3[3] + r1[3]);
+        SetPlane(Top, r3[0] - r1[0], r3[1] - r1[1], r3[2] - r1[2], r3[3] - r1[3]);
+        SetPlane(Near, r2[0], r2[1], r2[2], r2[3]);
+        SetPlane(Far, r3[0] - r2[0], r3[1] - r2[1], r3[2] - r2[2], r3[3] - r2[3]);
+
+        for (int i = PlaneCount; i < PLANE_SLOTS; ++i)
+        {
+            m_nx[i] = m_nx[Left];
+            m_ny[i] = m_ny[Left];
+            m_nz[i] = m_nz[Left];
+            m_d[i] = m_d[Left];
+        }
+    }
+
+    Vector4D Frustum::GetPlane(EPlane plane) const noexcept
+    {
+        return Vector4D(m_nx[plane], m_ny[plane], m_nz[plane], m_d[plane]);
+    }
+
+    void Frustum::SetPlane(int index, float a, float b, float c, float d) noexcept
+    {
+        // Нормализация нужна тесту сферы: d становится расстоянием в мировых единицах
+        const float length = std::sqrt(a * a + b * b + c * c);
+        const float invLength = length > EPSILON ? 1.0f / length : 0.0f;
+        m_nx[index] = a * invLength;
+        m_ny[index] = b * invLength;
+        m_nz[index] = c * invLength;
+        m_d[index] = d * invLength;
+    }
+}
@@ -5,13 +5,6 @@
 
 namespace CEMath
 {
-    Matrix4x4::Matrix4x4() noexcept
-    {
-        for (int i = 0; i < 4; ++i)
-            for (int j = 0; j < 4; ++j)
-                m[i][j] = (i == j) ? 1.0f : 0.0f;
-    }
-    
     Matrix4x4::Matrix4x4(float diagonal) noexcept
     {
         for (int i = 0; i < 4; ++i)
@@ -60,23 +53,6 @@ namespace CEMath
 
 
 
-    Matrix4x4 Matrix4x4::operator*(const Matrix4x4& other) const noexcept
-    {
-        Matrix4x4 result;
-        for (int i = 0; i < 4; ++i)
-        {
-            for (int j = 0; j < 4; ++j)
-            {
-                result.m[i][j] = 0.0f;
-                for (int k = 0; k < 4; ++k)
-                {
-                    result.m[i][j] += m[i][k] * other.m[k][j];
-                }
-            }
-        }
-        return result;
-    }
-    
     Matrix4x4 Matrix4x4::operator*(float scalar) const noexcept
     {
         Matrix4x4 result;
@@ -92,22 +68,6 @@ namespace CEMath
         return *this * invScalar;
     }
     
-    Vector4D Matrix4x4::operator*(const Vector4D& vector) const noexcept
-    {
-        return Vector4D(
-            m[0][0] * vector.x + m[0][1] * vector.y + m[0][2] * vector.z + m[0][3] * vector.w,
-            m[1][0] * vector.x + m[1][1] * vector.y + m[1][2] * vector.z + m[1][3] * vector.w,
-            m[2][0] * vector.x + m[2][1] * vector.y + m[2][2] * vector.z + m[2][3] * vector.w,
-            m[3][0] * vector.x + m[3][1] * vector.y + m[3][2] * vector.z + m[3][3] * vector.w
-        );
-    }
-    
-    Vector3D Matrix4x4::operator*(const Vector3D& vector) const noexcept
-    {
-        Vector4D result = *this * Vector4D(vector, 1.0f);
-        return result.ToVector3D();
-    }
-    
     Matrix4x4& Matrix4x4::operator+=(const Matrix4x4& other) noexcept
     {
         for (int i = 0; i < 4; ++i)
@@ -124,12 +84,6 @@ namespace CEMath
         return *this;
     }
     
-    Matrix4x4& Matrix4x4::operator*=(const Matrix4x4& other) noexcept
-    {
-        *this = *this * other;
-        return *this;
-    }
-    
     Matrix4x4& Matrix4x4::operator*=(float scalar) noexcept
     {
         for (int i = 0; i < 4; ++i)
@@ -158,21 +112,6 @@ namespace CEMath
         return !(*this == other);
     }
     
-    Matrix4x4 Matrix4x4::Transposed() const noexcept
-    {
-        Matrix4x4 result;
-        for (int i = 0; i < 4; ++i)
-            for (int j = 0; j < 4; ++j)
-                result.m[i][j] = m[j][i];
-        return result;
-    }
-    
-    Matrix4x4& Matrix4x4::Transpose() noexcept
-    {
-        *this = Transposed();
-        return *this;
-    }
-
     bool Matrix4x4::IsOrthogonal() const
     
        {
@@ -225,105 +164,6 @@ namespace CEMath
         return det;
     }
     
-    Matrix4x4 Matrix4x4::Inversed() const noexcept
-    {
-        Matrix4x4 inv;
-        float det = Determinant();
-        
-        if (std::abs(det) < EPSILON)
-            return inv; // Return identity if matrix is singular
-            
-        float invDet = 1.0f / det;
-        
-        inv.m[0][0] = invDet * (
-            m[1][1] * (m[2][2] * m[3][3] - m[2][3] * m[3][2]) -
-            m[1][2] * (m[2][1] * m[3][3] - m[2][3] * m[3][1]) +
-            m[1][3] * (m[2][1] * m[3][2] - m[2][2] * m[3][1]));
-            
-        inv.m[0][1] = -invDet * (
-            m[0][1] * (m[2][2] * m[3][3] - m[2][3] * m[3][2]) -
-            m[0][2] * (m[2][1] * m[3][3] - m[2][3] * m[3][1]) +
-            m[0][3] * (m[2][1] * m[3][2] - m[2][2] * m[3][1]));
-            
-        inv.m[0][2] = invDet * (
-            m[0][1] * (m[1][2] * m[3][3] - m[1][3] * m[3][2]) -
-            m[0][2] * (m[1][1] * m[3][3] - m[1][3] * m[3][1]) +
-            m[0][3] * (m[1][1] * m[3][2] - m[1][2] * m[3][1]));
-            
-        inv.m[0][3] = -invDet * (
-            m[0][1] * (m[1][2] * m[2][3] - m[1][3] * m[2][2]) -
-            m[0][2] * (m[1][1] * m[2][3] - m[1][3] * m[2][1]) +
-            m[0][3] * (m[1][1] * m[2][2] - m[1][2] * m[2][1]));
-            
-        inv.m[1][0] = -invDet * (
-            m[1][0] * (m[2][2] * m[3][3] - m[2][3] * m[3][2]) -
-            m[1][2] * (m[2][0] * m[3][3] - m[2][3] * m[3][0]) +
-            m[1][3] * (m[2][0] * m[3][2] - m[2][2] * m[3][0]));
-            
-        inv.m[1][1] = invDet * (
-            m[0][0] * (m[2][2] * m[3][3] - m[2][3] * m[3][2]) -
-            m[0][2] * (m[2][0] * m[3][3] - m[2][3] * m[3][0]) +
-            m[0][3] * (m[2][0] * m[3][2] - m[2][2] * m[3][0]));
-            
-        inv.m[1][2] = -invDet * (
-            m[0][0] * (m[1][2] * m[3][3] - m[1][3] * m[3][2]) -
-            m[0][2] * (m[1][0] * m[3][3] - m[1][3] * m[3][0]) +
-            m[0][3] * (m[1][0] * m[3][2] - m[1][2] * m[3][0]));
-            
-        inv.m[1][3] = invDet * (
-            m[0][0] * (m[1][2] * m[2][3] - m[1][3] * m[2][2]) -
-            m[0][2] * (m[1][0] * m[2][3] - m[1][3] * m[2][0]) +
-            m[0][3] * (m[1][0] * m[2][2] - m[1][2] * m[2][0]));
-            
-        inv.m[2][0] = invDet * (
-            m[1][0] * (m[2][1] * m[3][3] - m[2][3] * m[3][1]) -
-            m[1][1] * (m[2][0] * m[3][3] - m[2][3] * m[3][0]) +
-            m[1][3] * (m[2][0] * m[3][1] - m[2][1] * m[3][0]));
-            
-        inv.m[2][1] = -invDet * (
-            m[0][0] * (m[2][1] * m[3][3] - m[2][3] * m[3][1]) -
-            m[0][1] * (m[2][0] * m[3][3] - m[2][3] * m[3][0]) +
-            m[0][3] * (m[2][0] * m[3][1] - m[2][1] * m[3][0]));
-            
-        inv.m[2][2] = invDet * (
-            m[0][0] * (m[1][1] * m[3][3] - m[1][3] * m[3][1]) -
-            m[0][1] * (m[1][0] * m[3][3] - m[1][3] * m[3][0]) +
-            m[0][3] * (m[1][0] * m[3][1] - m[1][1] * m[3][0]));
-            
-        inv.m[2][3] = -invDet * (
-            m[0][0] * (m[1][1] * m[2][3] - m[1][3] * m[2][1]) -
-            m[0][1] * (m[1][0] * m[2][3] - m[1][3] * m[2][0]) +
-            m[0][3] * (m[1][0] * m[2][1] - m[1][1] * m[2][0]));
-            
-        inv.m[3][0] = -invDet * (
-            m[1][0] * (m[2][1] * m[3][2] - m[2][2] * m[3][1]) -
-            m[1][1] * (m[2][0] * m[3][2] - m[2][2] * m[3][0]) +
-            m[1][2] * (m[2][0] * m[3][1] - m[2][1] * m[3][0]));
-            
-        inv.m[3][1] = invDet * (
-            m[0][0] * (m[2][1] * m[3][2] - m[2][2] * m[3][1]) -
-            m[0][1] * (m[2][0] * m[3][2] - m[2][2] * m[3][0]) +
-            m[0][2] * (m[2][0] * m[3][1] - m[2][1] * m[3][0]));
-            
-        inv.m[3][2] = -invDet * (
-            m[0][0] * (m[1][1] * m[3][2] - m[1][2] * m[3][1]) -
-            m[0][1] * (m[1][0] * m[3][2] - m[1][2] * m[3][0]) +
-            m[0][2] * (m[1][0] * m[3][1] - m[1][1] * m[3][0]));
-            
-        inv.m[3][3] = invDet * (
-            m[0][0] * (m[1][1] * m[2][2] - m[1][2] * m[2][1]) -
-            m[0][1] * (m[1][0] * m[2][2] - m[1][2] * m[2][0]) +
-            m[0][2] * (m[1][0] * m[2][1] - m[1][1] * m[2][0]));
-            
-        return inv;
-    }
-    
-    Matrix4x4& Matrix4x4::Inverse() noexcept
-    {
-        *this = Inversed();
-        return *this;
-    }
-    
     Matrix4x4 Matrix4x4::Translate(const Vector3D& translation) noexcept
     {
         Matrix4x4 result;
@@ -552,6 +392,87 @@ std::string Matrix4x4::ToStringGLSL() const
     return oss.str();
 }
 
+    void Matrix4x4::TransformPoints(const Matrix4x4& matrix, const Vector3D* points, Vector3D* out, size_t count) noexcept
+    {
+#if defined(CE_MATH_SSE2)
+        // Столбцы матрицы держим в регистрах на весь проход
+        __m128 c0 = _mm_loadu_ps(matrix.m[0]);
+        __m128 c1 = _mm_loadu_ps(matrix.m[1]);
+        __m128 c2 = _mm_loadu_ps(matrix.m[2]);
+        __m128 c3 = _mm_loadu_ps(matrix.m[3]);
+        _MM_TRANSPOSE4_PS(c0, c1, c2, c3);
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            const Vector3D& p = points[i];
+            __m128 r = SIMD::MulAdd(c0, _mm_set1_ps(p.x), c3);
+            r = SIMD::MulAdd(c1, _mm_set1_ps(p.y), r);
+            r = SIMD::MulAdd(c2, _mm_set1_ps(p.z), r);
+
+            alignas(SIMD::ALIGNMENT) float result[4];
+            _mm_store_ps(result, r);
+            out[i] = Vector3D(result[0], result[1], result[2]);
+        }
+#else
+        for (size_t i = 0; i < count; ++i)
+        {
+            out[i] = matrix * points[i];
+        }
+#endif
+    }
+
+    void Matrix4x4::TransformVectors(const Matrix4x4& matrix, const Vector4D* vectors, Vector4D* out, size_t count) noexcept
+    {
+#if defined(CE_MATH_AVX2)
+        // Два вектора за итерацию: нижняя половина регистра - vectors[i], верхняя - vectors[i + 1]
+        __m128 c0 = _mm_loadu_ps(matrix.m[0]);
+        __m128 c1 = _mm_loadu_ps(matrix.m[1]);
+        __m128 c2 = _mm_loadu_ps(matrix.m[2]);
+        __m128 c3 = _mm_loadu_ps(matrix.m[3]);
+        _MM_TRANSPOSE4_PS(c0, c1, c2, c3);
+        const __m256 cc0 = _mm256_set_m128(c0, c0);
+        const __m256 cc1 = _mm256_set_m128(c1, c1);
+        const __m256 cc2 = _mm256_set_m128(c2, c2);
+        const __m256 cc3 = _mm256_set_m128(c3, c3);
+
+        size_t i = 0;
+        for (; i + 2 <= count; i += 2)
+        {
+            const __m256 v = _mm256_loadu_ps(&vectors[i].x);
+            __m256 r = _mm256_mul_ps(cc0, _mm256_permute_ps(v, 0x00));
+            r = _mm256_add_ps(r, _mm256_mul_ps(cc1, _mm256_permute_ps(v, 0x55)));
+            r = _mm256_add_ps(r, _mm256_mul_ps(cc2, _mm256_permute_ps(v, 0xAA)));
+            r = _mm256_add_ps(r, _mm256_mul_ps(cc3, _mm256_permute_ps(v, 0xFF)));
+            _mm256_storeu_ps(&out[i].x, r);
+        }
+        for (; i < count; ++i)
+        {
+            out[i] = matrix * vectors[i];
+        }
+#else
+        for (size_t i = 0; i < count; ++i)
+        {
+            out[i] = matrix * vectors[i];
+        }
+#endif
+    }
+
+    void Matrix4x4::MultiplyBatch(const Matrix4x4* lhs, const Matrix4x4* rhs, Matrix4x4* out, size_t count) noexcept
+    {
+        for (size_t i = 0; i < count; ++i)
+        {
+            SIMD::MultiplyMatrix(lhs[i].m, rhs[i].m, out[i].m);
+        }
+    }
+
+    void Matrix4x4::MultiplyBatch(const Matrix4x4& lhs, const Matrix4x4* rhs, Matrix4x4* out, size_t count) noexcept
+    {
+        for (size_t i = 0; i < count; ++i)
+        {
+            SIMD::MultiplyMatrix(lhs.m, rhs[i].m, out[i].m);
+        }
+    }
+
     const Matrix4x4 Matrix4x4::Identity;
     const Matrix4x4 Matrix4x4::Zero(0.0f);
 }
\ No newline at end of file
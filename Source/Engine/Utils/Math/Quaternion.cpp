@@ -122,16 +122,6 @@ namespace CEMath
         return Quaternion(x - other.x, y - other.y, z - other.z, w - other.w);
     }
     
-    Quaternion Quaternion::operator*(const Quaternion& other) const noexcept
-    {
-        return Quaternion(
-            w * other.x + x * other.w + y * other.z - z * other.y,
-            w * other.y - x * other.z + y * other.w + z * other.x,
-            w * other.z + x * other.y - y * other.x + z * other.w,
-            w * other.w - x * other.x - y * other.y - z * other.z
-        );
-    }
-
     Vector3D Quaternion::operator*(const Vector3D& other) const noexcept
     {
        Quaternion q = this->Normalized();
@@ -222,16 +212,6 @@ namespace CEMath
     {
          return std::abs(LengthSquared() - 1.0f) < EPSILON;
     }
-    float Quaternion::Length() const noexcept
-    {
-        return std::sqrt(x * x + y * y + z * z + w * w);
-    }
-    
-    float Quaternion::LengthSquared() const noexcept
-    {
-        return x * x + y * y + z * z + w * w;
-    }
-    
     Quaternion Quaternion::Normalized() const noexcept
     {
         float len = Length();
@@ -273,11 +253,6 @@ namespace CEMath
         return *this;
     }
     
-    float Quaternion::Dot(const Quaternion& other) const noexcept
-    {
-        return x * other.x + y * other.y + z * other.z + w * other.w;
-    }
-    
     Vector3D Quaternion::Rotate(const Vector3D& vector) const noexcept
     {
         Quaternion vecQuat(vector.x, vector.y, vector.z, 0.0f);
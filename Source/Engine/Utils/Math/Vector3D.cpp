@@ -14,52 +14,17 @@ namespace CEMath
         return (&x)[index];
     }
     
-    Vector3D Vector3D::operator+(const Vector3D& other) const noexcept
-    {
-        return Vector3D(x + other.x, y + other.y, z + other.z);
-    }
-    
-    Vector3D Vector3D::operator-(const Vector3D& other) const noexcept
-    {
-        return Vector3D(x - other.x, y - other.y, z - other.z);
-    }
-    
-    Vector3D Vector3D::operator*(const Vector3D& other) const noexcept
-    {
-        return Vector3D(x * other.x, y * other.y, z * other.z);
-    }
     Vector3D Vector3D::operator/(const Vector3D& other) const noexcept
     {
         return Vector3D(x / other.x, y / other.y, z / other.z);
     }
     
-    Vector3D Vector3D::operator*(float scalar) const noexcept
-    {
-        return Vector3D(x * scalar, y * scalar, z * scalar);
-    }
-    
     Vector3D Vector3D::operator/(float scalar) const noexcept
     {
         const float invScalar = 1.0f / scalar;
         return Vector3D(x * invScalar, y * invScalar, z * invScalar);
     }
     
-    Vector3D& Vector3D::operator+=(const Vector3D& other) noexcept
-    {
-        x += other.x;
-        y += other.y;
-        z += other.z;
-        return *this;
-    }
-    
-    Vector3D& Vector3D::operator-=(const Vector3D& other) noexcept
-    {
-        x -= other.x;
-        y -= other.y;
-        z -= other.z;
-        return *this;
-    }
-    
     Vector3D& Vector3D::operator*=(const Vector3D& other) noexcept
     {
         x *= other.x;
@@ -76,14 +41,6 @@ namespace CEMath
         return *this;
     }
     
-    Vector3D& Vector3D::operator*=(float scalar) noexcept
-    {
-        x *= scalar;
-        y *= scalar;
-        z *= scalar;
-        return *this;
-    }
-    
     Vector3D& Vector3D::operator/=(float scalar) noexcept
     {
         const float invScalar = 1.0f / scalar;
@@ -93,11 +50,6 @@ namespace CEMath
         return *this;
     }
     
-    Vector3D Vector3D::operator-() const noexcept
-    {
-        return Vector3D(-x, -y, -z);
-    }
-    
     bool Vector3D::operator==(const Vector3D& other) const noexcept
     {
         return std::abs(x - other.x) < EPSILON && 
@@ -110,16 +62,6 @@ namespace CEMath
         return !(*this == other);
     }
     
-    float Vector3D::Length() const noexcept
-    {
-        return std::sqrt(x * x + y * y + z * z);
-    }
-    
-    float Vector3D::LengthSquared() const noexcept
-    {
-        return x * x + y * y + z * z;
-    }
-    
     Vector3D Vector3D::Normalized() const noexcept
     {
         float len = Length();
@@ -144,20 +86,6 @@ namespace CEMath
         return *this;
     }
     
-    float Vector3D::Dot(const Vector3D& other) const noexcept
-    {
-        return x * other.x + y * other.y + z * other.z;
-    }
-    
-    Vector3D Vector3D::Cross(const Vector3D& other) const noexcept
-    {
-        return Vector3D(
-            y * other.z - z * other.y,
-            z * other.x - x * other.z,
-            x * other.y - y * other.x
-        );
-    }
-    
     Vector3D Vector3D::RotateX(float angle) const noexcept
     {
         float cosA = std::cos(angle);